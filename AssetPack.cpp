@@ -0,0 +1,361 @@
+#include "AssetPack.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----- reading -----
+
+AssetPack::AssetPack(std::string const &filename_) : filename(filename_) {
+	auto fail = [this](std::string const &why) {
+		return std::runtime_error("Asset pack '" + filename + "' " + why);
+	};
+
+	//map the whole file read-only:
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) throw fail("couldn't be opened.");
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < LONGLONG(sizeof(Header))) {
+		CloseHandle(file);
+		throw fail("is too small to be a pack.");
+	}
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	void *view = (mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr);
+	if (!view) {
+		if (mapping) CloseHandle(mapping);
+		CloseHandle(file);
+		throw fail("couldn't be mapped.");
+	}
+	file_handle = file;
+	mapping_handle = mapping;
+	base = reinterpret_cast< uint8_t const * >(view);
+	length = size_t(file_size.QuadPart);
+#else
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0) throw fail("couldn't be opened.");
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < off_t(sizeof(Header))) {
+		close(fd);
+		throw fail("is too small to be a pack.");
+	}
+	void *view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); //(the mapping keeps the file open)
+	if (view == MAP_FAILED) throw fail("couldn't be mapped.");
+	base = reinterpret_cast< uint8_t const * >(view);
+	length = size_t(st.st_size);
+#endif
+
+	//check the header and index before trusting any of it:
+	try {
+		Header const &header = *reinterpret_cast< Header const * >(base);
+		if (std::memcmp(header.magic, "pack", 4) != 0) throw fail("doesn't start with 'pack'.");
+		if (header.version != Version) throw fail("is version " + std::to_string(header.version) + " (expecting " + std::to_string(Version) + ").");
+		uint64_t names_begin = sizeof(Header) + uint64_t(header.entry_count) * sizeof(Entry);
+		if (names_begin + header.names_size > length) throw fail("is truncated (index runs past the end).");
+
+		Entry const *index = reinterpret_cast< Entry const * >(base + sizeof(Header));
+		entries.reserve(header.entry_count);
+		for (uint32_t i = 0; i < header.entry_count; ++i) {
+			Entry const &entry = index[i];
+			if (uint64_t(entry.name_offset) + entry.name_length > header.names_size
+			 || entry.offset < names_begin + header.names_size || entry.offset > length || entry.stored_size > length - entry.offset) {
+				throw fail("has a bad index entry (#" + std::to_string(i) + ").");
+			}
+			if (entry.compression == Uncompressed && entry.stored_size != entry.size) {
+				throw fail("has an uncompressed entry whose sizes don't match (#" + std::to_string(i) + ").");
+			}
+			if (entry.type == Texture && entry.size != uint64_t(entry.width) * entry.height * 4) {
+				throw fail("has a texture whose size doesn't match its dimensions (#" + std::to_string(i) + ").");
+			}
+			entries.emplace_back(&entry);
+		}
+		names = reinterpret_cast< char const * >(base + names_begin);
+		std::sort(entries.begin(), entries.end(), [this](Entry const *a, Entry const *b) {
+			return name(*a) < name(*b);
+		});
+	} catch (...) {
+		unmap();
+		throw;
+	}
+}
+
+AssetPack::~AssetPack() {
+	unmap();
+}
+
+void AssetPack::unmap() {
+	if (!base) return;
+#ifdef _WIN32
+	UnmapViewOfFile(base);
+	CloseHandle(mapping_handle);
+	CloseHandle(file_handle);
+	mapping_handle = file_handle = nullptr;
+#else
+	munmap(const_cast< uint8_t * >(base), length);
+#endif
+	base = nullptr;
+	length = 0;
+}
+
+std::string AssetPack::name(Entry const &entry) const {
+	return std::string(names + entry.name_offset, entry.name_length);
+}
+
+AssetPack::Entry const *AssetPack::find(std::string const &name_) const {
+	auto f = std::lower_bound(entries.begin(), entries.end(), name_, [this](Entry const *entry, std::string const &n) {
+		return name(*entry) < n;
+	});
+	if (f == entries.end() || name(**f) != name_) return nullptr;
+	return *f;
+}
+
+void AssetPack::read(Entry const &entry, void *out) const {
+	if (entry.compression == Uncompressed) {
+		std::memcpy(out, stored(entry), size_t(entry.size));
+	} else if (entry.compression == LZ4) {
+		if (!lz4_decompress(stored(entry), size_t(entry.stored_size), reinterpret_cast< uint8_t * >(out), size_t(entry.size))) {
+			throw std::runtime_error("Asset pack '" + filename + "' has corrupt LZ4 data for '" + name(entry) + "'.");
+		}
+	} else {
+		throw std::runtime_error("Asset pack '" + filename + "' uses unknown compression " + std::to_string(entry.compression) + " for '" + name(entry) + "'.");
+	}
+}
+
+std::string AssetPack::text(std::string const &name_) const {
+	Entry const *entry = find(name_);
+	if (!entry) {
+		throw std::runtime_error("Asset pack '" + filename + "' has no entry named '" + name_ + "'.");
+	}
+	std::string ret(size_t(entry->size), '\0');
+	if (!ret.empty()) read(*entry, &ret[0]);
+	return ret;
+}
+
+//----- writing -----
+
+void AssetPackWriter::add_texture(std::string const &name, glm::uvec2 const &size, glm::u8vec4 const *lower_left_rows, bool lz4) {
+	uint8_t const *bytes = reinterpret_cast< uint8_t const * >(lower_left_rows);
+	add(name, AssetPack::Texture, std::vector< uint8_t >(bytes, bytes + size_t(size.x) * size.y * 4), lz4);
+	items.back().entry.width = size.x;
+	items.back().entry.height = size.y;
+}
+
+void AssetPackWriter::add(std::string const &name, AssetPack::Type type, std::vector< uint8_t > const &data, bool lz4) {
+	for (Item const &item : items) {
+		if (item.name == name) throw std::runtime_error("Asset pack already has an entry named '" + name + "'.");
+	}
+	items.emplace_back();
+	Item &item = items.back();
+	item.name = name;
+	std::memset(&item.entry, 0, sizeof(item.entry));
+	item.entry.type = type;
+	item.entry.size = data.size();
+	item.entry.compression = AssetPack::Uncompressed;
+	if (lz4) {
+		lz4_compress(data.data(), data.size(), &item.stored);
+		if (item.stored.size() < data.size()) {
+			item.entry.compression = AssetPack::LZ4;
+		}
+	}
+	if (item.entry.compression == AssetPack::Uncompressed) {
+		item.stored = data;
+	}
+	item.entry.stored_size = item.stored.size();
+}
+
+void AssetPackWriter::save(std::string const &filename) const {
+	AssetPack::Header header;
+	std::memcpy(header.magic, "pack", 4);
+	header.version = AssetPack::Version;
+	header.entry_count = uint32_t(items.size());
+
+	std::string names;
+	std::vector< AssetPack::Entry > index;
+	for (Item const &item : items) {
+		index.emplace_back(item.entry);
+		index.back().name_offset = uint32_t(names.size());
+		index.back().name_length = uint32_t(item.name.size());
+		names += item.name;
+	}
+	header.names_size = uint32_t(names.size());
+
+	//lay out data after the index, each entry aligned:
+	auto align = [](uint64_t offset) {
+		return (offset + AssetPack::Alignment - 1) / AssetPack::Alignment * AssetPack::Alignment;
+	};
+	uint64_t offset = sizeof(header) + index.size() * sizeof(AssetPack::Entry) + names.size();
+	for (AssetPack::Entry &entry : index) {
+		entry.offset = align(offset);
+		offset = entry.offset + entry.stored_size;
+	}
+
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) {
+		throw std::runtime_error("Failed to open '" + filename + "' to write an asset pack.");
+	}
+	out.write(reinterpret_cast< char const * >(&header), sizeof(header));
+	out.write(reinterpret_cast< char const * >(index.data()), index.size() * sizeof(AssetPack::Entry));
+	out.write(names.data(), names.size());
+	uint64_t at = sizeof(header) + index.size() * sizeof(AssetPack::Entry) + names.size();
+	char const padding[AssetPack::Alignment] = {};
+	for (size_t i = 0; i < items.size(); ++i) {
+		out.write(padding, std::streamsize(index[i].offset - at));
+		out.write(reinterpret_cast< char const * >(items[i].stored.data()), items[i].stored.size());
+		at = index[i].offset + index[i].stored_size;
+	}
+	if (!out) {
+		throw std::runtime_error("Failed to write asset pack '" + filename + "'.");
+	}
+}
+
+//----- LZ4 block format -----
+//A block is a series of sequences, each:
+// token (high nibble: literal count, low nibble: match length - 4; 15 means more length bytes follow)
+// [extra literal count bytes] literals [match offset (2 bytes) [extra match length bytes]]
+//and the last sequence is literals only. (See lz4's doc/lz4_Block_format.md.)
+
+static constexpr size_t LZ4MinMatch = 4;
+static constexpr size_t LZ4LastLiterals = 5; //the last 5 bytes are always literals
+static constexpr size_t LZ4MatchSafeDistance = 12; //and the last match starts at least 12 bytes before the end
+static constexpr uint32_t LZ4HashBits = 16;
+
+static inline uint32_t read32(uint8_t const *at) {
+	uint32_t ret;
+	std::memcpy(&ret, at, 4);
+	return ret;
+}
+
+static void lz4_write_length(size_t length, std::vector< uint8_t > *out) {
+	//(called with the length past the token's 15)
+	while (length >= 255) {
+		out->emplace_back(uint8_t(255));
+		length -= 255;
+	}
+	out->emplace_back(uint8_t(length));
+}
+
+void lz4_compress(uint8_t const *in, size_t size, std::vector< uint8_t > *out_) {
+	std::vector< uint8_t > &out = *out_;
+	out.clear();
+	out.reserve(size + size / 255 + 16);
+
+	auto emit = [&](uint8_t const *literals, size_t literal_count, size_t match_offset, size_t match_length) {
+		out.emplace_back(uint8_t((std::min< size_t >(literal_count, 15) << 4)
+			| (match_length ? std::min< size_t >(match_length - LZ4MinMatch, 15) : 0)));
+		if (literal_count >= 15) lz4_write_length(literal_count - 15, &out);
+		out.insert(out.end(), literals, literals + literal_count);
+		if (match_length) {
+			out.emplace_back(uint8_t(match_offset & 0xff));
+			out.emplace_back(uint8_t(match_offset >> 8));
+			if (match_length - LZ4MinMatch >= 15) lz4_write_length(match_length - LZ4MinMatch - 15, &out);
+		}
+	};
+
+	//greedy: at each position, check the one earlier position with the same 4-byte hash:
+	std::vector< uint32_t > table(size_t(1) << LZ4HashBits, 0);
+	auto hash = [](uint32_t v) { return (v * 2654435761u) >> (32 - LZ4HashBits); };
+
+	size_t anchor = 0; //start of pending literals
+	if (size > LZ4MatchSafeDistance) {
+		size_t match_limit = size - LZ4LastLiterals;
+		size_t i = 0;
+		while (i < size - LZ4MatchSafeDistance) {
+			uint32_t v = read32(in + i);
+			uint32_t &slot = table[hash(v)];
+			size_t candidate = slot;
+			slot = uint32_t(i);
+			if (candidate < i && i - candidate <= 0xffff && read32(in + candidate) == v) {
+				//extend backward over pending literals, then forward:
+				while (i > anchor && candidate > 0 && in[i-1] == in[candidate-1]) {
+					--i;
+					--candidate;
+				}
+				size_t length = LZ4MinMatch;
+				while (i + length < match_limit && in[i + length] == in[candidate + length]) ++length;
+				emit(in + anchor, i - anchor, i - candidate, length);
+				i += length;
+				anchor = i;
+				//(seed the table inside long runs so the next match can find them)
+				if (i - 2 < size - LZ4MatchSafeDistance) table[hash(read32(in + i - 2))] = uint32_t(i - 2);
+			} else {
+				++i;
+			}
+		}
+	}
+	emit(in + anchor, size - anchor, 0, 0);
+}
+
+//copy 'count' bytes 8 at a time, reading and writing up to 7 bytes past the ends (so callers check for slack first);
+// since chunks go front to back, this is also right for overlapping copies where 'to' is at least 8 bytes past 'from':
+static inline void wild_copy(uint8_t *to, uint8_t const *from, size_t count) {
+	uint8_t *end = to + count;
+	do {
+		std::memcpy(to, from, 8);
+		to += 8;
+		from += 8;
+	} while (to < end);
+}
+
+bool lz4_decompress(uint8_t const *in, size_t size, uint8_t *out, size_t out_size) {
+	uint8_t const *in_end = in + size;
+	size_t at = 0;
+	auto read_length = [&](size_t *length) {
+		uint8_t b;
+		do {
+			if (in == in_end) return false;
+			b = *in++;
+			*length += b;
+		} while (b == 255);
+		return true;
+	};
+
+	while (in < in_end) {
+		uint8_t token = *in++;
+
+		size_t literals = token >> 4;
+		if (literals == 15 && !read_length(&literals)) return false;
+		if (literals > size_t(in_end - in) || literals > out_size - at) return false;
+		if (literals + 8 <= size_t(in_end - in) && literals + 8 <= out_size - at) {
+			wild_copy(out + at, in, literals);
+		} else {
+			std::memcpy(out + at, in, literals);
+		}
+		in += literals;
+		at += literals;
+		if (in == in_end) break; //(the last sequence has no match)
+
+		if (in_end - in < 2) return false;
+		size_t offset = size_t(in[0]) | (size_t(in[1]) << 8);
+		in += 2;
+		size_t length = token & 0xf;
+		if (length == 15 && !read_length(&length)) return false;
+		length += LZ4MinMatch;
+		if (offset == 0 || offset > at || length > out_size - at) return false;
+
+		//(matches may overlap their own output, e.g. offset 1 repeats a byte, so copy forward)
+		uint8_t const *from = out + at - offset;
+		uint8_t *to = out + at;
+		if (offset >= 8 && length + 8 <= out_size - at) {
+			wild_copy(to, from, length);
+		} else if (offset >= length) {
+			std::memcpy(to, from, length);
+		} else {
+			for (size_t i = 0; i < length; ++i) to[i] = from[i];
+		}
+		at += length;
+	}
+	return at == out_size;
+}
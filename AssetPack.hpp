@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * An AssetPack is a single file holding many assets, built offline by the
+ *  asset-packer tool (see asset_packer_main.cpp) and memory-mapped at runtime:
+ *  - textures are stored pre-decoded, as RGBA8 rows in GL's order (first
+ *    row at the bottom), so they can be uploaded straight from the mapping;
+ *  - text (e.g. shader sources) and data (e.g. tuning tables) are stored as-is.
+ * Any entry may instead be stored LZ4-compressed (the standard LZ4 block
+ *  format), which trades a fast decompression for less I/O.
+ *
+ * File layout (all integers little-endian):
+ *   Header
+ *   Entry[entry_count]
+ *   names (not zero-terminated; see Entry::name_offset)
+ *   entry data, each starting on an 'Alignment'-byte boundary
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct AssetPack {
+	//opens and maps 'filename'; throws std::runtime_error if it can't, or if it isn't a valid pack:
+	AssetPack(std::string const &filename);
+	~AssetPack();
+	AssetPack(AssetPack const &) = delete;
+	AssetPack &operator=(AssetPack const &) = delete;
+
+	enum Type : uint32_t {
+		Texture = 1,
+		Text = 2,
+		Data = 3,
+	};
+	enum Compression : uint32_t {
+		Uncompressed = 0,
+		LZ4 = 1,
+	};
+
+	static constexpr uint32_t Version = 1;
+	static constexpr uint32_t Alignment = 64; //(for entry data; textures' rows are width * 4 bytes, so always 4-byte aligned)
+
+	struct Header {
+		char magic[4]; //"pack"
+		uint32_t version;
+		uint32_t entry_count;
+		uint32_t names_size;
+	};
+	static_assert(sizeof(Header) == 16, "AssetPack::Header should be packed");
+
+	struct Entry {
+		uint32_t name_offset; //from the start of the names
+		uint32_t name_length;
+		Type type;
+		Compression compression;
+		uint64_t offset; //of the data, from the start of the file
+		uint64_t stored_size; //bytes in the file
+		uint64_t size; //bytes once decompressed
+		uint32_t width, height; //(for textures)
+	};
+	static_assert(sizeof(Entry) == 48, "AssetPack::Entry should be packed");
+
+	std::string filename;
+
+	//all entries, sorted by name:
+	std::vector< Entry const * > entries;
+	std::string name(Entry const &entry) const;
+
+	//the entry named 'name', or nullptr:
+	Entry const *find(std::string const &name) const;
+
+	//the entry's bytes as stored (in the mapping):
+	uint8_t const *stored(Entry const &entry) const { return base + entry.offset; }
+
+	//decompress (or copy) the entry's bytes to 'out', which must have room for entry.size bytes; throws if the data is corrupt:
+	void read(Entry const &entry, void *out) const;
+
+	//convenience for text entries; throws if there is no such entry:
+	std::string text(std::string const &name) const;
+
+private:
+	void unmap();
+	uint8_t const *base = nullptr;
+	size_t length = 0;
+	char const *names = nullptr;
+#ifdef _WIN32
+	void *file_handle = nullptr;
+	void *mapping_handle = nullptr;
+#endif
+};
+
+//Builds packs (used by asset-packer):
+struct AssetPackWriter {
+	//'lz4' compresses each entry, unless that wouldn't make it smaller:
+	void add_texture(std::string const &name, glm::uvec2 const &size, glm::u8vec4 const *lower_left_rows, bool lz4);
+	void add(std::string const &name, AssetPack::Type type, std::vector< uint8_t > const &data, bool lz4);
+
+	//throws std::runtime_error on failure:
+	void save(std::string const &filename) const;
+
+	struct Item {
+		std::string name;
+		AssetPack::Entry entry;
+		std::vector< uint8_t > stored;
+	};
+	std::vector< Item > items;
+};
+
+//LZ4 block format (no frame header; the caller keeps track of the sizes):
+void lz4_compress(uint8_t const *in, size_t size, std::vector< uint8_t > *out);
+//returns false if 'in' isn't a valid block that decompresses to exactly 'out_size' bytes:
+bool lz4_decompress(uint8_t const *in, size_t size, uint8_t *out, size_t out_size);
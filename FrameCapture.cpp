@@ -0,0 +1,274 @@
+#include "FrameCapture.hpp"
+
+#include "load_save_png.hpp"
+#include "load_save_qoi.hpp"
+#include "image_ops.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+typedef std::chrono::high_resolution_clock Clock;
+
+//(leave a core for the game, and more than a few workers just contend for the output)
+static uint32_t worker_count() {
+	uint32_t hardware = std::thread::hardware_concurrency();
+	return std::max(1u, std::min(4u, hardware > 1 ? hardware - 1 : 1u));
+}
+
+FrameCapture::FrameCapture(Format format_, std::string const &destination_, uint32_t fps_)
+	: format(format_), destination(destination_), fps(fps_), readback(worker_count() + 2) {
+
+	if (format == Y4M) {
+		if (destination.size() > 1 && destination[0] == '|') {
+			y4m = popen(destination.c_str() + 1, "w");
+			y4m_is_pipe = true;
+		} else {
+			y4m = std::fopen(destination.c_str(), "wb");
+		}
+		if (!y4m) {
+			throw std::runtime_error("Failed to open '" + destination + "' for capture.");
+		}
+	}
+
+	uint32_t count = worker_count();
+	for (uint32_t i = 0; i < count; ++i) {
+		workers.emplace_back([this]() {
+			trace_thread_name("capture worker");
+			std::vector< uint8_t > scratch;
+			std::unique_lock< std::mutex > lock(mutex);
+			while (true) {
+				work_cv.wait(lock, [this]() { return quit || !jobs.empty(); });
+				if (jobs.empty()) return; //(quit, and nothing left to do)
+				Job job = jobs.front();
+				jobs.pop_front();
+				lock.unlock();
+				work(job, &scratch);
+				lock.lock();
+			}
+		});
+	}
+}
+
+FrameCapture::~FrameCapture() {
+	finish();
+}
+
+void FrameCapture::finish() {
+	if (workers.empty()) return; //(already finished)
+
+	//finish the reads in flight:
+	std::vector< GLReadback::Frame > finished;
+	readback.poll(&finished, true);
+	queue(finished);
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		for (Job const &job : reading) {
+			//(reads that never finished count as dropped frames; their own repeats were counted when they were dropped)
+			repeats += job.repeats + 1;
+			drops += 1;
+		}
+	}
+	reading.clear();
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	work_cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+
+	//frames dropped at the very end still take up time in the stream:
+	if (y4m) {
+		for (uint32_t r = 0; r < repeats && !last_yuv.empty(); ++r) {
+			std::fputs("FRAME\n", y4m);
+			std::fwrite(last_yuv.data(), 1, last_yuv.size(), y4m);
+		}
+		if (y4m_is_pipe) pclose(y4m);
+		else std::fclose(y4m);
+		y4m = nullptr;
+	}
+}
+
+void FrameCapture::frame(GLuint framebuffer, glm::uvec2 const &size) {
+	if (workers.empty()) return; //(finished)
+
+	uint64_t index = frames++;
+
+	bool read = false;
+	if (format == Y4M) {
+		//4:2:0 chroma wants even dimensions, so the odd row/column (if any) is cropped:
+		glm::uvec2 even = glm::uvec2(size.x & ~1u, size.y & ~1u);
+		if (y4m_size == glm::uvec2(0) && even.x > 0 && even.y > 0) {
+			y4m_size = even;
+			std::fputs(y4m_header(y4m_size, fps).c_str(), y4m);
+		}
+		if (even == y4m_size) {
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+			if (framebuffer == 0) glReadBuffer(GL_BACK);
+			read = readback.read(y4m_size, index);
+		} else {
+			static bool warned = false;
+			if (!warned) {
+				warned = true;
+				std::cerr << "WARNING: frame size changed while capturing to a .y4m stream; frames of the new size are dropped." << std::endl;
+			}
+		}
+	} else {
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+		if (framebuffer == 0) glReadBuffer(GL_BACK);
+		read = readback.read(size, index);
+	}
+
+	if (read) {
+		Job job;
+		job.index = index;
+		job.repeats = repeats;
+		repeats = 0;
+		reading.emplace_back(job);
+	} else {
+		//(all ring slots are still being read or converted, so the workers are behind)
+		repeats += 1;
+		std::unique_lock< std::mutex > lock(mutex);
+		drops += 1;
+	}
+
+	std::vector< GLReadback::Frame > finished;
+	readback.poll(&finished);
+	if (!finished.empty()) queue(finished);
+}
+
+void FrameCapture::queue(std::vector< GLReadback::Frame > const &finished) {
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		for (GLReadback::Frame const &f : finished) {
+			//reads finish in order, so any earlier read still in 'reading' failed to map (and is dropped):
+			//(frames dropped before a lost read were counted when they were dropped, so only the lost read itself is a new drop)
+			uint32_t lost = 0;
+			uint32_t lost_reads = 0;
+			while (!reading.empty() && reading.front().index < f.tag) {
+				lost += reading.front().repeats + 1;
+				lost_reads += 1;
+				reading.erase(reading.begin());
+			}
+			if (reading.empty() || reading.front().index != f.tag) continue;
+			Job job = reading.front();
+			reading.erase(reading.begin());
+			job.frame = f;
+			job.order = queued++;
+			job.repeats += lost;
+			drops += lost_reads;
+			jobs.emplace_back(job);
+		}
+	}
+	work_cv.notify_all();
+}
+
+void FrameCapture::work(Job const &job, std::vector< uint8_t > *scratch) {
+	TRACE_SCOPE("FrameCapture::work");
+	glm::uvec2 size = job.frame.size;
+	glm::u8vec4 const *pixels = job.frame.pixels;
+	bool ok = true;
+
+	if (format == PNGSequence || format == QOISequence) {
+		//copy out (so the ring slot can be reused right away), forcing alpha to opaque:
+		std::vector< glm::u8vec4 > data(pixels, pixels + size.x * size.y);
+		readback.release(job.frame.slot);
+		image_fill_alpha(data.data(), data.size());
+		char number[32];
+		std::snprintf(number, sizeof(number), "%06llu", (unsigned long long)job.index);
+		//(the workers already encode frames in parallel, so each frame's stripes are encoded on one thread)
+		PNGSaveOptions options;
+		options.threads = 1;
+		try {
+			if (format == QOISequence) save_qoi(destination + number + ".qoi", size, data.data(), LowerLeftOrigin);
+			else save_png(destination + number + ".png", size, data.data(), LowerLeftOrigin, options);
+		} catch (std::exception const &) {
+			ok = false;
+		}
+	} else {
+		convert_yuv420(size, pixels, scratch);
+		readback.release(job.frame.slot);
+
+		//write in order (the previous frame again for each dropped frame first):
+		std::unique_lock< std::mutex > lock(mutex);
+		written_cv.wait(lock, [&]() { return next_write == job.order; });
+		lock.unlock();
+		for (uint32_t r = 0; r < job.repeats && !last_yuv.empty(); ++r) {
+			std::fputs("FRAME\n", y4m);
+			std::fwrite(last_yuv.data(), 1, last_yuv.size(), y4m);
+		}
+		std::fputs("FRAME\n", y4m);
+		ok = (std::fwrite(scratch->data(), 1, scratch->size(), y4m) == scratch->size());
+		if (job.repeats) last_yuv = *scratch;
+		else last_yuv.swap(*scratch);
+		lock.lock();
+		next_write += 1;
+		lock.unlock();
+		written_cv.notify_all();
+	}
+
+	double latency = std::chrono::duration< double, std::milli >(Clock::now() - job.frame.read_time).count();
+	std::unique_lock< std::mutex > lock(mutex);
+	captured += 1;
+	latency_total_ms += latency;
+	latency_max_ms = std::max(latency_max_ms, latency);
+	if (!ok && !write_failed) {
+		write_failed = true;
+		std::cerr << "WARNING: failed to write to capture stream '" << destination << "'." << std::endl;
+	}
+}
+
+void FrameCapture::report(std::ostream &out) {
+	std::unique_lock< std::mutex > lock(mutex);
+	out << "Capture: " << captured << " frames written to '" << destination << "', " << drops << " dropped";
+	if (captured) {
+		out << "; latency from read to written: mean " << (latency_total_ms / captured) << " ms, max " << latency_max_ms << " ms";
+	}
+	out << "." << std::endl;
+}
+
+std::string FrameCapture::y4m_header(glm::uvec2 const &size, uint32_t fps) {
+	//(C420jpeg: full-range BT.601 with centered chroma, as converted below)
+	return "YUV4MPEG2 W" + std::to_string(size.x & ~1u) + " H" + std::to_string(size.y & ~1u) + " F" + std::to_string(fps) + ":1 Ip A1:1 C420jpeg\n";
+}
+
+void FrameCapture::convert_yuv420(glm::uvec2 const &size, glm::u8vec4 const *pixels, std::vector< uint8_t > *yuv) {
+	//(odd sizes drop the last column and the top row)
+	glm::uvec2 even = glm::uvec2(size.x & ~1u, size.y & ~1u);
+	yuv->resize(even.x * even.y * 3 / 2);
+	uint8_t *Y = yuv->data();
+	uint8_t *Cb = Y + even.x * even.y;
+	uint8_t *Cr = Cb + (even.x / 2) * (even.y / 2);
+
+	//8-bit fixed point; flipped to put the top row first:
+	auto luma = [](glm::u8vec4 const &p) {
+		return uint8_t((77 * p.r + 150 * p.g + 29 * p.b + 128) >> 8);
+	};
+	for (uint32_t y = 0; y < even.y; y += 2) {
+		glm::u8vec4 const *row0 = pixels + (even.y - 1 - y) * size.x;
+		glm::u8vec4 const *row1 = row0 - size.x;
+		uint8_t *y0 = Y + y * even.x;
+		uint8_t *y1 = y0 + even.x;
+		uint8_t *cb = Cb + (y / 2) * (even.x / 2);
+		uint8_t *cr = Cr + (y / 2) * (even.x / 2);
+		for (uint32_t x = 0; x < even.x; x += 2) {
+			y0[x] = luma(row0[x]); y0[x+1] = luma(row0[x+1]);
+			y1[x] = luma(row1[x]); y1[x+1] = luma(row1[x+1]);
+			//chroma from the average of the 2x2 block:
+			int32_t r = row0[x].r + row0[x+1].r + row1[x].r + row1[x+1].r;
+			int32_t g = row0[x].g + row0[x+1].g + row1[x].g + row1[x+1].g;
+			int32_t b = row0[x].b + row0[x+1].b + row1[x].b + row1[x+1].b;
+			cb[x/2] = uint8_t(std::max(0, std::min(255, (128 * 1024 + (-43 * r - 85 * g + 128 * b) + 512) >> 10)));
+			cr[x/2] = uint8_t(std::max(0, std::min(255, (128 * 1024 + (128 * r - 107 * g - 21 * b) + 512) >> 10)));
+		}
+	}
+}
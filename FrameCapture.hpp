@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+ * FrameCapture records every frame, either as a numbered sequence of PNG
+ *  or QOI files (QOI is lossless too, and several times faster to encode;
+ *  convert to PNG afterward with qoi-to-png) or as an uncompressed YUV4MPEG2
+ *  (.y4m) stream, e.g. piped into a video encoder.
+ *
+ * Frames are read back through a ring of pixel buffer objects (see
+ *  GLReadback.hpp), so the render thread doesn't wait for them, and are
+ *  converted/encoded by a pool of worker threads. If the workers fall
+ *  behind, frames are dropped rather than stalling the game (a .y4m stream
+ *  repeats the previous frame in their place, so its timing stays right).
+ *
+ */
+
+#include "GLReadback.hpp"
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct FrameCapture {
+	enum Format {
+		PNGSequence, //'destination' is a prefix; frames go to <prefix>000000.png, <prefix>000001.png, ...
+		QOISequence, //...or to <prefix>000000.qoi, <prefix>000001.qoi, ...
+		Y4M, //'destination' is a file (or named pipe), or '|' followed by a command to pipe the stream to
+	};
+
+	//'fps' is only used for the .y4m header; throws std::runtime_error if the destination can't be opened:
+	FrameCapture(Format format, std::string const &destination, uint32_t fps = 60);
+	//(waits for captured frames to be written; call with the GL context still current)
+	~FrameCapture();
+	FrameCapture(FrameCapture const &) = delete;
+	FrameCapture &operator=(FrameCapture const &) = delete;
+
+	//call every frame after drawing and before presenting; reads 'size' pixels from 'framebuffer' (0 means the back buffer):
+	void frame(GLuint framebuffer, glm::uvec2 const &size);
+
+	//stop capturing and wait for every frame so far to be written (the destructor also does this):
+	void finish();
+
+	//print frames captured/dropped and how long they took to get written:
+	void report(std::ostream &out);
+
+	//.y4m helpers (also used to write frames that don't come from GL; see replay_render_main.cpp):
+	// header for an (even-sized) stream; each frame then follows as "FRAME\n" and the planes from convert_yuv420:
+	static std::string y4m_header(glm::uvec2 const &size, uint32_t fps);
+	// full-range BT.601 Y, Cb, Cr planes (4:2:0) of the even part of 'size' pixels (lower-left origin), top row first:
+	static void convert_yuv420(glm::uvec2 const &size, glm::u8vec4 const *pixels, std::vector< uint8_t > *yuv);
+
+private:
+	Format format;
+	std::string destination;
+	uint32_t fps;
+	FILE *y4m = nullptr;
+	bool y4m_is_pipe = false;
+	glm::uvec2 y4m_size = glm::uvec2(0); //(set by the first frame; .y4m streams can't change size)
+
+	GLReadback readback;
+	uint64_t frames = 0; //frames seen so far (captured or dropped)
+	uint64_t queued = 0; //frames handed to the workers so far
+
+	struct Job {
+		uint64_t index = 0; //frame number (counting dropped frames)
+		uint64_t order = 0; //queue position (the order .y4m frames are written in)
+		uint32_t repeats = 0; //dropped frames just before this one (the previous frame is written again for each)
+		GLReadback::Frame frame;
+	};
+	std::vector< Job > reading; //(reads in flight)
+	uint32_t repeats = 0; //frames dropped since the last read
+	void queue(std::vector< GLReadback::Frame > const &finished);
+	void work(Job const &job, std::vector< uint8_t > *scratch);
+
+	//worker state (all guarded by 'mutex'):
+	std::mutex mutex;
+	std::condition_variable work_cv; //signalled when there are jobs (or it's time to quit)
+	std::condition_variable written_cv; //signalled when next_write changes
+	std::deque< Job > jobs;
+	bool quit = false;
+	uint64_t next_write = 0; //(.y4m frames are written in order)
+	std::vector< uint8_t > last_yuv; //(only touched by the writer whose turn it is)
+	std::vector< std::thread > workers;
+
+	//stats (guarded by 'mutex'):
+	uint64_t captured = 0;
+	uint64_t drops = 0;
+	double latency_total_ms = 0.0;
+	double latency_max_ms = 0.0;
+	bool write_failed = false;
+};
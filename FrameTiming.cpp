@@ -0,0 +1,180 @@
+#include "FrameTiming.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+char const *FrameTiming::phase_name(Phase phase) {
+	switch (phase) {
+		case Events: return "events";
+		case Update: return "update";
+		case Draw: return "draw";
+		case Present: return "present";
+		case PhaseCount: return "frame";
+	}
+	return "?";
+}
+
+void FrameTiming::begin_frame() {
+	Clock::time_point now = Clock::now();
+	if (in_frame) {
+		current.total_ms = std::chrono::duration< float, std::milli >(now - frame_start).count();
+		ring[frames % Capacity] = current;
+		frames += 1;
+	}
+	current = Frame();
+	in_frame = true;
+	frame_start = now;
+	phase_start = now;
+}
+
+FrameTiming::Clock::time_point FrameTiming::stamp_time(uint32_t stamp, uint32_t ticks) {
+	Clock::time_point now = Clock::now();
+	if (stamp == 0 || stamp > ticks) return now;
+	return now - std::chrono::milliseconds(ticks - stamp);
+}
+
+char const *FrameTiming::gpu_pass_name(GPUPass pass) {
+	switch (pass) {
+		case GPUClear: return "clear";
+		case GPUUpload: return "upload";
+		case GPUDraw: return "draw";
+		case GPUPassCount: return "frame";
+	}
+	return "?";
+}
+
+void FrameTiming::set_gpu(uint64_t frame, float const (&ms)[GPUPassCount], float total_ms) {
+	//(not finished yet, or already pushed out of the ring)
+	if (frame >= frames || frames - frame > Capacity) return;
+	Frame &f = ring[frame % Capacity];
+	f.gpu_timed = true;
+	for (uint32_t p = 0; p < GPUPassCount; ++p) {
+		f.gpu_ms[p] = ms[p];
+	}
+	f.gpu_total_ms = total_ms;
+}
+
+void FrameTiming::present_inputs(Clock::time_point now) {
+	for (uint32_t i = 0; i < pending_inputs; ++i) {
+		float ms = std::max(0.0f, std::chrono::duration< float, std::milli >(now - input_times[i]).count());
+		latency_histogram[std::min(uint32_t(ms), LatencyBuckets - 1)] += 1;
+		inputs += 1;
+		latency_total_ms += ms;
+		latency_max_ms = std::max(latency_max_ms, ms);
+		current.input_ms = std::max(current.input_ms, ms);
+	}
+	current.inputs += pending_inputs;
+	pending_inputs = 0;
+}
+
+FrameTiming::Stats FrameTiming::latency_stats() const {
+	Stats ret;
+	if (inputs == 0) return ret;
+	auto percentile = [this](float p) {
+		uint64_t rank = std::max< uint64_t >(uint64_t(std::ceil(double(p) * inputs)), 1);
+		uint64_t seen = 0;
+		for (uint32_t b = 0; b < LatencyBuckets; ++b) {
+			seen += latency_histogram[b];
+			if (seen >= rank) return float(b + 1);
+		}
+		return float(LatencyBuckets);
+	};
+	ret.p50 = std::min(percentile(0.50f), latency_max_ms);
+	ret.p95 = std::min(percentile(0.95f), latency_max_ms);
+	ret.p99 = std::min(percentile(0.99f), latency_max_ms);
+	ret.max = latency_max_ms;
+	return ret;
+}
+
+//nearest-rank percentiles (so each is a time some frame actually took):
+static FrameTiming::Stats percentiles(std::vector< float > &ms) {
+	FrameTiming::Stats ret;
+	if (ms.empty()) return ret;
+	std::sort(ms.begin(), ms.end());
+	auto percentile = [&ms](float p) {
+		size_t rank = size_t(std::ceil(p * ms.size()));
+		return ms[std::max< size_t >(rank, 1) - 1];
+	};
+	ret.p50 = percentile(0.50f);
+	ret.p95 = percentile(0.95f);
+	ret.p99 = percentile(0.99f);
+	ret.max = ms.back();
+	return ret;
+}
+
+FrameTiming::Stats FrameTiming::stats(Phase phase) const {
+	std::vector< float > ms;
+	ms.reserve(frames_kept());
+	for (uint32_t back = 0; back < frames_kept(); ++back) {
+		Frame const &frame = recent(back);
+		ms.emplace_back(phase == PhaseCount ? frame.total_ms : frame.ms[phase]);
+	}
+	return percentiles(ms);
+}
+
+FrameTiming::Stats FrameTiming::gpu_stats(GPUPass pass) const {
+	std::vector< float > ms;
+	for (uint32_t back = 0; back < frames_kept(); ++back) {
+		Frame const &frame = recent(back);
+		if (!frame.gpu_timed) continue;
+		ms.emplace_back(pass == GPUPassCount ? frame.gpu_total_ms : frame.gpu_ms[pass]);
+	}
+	return percentiles(ms);
+}
+
+uint32_t FrameTiming::gpu_frames_kept() const {
+	uint32_t count = 0;
+	for (uint32_t back = 0; back < frames_kept(); ++back) {
+		if (recent(back).gpu_timed) count += 1;
+	}
+	return count;
+}
+
+void FrameTiming::report(std::ostream &out) const {
+	if (frames_kept() == 0) {
+		out << "Frame timing: no frames finished yet." << std::endl;
+		return;
+	}
+	out << "Frame timing over the last " << frames_kept() << " of " << frames << " frames (ms):\n";
+	char line[128];
+	std::snprintf(line, sizeof(line), "  %-8s %8s %8s %8s %8s\n", "", "p50", "p95", "p99", "max");
+	out << line;
+	for (uint32_t p = 0; p <= PhaseCount; ++p) {
+		Stats s = stats(Phase(p));
+		std::snprintf(line, sizeof(line), "  %-8s %8.3f %8.3f %8.3f %8.3f\n", phase_name(Phase(p)), s.p50, s.p95, s.p99, s.max);
+		out << line;
+	}
+
+	uint32_t gpu_frames = gpu_frames_kept();
+	if (gpu_frames != 0) {
+		out << "GPU time over the " << gpu_frames << " of those frames with timer query results (ms):\n";
+		for (uint32_t p = 0; p <= GPUPassCount; ++p) {
+			Stats s = gpu_stats(GPUPass(p));
+			std::snprintf(line, sizeof(line), "  %-8s %8.3f %8.3f %8.3f %8.3f\n", gpu_pass_name(GPUPass(p)), s.p50, s.p95, s.p99, s.max);
+			out << line;
+		}
+	}
+
+	if (inputs != 0) {
+		Stats s = latency_stats();
+		out << "Input to present latency over " << inputs << " inputs (ms), mean " << (latency_total_ms / inputs) << ":\n";
+		std::snprintf(line, sizeof(line), "  %-8s %8.3f %8.3f %8.3f %8.3f\n", "input", s.p50, s.p95, s.p99, s.max);
+		out << line;
+		//histogram, one line per non-empty bucket:
+		uint64_t most = *std::max_element(latency_histogram.begin(), latency_histogram.end());
+		for (uint32_t b = 0; b < LatencyBuckets; ++b) {
+			if (latency_histogram[b] == 0) continue;
+			std::string bar(size_t((latency_histogram[b] * 40 + most - 1) / most), '#');
+			if (b + 1 < LatencyBuckets) {
+				std::snprintf(line, sizeof(line), "  %3u-%-3u ms %8llu %s\n", b, b + 1, (unsigned long long)latency_histogram[b], bar.c_str());
+			} else {
+				std::snprintf(line, sizeof(line), "  %3u+    ms %8llu %s\n", b, (unsigned long long)latency_histogram[b], bar.c_str());
+			}
+			out << line;
+		}
+	}
+	out.flush();
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+/*
+ * FrameTiming times each phase of the main loop (events, update, draw,
+ *  present) every frame, keeping the last 'Capacity' frames in a fixed-size
+ *  ring, so it is cheap enough to leave on in every build (a clock read per
+ *  phase, no allocation).
+ *
+ * report() prints p50/p95/p99/max per phase over the frames in the ring
+ *  (main.cpp does so on exit with --frame-timing, or on F4), and modes can
+ *  draw recent frames as an overlay (see MultMode::draw; F3 toggles it).
+ *
+ * Frames can also carry GPU times for each pass of drawing; these arrive a
+ *  few frames late, from timer queries (see GLTimer.hpp), through set_gpu().
+ *
+ * Input-to-present latency is tracked too: each input is noted (with when it
+ *  happened) as it is handled, and when the present phase ends -- i.e. when
+ *  the frame that shows its effect has been handed to the display -- the
+ *  time since then goes into a histogram kept for the whole run.
+ *
+ */
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+
+struct FrameTiming {
+	enum Phase : uint32_t {
+		Events, //polling and handling input
+		Update, //Mode::update
+		Draw, //Mode::draw, and kicking off readbacks for screenshots and capture
+		Present, //swapping buffers (including any wait for vsync)
+		PhaseCount
+	};
+	static char const *phase_name(Phase phase);
+
+	//GPU work is timed in passes (and as a whole frame, from first pass to present):
+	enum GPUPass : uint32_t {
+		GPUClear,
+		GPUUpload, //vertex (and other) buffer uploads
+		GPUDraw,
+		GPUPassCount
+	};
+	static char const *gpu_pass_name(GPUPass pass);
+
+	static constexpr uint32_t Capacity = 1024; //frames kept (about 17 seconds at 60 frames/second)
+
+	typedef std::chrono::high_resolution_clock Clock;
+
+	//call at the start of each frame (this also finishes the previous one):
+	void begin_frame();
+	//call as each phase ends (a phase runs from the end of the one before it, or from begin_frame):
+	void end_phase(Phase phase) {
+		Clock::time_point now = Clock::now();
+		current.ms[phase] = std::chrono::duration< float, std::milli >(now - phase_start).count();
+		phase_start = now;
+		if (phase == Present && pending_inputs != 0) present_inputs(now);
+	}
+
+	//note an input handled this frame, which happened at 'when':
+	void input(Clock::time_point when) {
+		if (pending_inputs < MaxPendingInputs) input_times[pending_inputs++] = when;
+	}
+
+	//when an event stamped 'stamp' happened, given that the stamps' clock (ms, like SDL's event timestamps) now reads 'ticks':
+	// (a zero stamp, or one from the future, is taken to mean now)
+	static Clock::time_point stamp_time(uint32_t stamp, uint32_t ticks);
+
+	struct Frame {
+		float ms[PhaseCount] = { }; //(phases that didn't run this frame stay zero)
+		float total_ms = 0.0f; //start of this frame to start of the next (so it includes any untimed work)
+		uint32_t inputs = 0; //inputs this frame presented...
+		float input_ms = 0.0f; //...and the longest any of them took to get here (from when it happened to the end of present)
+		bool gpu_timed = false; //(the rest are only set if this is)
+		float gpu_ms[GPUPassCount] = { };
+		float gpu_total_ms = 0.0f;
+	};
+
+	//fill in GPU times for frame number 'frame' (counting from zero, as 'frames' does), if it is still in the ring:
+	void set_gpu(uint64_t frame, float const (&ms)[GPUPassCount], float total_ms);
+
+	//finished frames: 'frames' in all, the last frames_kept() of them in the ring:
+	uint64_t frames = 0;
+	uint32_t frames_kept() const { return uint32_t(frames < Capacity ? frames : Capacity); }
+	//'back' frames before the most recent finished one (0 is the most recent):
+	Frame const &recent(uint32_t back) const { return ring[(frames - 1 - back) % Capacity]; }
+
+	struct Stats {
+		float p50 = 0.0f, p95 = 0.0f, p99 = 0.0f, max = 0.0f;
+	};
+	//percentiles over the frames in the ring of one phase, or (with PhaseCount) of the whole frame:
+	Stats stats(Phase phase) const;
+	//...and of GPU passes (with GPUPassCount, the whole frame), over just the frames that have GPU times:
+	Stats gpu_stats(GPUPass pass) const;
+	uint32_t gpu_frames_kept() const;
+
+	//input-to-present latency over the whole run, in 1 ms buckets (the last also counts anything longer):
+	static constexpr uint32_t LatencyBuckets = 250;
+	std::array< uint64_t, LatencyBuckets > latency_histogram = { };
+	uint64_t inputs = 0;
+	double latency_total_ms = 0.0;
+	float latency_max_ms = 0.0f;
+	//percentiles from the histogram (to the 1 ms bucket, rounded up), and the exact max:
+	Stats latency_stats() const;
+
+	//print a table of stats for each phase and the whole frame (and GPU passes, if any frames have them),
+	// then input-to-present latency (if there has been any input) with its histogram:
+	void report(std::ostream &out) const;
+
+	//should modes draw the overlay?
+	bool overlay = false;
+
+private:
+	std::array< Frame, Capacity > ring;
+	Frame current;
+	bool in_frame = false;
+	Clock::time_point frame_start;
+	Clock::time_point phase_start;
+
+	static constexpr uint32_t MaxPendingInputs = 256; //(more inputs than this in a frame aren't timed)
+	std::array< Clock::time_point, MaxPendingInputs > input_times;
+	uint32_t pending_inputs = 0;
+	void present_inputs(Clock::time_point now);
+};
@@ -1,6 +1,7 @@
 #include "GL.hpp"
 
 #include <SDL.h>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -14,7 +15,10 @@
 	#define DO(fn)
 #endif
 
-void init_GL() {
+GLLoaderStats gl_loader_stats;
+
+#ifndef __linux__
+void init_GL(GLLoaderBackend) {
 	DO(glDrawRangeElements)
 	DO(glTexImage3D)
 	DO(glTexSubImage3D)
@@ -299,6 +303,11 @@ void init_GL() {
 	DO(glVertexAttribP4ui)
 	DO(glVertexAttribP4uiv)
 }
+
+void *gl_get_proc_address(char const *name) {
+	return SDL_GL_GetProcAddress(name);
+}
+#endif
 #ifdef _WIN32
 	 void (APIENTRYFP glDrawRangeElements) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
 	 void (APIENTRYFP glTexImage3D) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
@@ -584,3 +593,3068 @@ void init_GL() {
 	 void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value);
 	 void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 #endif
+
+#ifdef __linux__
+//------------ runtime loader ------------
+
+#include <dlfcn.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+typedef void *(*GLLoaderGetProcAddress)(char const *name);
+static GLLoaderGetProcAddress gl_loader_get_proc_address = nullptr;
+
+//look up 'name' through the current backend (throws if it can't be found):
+static void *gl_loader_resolve(char const *name) {
+	if (!gl_loader_get_proc_address) {
+		throw std::runtime_error(std::string("Called ") + name + " before init_GL().");
+	}
+	auto before = std::chrono::steady_clock::now();
+	void *ret = gl_loader_get_proc_address(name);
+	gl_loader_stats.resolve_ms += std::chrono::duration< double, std::milli >(std::chrono::steady_clock::now() - before).count();
+	if (!ret) {
+		throw std::runtime_error(std::string("Error binding ") + name);
+	}
+	gl_loader_stats.resolved += 1;
+	return ret;
+}
+
+void *gl_get_proc_address(char const *name) {
+	if (!gl_loader_get_proc_address) return nullptr;
+	return gl_loader_get_proc_address(name);
+}
+
+//every pointer starts out pointing at a stub that looks up the real function, then calls it:
+// (the '(*fn)' spelling keeps the call from being caught by the call layer's macros)
+static void APIENTRY gl_lazy_glCullFace(GLenum mode) {
+	glCullFace = (decltype(glCullFace))gl_loader_resolve("glCullFace");
+	return (*glCullFace)(mode);
+}
+static void APIENTRY gl_lazy_glFrontFace(GLenum mode) {
+	glFrontFace = (decltype(glFrontFace))gl_loader_resolve("glFrontFace");
+	return (*glFrontFace)(mode);
+}
+static void APIENTRY gl_lazy_glHint(GLenum target, GLenum mode) {
+	glHint = (decltype(glHint))gl_loader_resolve("glHint");
+	return (*glHint)(target, mode);
+}
+static void APIENTRY gl_lazy_glLineWidth(GLfloat width) {
+	glLineWidth = (decltype(glLineWidth))gl_loader_resolve("glLineWidth");
+	return (*glLineWidth)(width);
+}
+static void APIENTRY gl_lazy_glPointSize(GLfloat size) {
+	glPointSize = (decltype(glPointSize))gl_loader_resolve("glPointSize");
+	return (*glPointSize)(size);
+}
+static void APIENTRY gl_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glPolygonMode = (decltype(glPolygonMode))gl_loader_resolve("glPolygonMode");
+	return (*glPolygonMode)(face, mode);
+}
+static void APIENTRY gl_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glScissor = (decltype(glScissor))gl_loader_resolve("glScissor");
+	return (*glScissor)(x, y, width, height);
+}
+static void APIENTRY gl_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glTexParameterf = (decltype(glTexParameterf))gl_loader_resolve("glTexParameterf");
+	return (*glTexParameterf)(target, pname, param);
+}
+static void APIENTRY gl_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+	glTexParameterfv = (decltype(glTexParameterfv))gl_loader_resolve("glTexParameterfv");
+	return (*glTexParameterfv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glTexParameteri = (decltype(glTexParameteri))gl_loader_resolve("glTexParameteri");
+	return (*glTexParameteri)(target, pname, param);
+}
+static void APIENTRY gl_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+	glTexParameteriv = (decltype(glTexParameteriv))gl_loader_resolve("glTexParameteriv");
+	return (*glTexParameteriv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+	glTexImage1D = (decltype(glTexImage1D))gl_loader_resolve("glTexImage1D");
+	return (*glTexImage1D)(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+	glTexImage2D = (decltype(glTexImage2D))gl_loader_resolve("glTexImage2D");
+	return (*glTexImage2D)(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glDrawBuffer(GLenum buf) {
+	glDrawBuffer = (decltype(glDrawBuffer))gl_loader_resolve("glDrawBuffer");
+	return (*glDrawBuffer)(buf);
+}
+static void APIENTRY gl_lazy_glClear(GLbitfield mask) {
+	glClear = (decltype(glClear))gl_loader_resolve("glClear");
+	return (*glClear)(mask);
+}
+static void APIENTRY gl_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glClearColor = (decltype(glClearColor))gl_loader_resolve("glClearColor");
+	return (*glClearColor)(red, green, blue, alpha);
+}
+static void APIENTRY gl_lazy_glClearStencil(GLint s) {
+	glClearStencil = (decltype(glClearStencil))gl_loader_resolve("glClearStencil");
+	return (*glClearStencil)(s);
+}
+static void APIENTRY gl_lazy_glClearDepth(GLdouble depth) {
+	glClearDepth = (decltype(glClearDepth))gl_loader_resolve("glClearDepth");
+	return (*glClearDepth)(depth);
+}
+static void APIENTRY gl_lazy_glStencilMask(GLuint mask) {
+	glStencilMask = (decltype(glStencilMask))gl_loader_resolve("glStencilMask");
+	return (*glStencilMask)(mask);
+}
+static void APIENTRY gl_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glColorMask = (decltype(glColorMask))gl_loader_resolve("glColorMask");
+	return (*glColorMask)(red, green, blue, alpha);
+}
+static void APIENTRY gl_lazy_glDepthMask(GLboolean flag) {
+	glDepthMask = (decltype(glDepthMask))gl_loader_resolve("glDepthMask");
+	return (*glDepthMask)(flag);
+}
+static void APIENTRY gl_lazy_glDisable(GLenum cap) {
+	glDisable = (decltype(glDisable))gl_loader_resolve("glDisable");
+	return (*glDisable)(cap);
+}
+static void APIENTRY gl_lazy_glEnable(GLenum cap) {
+	glEnable = (decltype(glEnable))gl_loader_resolve("glEnable");
+	return (*glEnable)(cap);
+}
+static void APIENTRY gl_lazy_glFinish() {
+	glFinish = (decltype(glFinish))gl_loader_resolve("glFinish");
+	return (*glFinish)();
+}
+static void APIENTRY gl_lazy_glFlush() {
+	glFlush = (decltype(glFlush))gl_loader_resolve("glFlush");
+	return (*glFlush)();
+}
+static void APIENTRY gl_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glBlendFunc = (decltype(glBlendFunc))gl_loader_resolve("glBlendFunc");
+	return (*glBlendFunc)(sfactor, dfactor);
+}
+static void APIENTRY gl_lazy_glLogicOp(GLenum opcode) {
+	glLogicOp = (decltype(glLogicOp))gl_loader_resolve("glLogicOp");
+	return (*glLogicOp)(opcode);
+}
+static void APIENTRY gl_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glStencilFunc = (decltype(glStencilFunc))gl_loader_resolve("glStencilFunc");
+	return (*glStencilFunc)(func, ref, mask);
+}
+static void APIENTRY gl_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glStencilOp = (decltype(glStencilOp))gl_loader_resolve("glStencilOp");
+	return (*glStencilOp)(fail, zfail, zpass);
+}
+static void APIENTRY gl_lazy_glDepthFunc(GLenum func) {
+	glDepthFunc = (decltype(glDepthFunc))gl_loader_resolve("glDepthFunc");
+	return (*glDepthFunc)(func);
+}
+static void APIENTRY gl_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glPixelStoref = (decltype(glPixelStoref))gl_loader_resolve("glPixelStoref");
+	return (*glPixelStoref)(pname, param);
+}
+static void APIENTRY gl_lazy_glPixelStorei(GLenum pname, GLint param) {
+	glPixelStorei = (decltype(glPixelStorei))gl_loader_resolve("glPixelStorei");
+	return (*glPixelStorei)(pname, param);
+}
+static void APIENTRY gl_lazy_glReadBuffer(GLenum src) {
+	glReadBuffer = (decltype(glReadBuffer))gl_loader_resolve("glReadBuffer");
+	return (*glReadBuffer)(src);
+}
+static void APIENTRY gl_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+	glReadPixels = (decltype(glReadPixels))gl_loader_resolve("glReadPixels");
+	return (*glReadPixels)(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glGetBooleanv(GLenum pname, GLboolean * data) {
+	glGetBooleanv = (decltype(glGetBooleanv))gl_loader_resolve("glGetBooleanv");
+	return (*glGetBooleanv)(pname, data);
+}
+static void APIENTRY gl_lazy_glGetDoublev(GLenum pname, GLdouble * data) {
+	glGetDoublev = (decltype(glGetDoublev))gl_loader_resolve("glGetDoublev");
+	return (*glGetDoublev)(pname, data);
+}
+static GLenum APIENTRY gl_lazy_glGetError() {
+	glGetError = (decltype(glGetError))gl_loader_resolve("glGetError");
+	return (*glGetError)();
+}
+static void APIENTRY gl_lazy_glGetFloatv(GLenum pname, GLfloat * data) {
+	glGetFloatv = (decltype(glGetFloatv))gl_loader_resolve("glGetFloatv");
+	return (*glGetFloatv)(pname, data);
+}
+static void APIENTRY gl_lazy_glGetIntegerv(GLenum pname, GLint * data) {
+	glGetIntegerv = (decltype(glGetIntegerv))gl_loader_resolve("glGetIntegerv");
+	return (*glGetIntegerv)(pname, data);
+}
+static const GLubyte * APIENTRY gl_lazy_glGetString(GLenum name) {
+	glGetString = (decltype(glGetString))gl_loader_resolve("glGetString");
+	return (*glGetString)(name);
+}
+static void APIENTRY gl_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+	glGetTexImage = (decltype(glGetTexImage))gl_loader_resolve("glGetTexImage");
+	return (*glGetTexImage)(target, level, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+	glGetTexParameterfv = (decltype(glGetTexParameterfv))gl_loader_resolve("glGetTexParameterfv");
+	return (*glGetTexParameterfv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+	glGetTexParameteriv = (decltype(glGetTexParameteriv))gl_loader_resolve("glGetTexParameteriv");
+	return (*glGetTexParameteriv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+	glGetTexLevelParameterfv = (decltype(glGetTexLevelParameterfv))gl_loader_resolve("glGetTexLevelParameterfv");
+	return (*glGetTexLevelParameterfv)(target, level, pname, params);
+}
+static void APIENTRY gl_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+	glGetTexLevelParameteriv = (decltype(glGetTexLevelParameteriv))gl_loader_resolve("glGetTexLevelParameteriv");
+	return (*glGetTexLevelParameteriv)(target, level, pname, params);
+}
+static GLboolean APIENTRY gl_lazy_glIsEnabled(GLenum cap) {
+	glIsEnabled = (decltype(glIsEnabled))gl_loader_resolve("glIsEnabled");
+	return (*glIsEnabled)(cap);
+}
+static void APIENTRY gl_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glDepthRange = (decltype(glDepthRange))gl_loader_resolve("glDepthRange");
+	return (*glDepthRange)(n, f);
+}
+static void APIENTRY gl_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glViewport = (decltype(glViewport))gl_loader_resolve("glViewport");
+	return (*glViewport)(x, y, width, height);
+}
+static void APIENTRY gl_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glDrawArrays = (decltype(glDrawArrays))gl_loader_resolve("glDrawArrays");
+	return (*glDrawArrays)(mode, first, count);
+}
+static void APIENTRY gl_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+	glDrawElements = (decltype(glDrawElements))gl_loader_resolve("glDrawElements");
+	return (*glDrawElements)(mode, count, type, indices);
+}
+static void APIENTRY gl_lazy_glGetPointerv(GLenum pname, void ** params) {
+	glGetPointerv = (decltype(glGetPointerv))gl_loader_resolve("glGetPointerv");
+	return (*glGetPointerv)(pname, params);
+}
+static void APIENTRY gl_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glPolygonOffset = (decltype(glPolygonOffset))gl_loader_resolve("glPolygonOffset");
+	return (*glPolygonOffset)(factor, units);
+}
+static void APIENTRY gl_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glCopyTexImage1D = (decltype(glCopyTexImage1D))gl_loader_resolve("glCopyTexImage1D");
+	return (*glCopyTexImage1D)(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY gl_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glCopyTexImage2D = (decltype(glCopyTexImage2D))gl_loader_resolve("glCopyTexImage2D");
+	return (*glCopyTexImage2D)(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY gl_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glCopyTexSubImage1D = (decltype(glCopyTexSubImage1D))gl_loader_resolve("glCopyTexSubImage1D");
+	return (*glCopyTexSubImage1D)(target, level, xoffset, x, y, width);
+}
+static void APIENTRY gl_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glCopyTexSubImage2D = (decltype(glCopyTexSubImage2D))gl_loader_resolve("glCopyTexSubImage2D");
+	return (*glCopyTexSubImage2D)(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY gl_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+	glTexSubImage1D = (decltype(glTexSubImage1D))gl_loader_resolve("glTexSubImage1D");
+	return (*glTexSubImage1D)(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+	glTexSubImage2D = (decltype(glTexSubImage2D))gl_loader_resolve("glTexSubImage2D");
+	return (*glTexSubImage2D)(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glBindTexture(GLenum target, GLuint texture) {
+	glBindTexture = (decltype(glBindTexture))gl_loader_resolve("glBindTexture");
+	return (*glBindTexture)(target, texture);
+}
+static void APIENTRY gl_lazy_glDeleteTextures(GLsizei n, const GLuint * textures) {
+	glDeleteTextures = (decltype(glDeleteTextures))gl_loader_resolve("glDeleteTextures");
+	return (*glDeleteTextures)(n, textures);
+}
+static void APIENTRY gl_lazy_glGenTextures(GLsizei n, GLuint * textures) {
+	glGenTextures = (decltype(glGenTextures))gl_loader_resolve("glGenTextures");
+	return (*glGenTextures)(n, textures);
+}
+static GLboolean APIENTRY gl_lazy_glIsTexture(GLuint texture) {
+	glIsTexture = (decltype(glIsTexture))gl_loader_resolve("glIsTexture");
+	return (*glIsTexture)(texture);
+}
+static void APIENTRY gl_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+	glDrawRangeElements = (decltype(glDrawRangeElements))gl_loader_resolve("glDrawRangeElements");
+	return (*glDrawRangeElements)(mode, start, end, count, type, indices);
+}
+static void APIENTRY gl_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+	glTexImage3D = (decltype(glTexImage3D))gl_loader_resolve("glTexImage3D");
+	return (*glTexImage3D)(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+	glTexSubImage3D = (decltype(glTexSubImage3D))gl_loader_resolve("glTexSubImage3D");
+	return (*glTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY gl_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glCopyTexSubImage3D = (decltype(glCopyTexSubImage3D))gl_loader_resolve("glCopyTexSubImage3D");
+	return (*glCopyTexSubImage3D)(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY gl_lazy_glActiveTexture(GLenum texture) {
+	glActiveTexture = (decltype(glActiveTexture))gl_loader_resolve("glActiveTexture");
+	return (*glActiveTexture)(texture);
+}
+static void APIENTRY gl_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glSampleCoverage = (decltype(glSampleCoverage))gl_loader_resolve("glSampleCoverage");
+	return (*glSampleCoverage)(value, invert);
+}
+static void APIENTRY gl_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+	glCompressedTexImage3D = (decltype(glCompressedTexImage3D))gl_loader_resolve("glCompressedTexImage3D");
+	return (*glCompressedTexImage3D)(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY gl_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+	glCompressedTexImage2D = (decltype(glCompressedTexImage2D))gl_loader_resolve("glCompressedTexImage2D");
+	return (*glCompressedTexImage2D)(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY gl_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+	glCompressedTexImage1D = (decltype(glCompressedTexImage1D))gl_loader_resolve("glCompressedTexImage1D");
+	return (*glCompressedTexImage1D)(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY gl_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+	glCompressedTexSubImage3D = (decltype(glCompressedTexSubImage3D))gl_loader_resolve("glCompressedTexSubImage3D");
+	return (*glCompressedTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY gl_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+	glCompressedTexSubImage2D = (decltype(glCompressedTexSubImage2D))gl_loader_resolve("glCompressedTexSubImage2D");
+	return (*glCompressedTexSubImage2D)(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY gl_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+	glCompressedTexSubImage1D = (decltype(glCompressedTexSubImage1D))gl_loader_resolve("glCompressedTexSubImage1D");
+	return (*glCompressedTexSubImage1D)(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY gl_lazy_glGetCompressedTexImage(GLenum target, GLint level, void * img) {
+	glGetCompressedTexImage = (decltype(glGetCompressedTexImage))gl_loader_resolve("glGetCompressedTexImage");
+	return (*glGetCompressedTexImage)(target, level, img);
+}
+static void APIENTRY gl_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glBlendFuncSeparate = (decltype(glBlendFuncSeparate))gl_loader_resolve("glBlendFuncSeparate");
+	return (*glBlendFuncSeparate)(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY gl_lazy_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+	glMultiDrawArrays = (decltype(glMultiDrawArrays))gl_loader_resolve("glMultiDrawArrays");
+	return (*glMultiDrawArrays)(mode, first, count, drawcount);
+}
+static void APIENTRY gl_lazy_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) {
+	glMultiDrawElements = (decltype(glMultiDrawElements))gl_loader_resolve("glMultiDrawElements");
+	return (*glMultiDrawElements)(mode, count, type, indices, drawcount);
+}
+static void APIENTRY gl_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glPointParameterf = (decltype(glPointParameterf))gl_loader_resolve("glPointParameterf");
+	return (*glPointParameterf)(pname, param);
+}
+static void APIENTRY gl_lazy_glPointParameterfv(GLenum pname, const GLfloat * params) {
+	glPointParameterfv = (decltype(glPointParameterfv))gl_loader_resolve("glPointParameterfv");
+	return (*glPointParameterfv)(pname, params);
+}
+static void APIENTRY gl_lazy_glPointParameteri(GLenum pname, GLint param) {
+	glPointParameteri = (decltype(glPointParameteri))gl_loader_resolve("glPointParameteri");
+	return (*glPointParameteri)(pname, param);
+}
+static void APIENTRY gl_lazy_glPointParameteriv(GLenum pname, const GLint * params) {
+	glPointParameteriv = (decltype(glPointParameteriv))gl_loader_resolve("glPointParameteriv");
+	return (*glPointParameteriv)(pname, params);
+}
+static void APIENTRY gl_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glBlendColor = (decltype(glBlendColor))gl_loader_resolve("glBlendColor");
+	return (*glBlendColor)(red, green, blue, alpha);
+}
+static void APIENTRY gl_lazy_glBlendEquation(GLenum mode) {
+	glBlendEquation = (decltype(glBlendEquation))gl_loader_resolve("glBlendEquation");
+	return (*glBlendEquation)(mode);
+}
+static void APIENTRY gl_lazy_glGenQueries(GLsizei n, GLuint * ids) {
+	glGenQueries = (decltype(glGenQueries))gl_loader_resolve("glGenQueries");
+	return (*glGenQueries)(n, ids);
+}
+static void APIENTRY gl_lazy_glDeleteQueries(GLsizei n, const GLuint * ids) {
+	glDeleteQueries = (decltype(glDeleteQueries))gl_loader_resolve("glDeleteQueries");
+	return (*glDeleteQueries)(n, ids);
+}
+static GLboolean APIENTRY gl_lazy_glIsQuery(GLuint id) {
+	glIsQuery = (decltype(glIsQuery))gl_loader_resolve("glIsQuery");
+	return (*glIsQuery)(id);
+}
+static void APIENTRY gl_lazy_glBeginQuery(GLenum target, GLuint id) {
+	glBeginQuery = (decltype(glBeginQuery))gl_loader_resolve("glBeginQuery");
+	return (*glBeginQuery)(target, id);
+}
+static void APIENTRY gl_lazy_glEndQuery(GLenum target) {
+	glEndQuery = (decltype(glEndQuery))gl_loader_resolve("glEndQuery");
+	return (*glEndQuery)(target);
+}
+static void APIENTRY gl_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint * params) {
+	glGetQueryiv = (decltype(glGetQueryiv))gl_loader_resolve("glGetQueryiv");
+	return (*glGetQueryiv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+	glGetQueryObjectiv = (decltype(glGetQueryObjectiv))gl_loader_resolve("glGetQueryObjectiv");
+	return (*glGetQueryObjectiv)(id, pname, params);
+}
+static void APIENTRY gl_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+	glGetQueryObjectuiv = (decltype(glGetQueryObjectuiv))gl_loader_resolve("glGetQueryObjectuiv");
+	return (*glGetQueryObjectuiv)(id, pname, params);
+}
+static void APIENTRY gl_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glBindBuffer = (decltype(glBindBuffer))gl_loader_resolve("glBindBuffer");
+	return (*glBindBuffer)(target, buffer);
+}
+static void APIENTRY gl_lazy_glDeleteBuffers(GLsizei n, const GLuint * buffers) {
+	glDeleteBuffers = (decltype(glDeleteBuffers))gl_loader_resolve("glDeleteBuffers");
+	return (*glDeleteBuffers)(n, buffers);
+}
+static void APIENTRY gl_lazy_glGenBuffers(GLsizei n, GLuint * buffers) {
+	glGenBuffers = (decltype(glGenBuffers))gl_loader_resolve("glGenBuffers");
+	return (*glGenBuffers)(n, buffers);
+}
+static GLboolean APIENTRY gl_lazy_glIsBuffer(GLuint buffer) {
+	glIsBuffer = (decltype(glIsBuffer))gl_loader_resolve("glIsBuffer");
+	return (*glIsBuffer)(buffer);
+}
+static void APIENTRY gl_lazy_glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+	glBufferData = (decltype(glBufferData))gl_loader_resolve("glBufferData");
+	return (*glBufferData)(target, size, data, usage);
+}
+static void APIENTRY gl_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+	glBufferSubData = (decltype(glBufferSubData))gl_loader_resolve("glBufferSubData");
+	return (*glBufferSubData)(target, offset, size, data);
+}
+static void APIENTRY gl_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+	glGetBufferSubData = (decltype(glGetBufferSubData))gl_loader_resolve("glGetBufferSubData");
+	return (*glGetBufferSubData)(target, offset, size, data);
+}
+static void * APIENTRY gl_lazy_glMapBuffer(GLenum target, GLenum access) {
+	glMapBuffer = (decltype(glMapBuffer))gl_loader_resolve("glMapBuffer");
+	return (*glMapBuffer)(target, access);
+}
+static GLboolean APIENTRY gl_lazy_glUnmapBuffer(GLenum target) {
+	glUnmapBuffer = (decltype(glUnmapBuffer))gl_loader_resolve("glUnmapBuffer");
+	return (*glUnmapBuffer)(target);
+}
+static void APIENTRY gl_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+	glGetBufferParameteriv = (decltype(glGetBufferParameteriv))gl_loader_resolve("glGetBufferParameteriv");
+	return (*glGetBufferParameteriv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+	glGetBufferPointerv = (decltype(glGetBufferPointerv))gl_loader_resolve("glGetBufferPointerv");
+	return (*glGetBufferPointerv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glBlendEquationSeparate = (decltype(glBlendEquationSeparate))gl_loader_resolve("glBlendEquationSeparate");
+	return (*glBlendEquationSeparate)(modeRGB, modeAlpha);
+}
+static void APIENTRY gl_lazy_glDrawBuffers(GLsizei n, const GLenum * bufs) {
+	glDrawBuffers = (decltype(glDrawBuffers))gl_loader_resolve("glDrawBuffers");
+	return (*glDrawBuffers)(n, bufs);
+}
+static void APIENTRY gl_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glStencilOpSeparate = (decltype(glStencilOpSeparate))gl_loader_resolve("glStencilOpSeparate");
+	return (*glStencilOpSeparate)(face, sfail, dpfail, dppass);
+}
+static void APIENTRY gl_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glStencilFuncSeparate = (decltype(glStencilFuncSeparate))gl_loader_resolve("glStencilFuncSeparate");
+	return (*glStencilFuncSeparate)(face, func, ref, mask);
+}
+static void APIENTRY gl_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glStencilMaskSeparate = (decltype(glStencilMaskSeparate))gl_loader_resolve("glStencilMaskSeparate");
+	return (*glStencilMaskSeparate)(face, mask);
+}
+static void APIENTRY gl_lazy_glAttachShader(GLuint program, GLuint shader) {
+	glAttachShader = (decltype(glAttachShader))gl_loader_resolve("glAttachShader");
+	return (*glAttachShader)(program, shader);
+}
+static void APIENTRY gl_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+	glBindAttribLocation = (decltype(glBindAttribLocation))gl_loader_resolve("glBindAttribLocation");
+	return (*glBindAttribLocation)(program, index, name);
+}
+static void APIENTRY gl_lazy_glCompileShader(GLuint shader) {
+	glCompileShader = (decltype(glCompileShader))gl_loader_resolve("glCompileShader");
+	return (*glCompileShader)(shader);
+}
+static GLuint APIENTRY gl_lazy_glCreateProgram() {
+	glCreateProgram = (decltype(glCreateProgram))gl_loader_resolve("glCreateProgram");
+	return (*glCreateProgram)();
+}
+static GLuint APIENTRY gl_lazy_glCreateShader(GLenum type) {
+	glCreateShader = (decltype(glCreateShader))gl_loader_resolve("glCreateShader");
+	return (*glCreateShader)(type);
+}
+static void APIENTRY gl_lazy_glDeleteProgram(GLuint program) {
+	glDeleteProgram = (decltype(glDeleteProgram))gl_loader_resolve("glDeleteProgram");
+	return (*glDeleteProgram)(program);
+}
+static void APIENTRY gl_lazy_glDeleteShader(GLuint shader) {
+	glDeleteShader = (decltype(glDeleteShader))gl_loader_resolve("glDeleteShader");
+	return (*glDeleteShader)(shader);
+}
+static void APIENTRY gl_lazy_glDetachShader(GLuint program, GLuint shader) {
+	glDetachShader = (decltype(glDetachShader))gl_loader_resolve("glDetachShader");
+	return (*glDetachShader)(program, shader);
+}
+static void APIENTRY gl_lazy_glDisableVertexAttribArray(GLuint index) {
+	glDisableVertexAttribArray = (decltype(glDisableVertexAttribArray))gl_loader_resolve("glDisableVertexAttribArray");
+	return (*glDisableVertexAttribArray)(index);
+}
+static void APIENTRY gl_lazy_glEnableVertexAttribArray(GLuint index) {
+	glEnableVertexAttribArray = (decltype(glEnableVertexAttribArray))gl_loader_resolve("glEnableVertexAttribArray");
+	return (*glEnableVertexAttribArray)(index);
+}
+static void APIENTRY gl_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+	glGetActiveAttrib = (decltype(glGetActiveAttrib))gl_loader_resolve("glGetActiveAttrib");
+	return (*glGetActiveAttrib)(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY gl_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+	glGetActiveUniform = (decltype(glGetActiveUniform))gl_loader_resolve("glGetActiveUniform");
+	return (*glGetActiveUniform)(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY gl_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+	glGetAttachedShaders = (decltype(glGetAttachedShaders))gl_loader_resolve("glGetAttachedShaders");
+	return (*glGetAttachedShaders)(program, maxCount, count, shaders);
+}
+static GLint APIENTRY gl_lazy_glGetAttribLocation(GLuint program, const GLchar * name) {
+	glGetAttribLocation = (decltype(glGetAttribLocation))gl_loader_resolve("glGetAttribLocation");
+	return (*glGetAttribLocation)(program, name);
+}
+static void APIENTRY gl_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint * params) {
+	glGetProgramiv = (decltype(glGetProgramiv))gl_loader_resolve("glGetProgramiv");
+	return (*glGetProgramiv)(program, pname, params);
+}
+static void APIENTRY gl_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+	glGetProgramInfoLog = (decltype(glGetProgramInfoLog))gl_loader_resolve("glGetProgramInfoLog");
+	return (*glGetProgramInfoLog)(program, bufSize, length, infoLog);
+}
+static void APIENTRY gl_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+	glGetShaderiv = (decltype(glGetShaderiv))gl_loader_resolve("glGetShaderiv");
+	return (*glGetShaderiv)(shader, pname, params);
+}
+static void APIENTRY gl_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+	glGetShaderInfoLog = (decltype(glGetShaderInfoLog))gl_loader_resolve("glGetShaderInfoLog");
+	return (*glGetShaderInfoLog)(shader, bufSize, length, infoLog);
+}
+static void APIENTRY gl_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+	glGetShaderSource = (decltype(glGetShaderSource))gl_loader_resolve("glGetShaderSource");
+	return (*glGetShaderSource)(shader, bufSize, length, source);
+}
+static GLint APIENTRY gl_lazy_glGetUniformLocation(GLuint program, const GLchar * name) {
+	glGetUniformLocation = (decltype(glGetUniformLocation))gl_loader_resolve("glGetUniformLocation");
+	return (*glGetUniformLocation)(program, name);
+}
+static void APIENTRY gl_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat * params) {
+	glGetUniformfv = (decltype(glGetUniformfv))gl_loader_resolve("glGetUniformfv");
+	return (*glGetUniformfv)(program, location, params);
+}
+static void APIENTRY gl_lazy_glGetUniformiv(GLuint program, GLint location, GLint * params) {
+	glGetUniformiv = (decltype(glGetUniformiv))gl_loader_resolve("glGetUniformiv");
+	return (*glGetUniformiv)(program, location, params);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+	glGetVertexAttribdv = (decltype(glGetVertexAttribdv))gl_loader_resolve("glGetVertexAttribdv");
+	return (*glGetVertexAttribdv)(index, pname, params);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+	glGetVertexAttribfv = (decltype(glGetVertexAttribfv))gl_loader_resolve("glGetVertexAttribfv");
+	return (*glGetVertexAttribfv)(index, pname, params);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+	glGetVertexAttribiv = (decltype(glGetVertexAttribiv))gl_loader_resolve("glGetVertexAttribiv");
+	return (*glGetVertexAttribiv)(index, pname, params);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+	glGetVertexAttribPointerv = (decltype(glGetVertexAttribPointerv))gl_loader_resolve("glGetVertexAttribPointerv");
+	return (*glGetVertexAttribPointerv)(index, pname, pointer);
+}
+static GLboolean APIENTRY gl_lazy_glIsProgram(GLuint program) {
+	glIsProgram = (decltype(glIsProgram))gl_loader_resolve("glIsProgram");
+	return (*glIsProgram)(program);
+}
+static GLboolean APIENTRY gl_lazy_glIsShader(GLuint shader) {
+	glIsShader = (decltype(glIsShader))gl_loader_resolve("glIsShader");
+	return (*glIsShader)(shader);
+}
+static void APIENTRY gl_lazy_glLinkProgram(GLuint program) {
+	glLinkProgram = (decltype(glLinkProgram))gl_loader_resolve("glLinkProgram");
+	return (*glLinkProgram)(program);
+}
+static void APIENTRY gl_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) {
+	glShaderSource = (decltype(glShaderSource))gl_loader_resolve("glShaderSource");
+	return (*glShaderSource)(shader, count, string, length);
+}
+static void APIENTRY gl_lazy_glUseProgram(GLuint program) {
+	glUseProgram = (decltype(glUseProgram))gl_loader_resolve("glUseProgram");
+	return (*glUseProgram)(program);
+}
+static void APIENTRY gl_lazy_glUniform1f(GLint location, GLfloat v0) {
+	glUniform1f = (decltype(glUniform1f))gl_loader_resolve("glUniform1f");
+	return (*glUniform1f)(location, v0);
+}
+static void APIENTRY gl_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glUniform2f = (decltype(glUniform2f))gl_loader_resolve("glUniform2f");
+	return (*glUniform2f)(location, v0, v1);
+}
+static void APIENTRY gl_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glUniform3f = (decltype(glUniform3f))gl_loader_resolve("glUniform3f");
+	return (*glUniform3f)(location, v0, v1, v2);
+}
+static void APIENTRY gl_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glUniform4f = (decltype(glUniform4f))gl_loader_resolve("glUniform4f");
+	return (*glUniform4f)(location, v0, v1, v2, v3);
+}
+static void APIENTRY gl_lazy_glUniform1i(GLint location, GLint v0) {
+	glUniform1i = (decltype(glUniform1i))gl_loader_resolve("glUniform1i");
+	return (*glUniform1i)(location, v0);
+}
+static void APIENTRY gl_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glUniform2i = (decltype(glUniform2i))gl_loader_resolve("glUniform2i");
+	return (*glUniform2i)(location, v0, v1);
+}
+static void APIENTRY gl_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glUniform3i = (decltype(glUniform3i))gl_loader_resolve("glUniform3i");
+	return (*glUniform3i)(location, v0, v1, v2);
+}
+static void APIENTRY gl_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glUniform4i = (decltype(glUniform4i))gl_loader_resolve("glUniform4i");
+	return (*glUniform4i)(location, v0, v1, v2, v3);
+}
+static void APIENTRY gl_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+	glUniform1fv = (decltype(glUniform1fv))gl_loader_resolve("glUniform1fv");
+	return (*glUniform1fv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+	glUniform2fv = (decltype(glUniform2fv))gl_loader_resolve("glUniform2fv");
+	return (*glUniform2fv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+	glUniform3fv = (decltype(glUniform3fv))gl_loader_resolve("glUniform3fv");
+	return (*glUniform3fv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+	glUniform4fv = (decltype(glUniform4fv))gl_loader_resolve("glUniform4fv");
+	return (*glUniform4fv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform1iv(GLint location, GLsizei count, const GLint * value) {
+	glUniform1iv = (decltype(glUniform1iv))gl_loader_resolve("glUniform1iv");
+	return (*glUniform1iv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform2iv(GLint location, GLsizei count, const GLint * value) {
+	glUniform2iv = (decltype(glUniform2iv))gl_loader_resolve("glUniform2iv");
+	return (*glUniform2iv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform3iv(GLint location, GLsizei count, const GLint * value) {
+	glUniform3iv = (decltype(glUniform3iv))gl_loader_resolve("glUniform3iv");
+	return (*glUniform3iv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform4iv(GLint location, GLsizei count, const GLint * value) {
+	glUniform4iv = (decltype(glUniform4iv))gl_loader_resolve("glUniform4iv");
+	return (*glUniform4iv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix2fv = (decltype(glUniformMatrix2fv))gl_loader_resolve("glUniformMatrix2fv");
+	return (*glUniformMatrix2fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix3fv = (decltype(glUniformMatrix3fv))gl_loader_resolve("glUniformMatrix3fv");
+	return (*glUniformMatrix3fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix4fv = (decltype(glUniformMatrix4fv))gl_loader_resolve("glUniformMatrix4fv");
+	return (*glUniformMatrix4fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glValidateProgram(GLuint program) {
+	glValidateProgram = (decltype(glValidateProgram))gl_loader_resolve("glValidateProgram");
+	return (*glValidateProgram)(program);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glVertexAttrib1d = (decltype(glVertexAttrib1d))gl_loader_resolve("glVertexAttrib1d");
+	return (*glVertexAttrib1d)(index, x);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1dv(GLuint index, const GLdouble * v) {
+	glVertexAttrib1dv = (decltype(glVertexAttrib1dv))gl_loader_resolve("glVertexAttrib1dv");
+	return (*glVertexAttrib1dv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glVertexAttrib1f = (decltype(glVertexAttrib1f))gl_loader_resolve("glVertexAttrib1f");
+	return (*glVertexAttrib1f)(index, x);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1fv(GLuint index, const GLfloat * v) {
+	glVertexAttrib1fv = (decltype(glVertexAttrib1fv))gl_loader_resolve("glVertexAttrib1fv");
+	return (*glVertexAttrib1fv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glVertexAttrib1s = (decltype(glVertexAttrib1s))gl_loader_resolve("glVertexAttrib1s");
+	return (*glVertexAttrib1s)(index, x);
+}
+static void APIENTRY gl_lazy_glVertexAttrib1sv(GLuint index, const GLshort * v) {
+	glVertexAttrib1sv = (decltype(glVertexAttrib1sv))gl_loader_resolve("glVertexAttrib1sv");
+	return (*glVertexAttrib1sv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glVertexAttrib2d = (decltype(glVertexAttrib2d))gl_loader_resolve("glVertexAttrib2d");
+	return (*glVertexAttrib2d)(index, x, y);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2dv(GLuint index, const GLdouble * v) {
+	glVertexAttrib2dv = (decltype(glVertexAttrib2dv))gl_loader_resolve("glVertexAttrib2dv");
+	return (*glVertexAttrib2dv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glVertexAttrib2f = (decltype(glVertexAttrib2f))gl_loader_resolve("glVertexAttrib2f");
+	return (*glVertexAttrib2f)(index, x, y);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2fv(GLuint index, const GLfloat * v) {
+	glVertexAttrib2fv = (decltype(glVertexAttrib2fv))gl_loader_resolve("glVertexAttrib2fv");
+	return (*glVertexAttrib2fv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glVertexAttrib2s = (decltype(glVertexAttrib2s))gl_loader_resolve("glVertexAttrib2s");
+	return (*glVertexAttrib2s)(index, x, y);
+}
+static void APIENTRY gl_lazy_glVertexAttrib2sv(GLuint index, const GLshort * v) {
+	glVertexAttrib2sv = (decltype(glVertexAttrib2sv))gl_loader_resolve("glVertexAttrib2sv");
+	return (*glVertexAttrib2sv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glVertexAttrib3d = (decltype(glVertexAttrib3d))gl_loader_resolve("glVertexAttrib3d");
+	return (*glVertexAttrib3d)(index, x, y, z);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3dv(GLuint index, const GLdouble * v) {
+	glVertexAttrib3dv = (decltype(glVertexAttrib3dv))gl_loader_resolve("glVertexAttrib3dv");
+	return (*glVertexAttrib3dv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glVertexAttrib3f = (decltype(glVertexAttrib3f))gl_loader_resolve("glVertexAttrib3f");
+	return (*glVertexAttrib3f)(index, x, y, z);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3fv(GLuint index, const GLfloat * v) {
+	glVertexAttrib3fv = (decltype(glVertexAttrib3fv))gl_loader_resolve("glVertexAttrib3fv");
+	return (*glVertexAttrib3fv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glVertexAttrib3s = (decltype(glVertexAttrib3s))gl_loader_resolve("glVertexAttrib3s");
+	return (*glVertexAttrib3s)(index, x, y, z);
+}
+static void APIENTRY gl_lazy_glVertexAttrib3sv(GLuint index, const GLshort * v) {
+	glVertexAttrib3sv = (decltype(glVertexAttrib3sv))gl_loader_resolve("glVertexAttrib3sv");
+	return (*glVertexAttrib3sv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+	glVertexAttrib4Nbv = (decltype(glVertexAttrib4Nbv))gl_loader_resolve("glVertexAttrib4Nbv");
+	return (*glVertexAttrib4Nbv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Niv(GLuint index, const GLint * v) {
+	glVertexAttrib4Niv = (decltype(glVertexAttrib4Niv))gl_loader_resolve("glVertexAttrib4Niv");
+	return (*glVertexAttrib4Niv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort * v) {
+	glVertexAttrib4Nsv = (decltype(glVertexAttrib4Nsv))gl_loader_resolve("glVertexAttrib4Nsv");
+	return (*glVertexAttrib4Nsv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glVertexAttrib4Nub = (decltype(glVertexAttrib4Nub))gl_loader_resolve("glVertexAttrib4Nub");
+	return (*glVertexAttrib4Nub)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+	glVertexAttrib4Nubv = (decltype(glVertexAttrib4Nubv))gl_loader_resolve("glVertexAttrib4Nubv");
+	return (*glVertexAttrib4Nubv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+	glVertexAttrib4Nuiv = (decltype(glVertexAttrib4Nuiv))gl_loader_resolve("glVertexAttrib4Nuiv");
+	return (*glVertexAttrib4Nuiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort * v) {
+	glVertexAttrib4Nusv = (decltype(glVertexAttrib4Nusv))gl_loader_resolve("glVertexAttrib4Nusv");
+	return (*glVertexAttrib4Nusv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4bv(GLuint index, const GLbyte * v) {
+	glVertexAttrib4bv = (decltype(glVertexAttrib4bv))gl_loader_resolve("glVertexAttrib4bv");
+	return (*glVertexAttrib4bv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glVertexAttrib4d = (decltype(glVertexAttrib4d))gl_loader_resolve("glVertexAttrib4d");
+	return (*glVertexAttrib4d)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4dv(GLuint index, const GLdouble * v) {
+	glVertexAttrib4dv = (decltype(glVertexAttrib4dv))gl_loader_resolve("glVertexAttrib4dv");
+	return (*glVertexAttrib4dv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glVertexAttrib4f = (decltype(glVertexAttrib4f))gl_loader_resolve("glVertexAttrib4f");
+	return (*glVertexAttrib4f)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4fv(GLuint index, const GLfloat * v) {
+	glVertexAttrib4fv = (decltype(glVertexAttrib4fv))gl_loader_resolve("glVertexAttrib4fv");
+	return (*glVertexAttrib4fv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4iv(GLuint index, const GLint * v) {
+	glVertexAttrib4iv = (decltype(glVertexAttrib4iv))gl_loader_resolve("glVertexAttrib4iv");
+	return (*glVertexAttrib4iv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glVertexAttrib4s = (decltype(glVertexAttrib4s))gl_loader_resolve("glVertexAttrib4s");
+	return (*glVertexAttrib4s)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4sv(GLuint index, const GLshort * v) {
+	glVertexAttrib4sv = (decltype(glVertexAttrib4sv))gl_loader_resolve("glVertexAttrib4sv");
+	return (*glVertexAttrib4sv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte * v) {
+	glVertexAttrib4ubv = (decltype(glVertexAttrib4ubv))gl_loader_resolve("glVertexAttrib4ubv");
+	return (*glVertexAttrib4ubv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4uiv(GLuint index, const GLuint * v) {
+	glVertexAttrib4uiv = (decltype(glVertexAttrib4uiv))gl_loader_resolve("glVertexAttrib4uiv");
+	return (*glVertexAttrib4uiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttrib4usv(GLuint index, const GLushort * v) {
+	glVertexAttrib4usv = (decltype(glVertexAttrib4usv))gl_loader_resolve("glVertexAttrib4usv");
+	return (*glVertexAttrib4usv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+	glVertexAttribPointer = (decltype(glVertexAttribPointer))gl_loader_resolve("glVertexAttribPointer");
+	return (*glVertexAttribPointer)(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY gl_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix2x3fv = (decltype(glUniformMatrix2x3fv))gl_loader_resolve("glUniformMatrix2x3fv");
+	return (*glUniformMatrix2x3fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix3x2fv = (decltype(glUniformMatrix3x2fv))gl_loader_resolve("glUniformMatrix3x2fv");
+	return (*glUniformMatrix3x2fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix2x4fv = (decltype(glUniformMatrix2x4fv))gl_loader_resolve("glUniformMatrix2x4fv");
+	return (*glUniformMatrix2x4fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix4x2fv = (decltype(glUniformMatrix4x2fv))gl_loader_resolve("glUniformMatrix4x2fv");
+	return (*glUniformMatrix4x2fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix3x4fv = (decltype(glUniformMatrix3x4fv))gl_loader_resolve("glUniformMatrix3x4fv");
+	return (*glUniformMatrix3x4fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+	glUniformMatrix4x3fv = (decltype(glUniformMatrix4x3fv))gl_loader_resolve("glUniformMatrix4x3fv");
+	return (*glUniformMatrix4x3fv)(location, count, transpose, value);
+}
+static void APIENTRY gl_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glColorMaski = (decltype(glColorMaski))gl_loader_resolve("glColorMaski");
+	return (*glColorMaski)(index, r, g, b, a);
+}
+static void APIENTRY gl_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+	glGetBooleani_v = (decltype(glGetBooleani_v))gl_loader_resolve("glGetBooleani_v");
+	return (*glGetBooleani_v)(target, index, data);
+}
+static void APIENTRY gl_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+	glGetIntegeri_v = (decltype(glGetIntegeri_v))gl_loader_resolve("glGetIntegeri_v");
+	return (*glGetIntegeri_v)(target, index, data);
+}
+static void APIENTRY gl_lazy_glEnablei(GLenum target, GLuint index) {
+	glEnablei = (decltype(glEnablei))gl_loader_resolve("glEnablei");
+	return (*glEnablei)(target, index);
+}
+static void APIENTRY gl_lazy_glDisablei(GLenum target, GLuint index) {
+	glDisablei = (decltype(glDisablei))gl_loader_resolve("glDisablei");
+	return (*glDisablei)(target, index);
+}
+static GLboolean APIENTRY gl_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glIsEnabledi = (decltype(glIsEnabledi))gl_loader_resolve("glIsEnabledi");
+	return (*glIsEnabledi)(target, index);
+}
+static void APIENTRY gl_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glBeginTransformFeedback = (decltype(glBeginTransformFeedback))gl_loader_resolve("glBeginTransformFeedback");
+	return (*glBeginTransformFeedback)(primitiveMode);
+}
+static void APIENTRY gl_lazy_glEndTransformFeedback() {
+	glEndTransformFeedback = (decltype(glEndTransformFeedback))gl_loader_resolve("glEndTransformFeedback");
+	return (*glEndTransformFeedback)();
+}
+static void APIENTRY gl_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glBindBufferRange = (decltype(glBindBufferRange))gl_loader_resolve("glBindBufferRange");
+	return (*glBindBufferRange)(target, index, buffer, offset, size);
+}
+static void APIENTRY gl_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glBindBufferBase = (decltype(glBindBufferBase))gl_loader_resolve("glBindBufferBase");
+	return (*glBindBufferBase)(target, index, buffer);
+}
+static void APIENTRY gl_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) {
+	glTransformFeedbackVaryings = (decltype(glTransformFeedbackVaryings))gl_loader_resolve("glTransformFeedbackVaryings");
+	return (*glTransformFeedbackVaryings)(program, count, varyings, bufferMode);
+}
+static void APIENTRY gl_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+	glGetTransformFeedbackVarying = (decltype(glGetTransformFeedbackVarying))gl_loader_resolve("glGetTransformFeedbackVarying");
+	return (*glGetTransformFeedbackVarying)(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY gl_lazy_glClampColor(GLenum target, GLenum clamp) {
+	glClampColor = (decltype(glClampColor))gl_loader_resolve("glClampColor");
+	return (*glClampColor)(target, clamp);
+}
+static void APIENTRY gl_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glBeginConditionalRender = (decltype(glBeginConditionalRender))gl_loader_resolve("glBeginConditionalRender");
+	return (*glBeginConditionalRender)(id, mode);
+}
+static void APIENTRY gl_lazy_glEndConditionalRender() {
+	glEndConditionalRender = (decltype(glEndConditionalRender))gl_loader_resolve("glEndConditionalRender");
+	return (*glEndConditionalRender)();
+}
+static void APIENTRY gl_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+	glVertexAttribIPointer = (decltype(glVertexAttribIPointer))gl_loader_resolve("glVertexAttribIPointer");
+	return (*glVertexAttribIPointer)(index, size, type, stride, pointer);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+	glGetVertexAttribIiv = (decltype(glGetVertexAttribIiv))gl_loader_resolve("glGetVertexAttribIiv");
+	return (*glGetVertexAttribIiv)(index, pname, params);
+}
+static void APIENTRY gl_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+	glGetVertexAttribIuiv = (decltype(glGetVertexAttribIuiv))gl_loader_resolve("glGetVertexAttribIuiv");
+	return (*glGetVertexAttribIuiv)(index, pname, params);
+}
+static void APIENTRY gl_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glVertexAttribI1i = (decltype(glVertexAttribI1i))gl_loader_resolve("glVertexAttribI1i");
+	return (*glVertexAttribI1i)(index, x);
+}
+static void APIENTRY gl_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glVertexAttribI2i = (decltype(glVertexAttribI2i))gl_loader_resolve("glVertexAttribI2i");
+	return (*glVertexAttribI2i)(index, x, y);
+}
+static void APIENTRY gl_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glVertexAttribI3i = (decltype(glVertexAttribI3i))gl_loader_resolve("glVertexAttribI3i");
+	return (*glVertexAttribI3i)(index, x, y, z);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glVertexAttribI4i = (decltype(glVertexAttribI4i))gl_loader_resolve("glVertexAttribI4i");
+	return (*glVertexAttribI4i)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glVertexAttribI1ui = (decltype(glVertexAttribI1ui))gl_loader_resolve("glVertexAttribI1ui");
+	return (*glVertexAttribI1ui)(index, x);
+}
+static void APIENTRY gl_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glVertexAttribI2ui = (decltype(glVertexAttribI2ui))gl_loader_resolve("glVertexAttribI2ui");
+	return (*glVertexAttribI2ui)(index, x, y);
+}
+static void APIENTRY gl_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glVertexAttribI3ui = (decltype(glVertexAttribI3ui))gl_loader_resolve("glVertexAttribI3ui");
+	return (*glVertexAttribI3ui)(index, x, y, z);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glVertexAttribI4ui = (decltype(glVertexAttribI4ui))gl_loader_resolve("glVertexAttribI4ui");
+	return (*glVertexAttribI4ui)(index, x, y, z, w);
+}
+static void APIENTRY gl_lazy_glVertexAttribI1iv(GLuint index, const GLint * v) {
+	glVertexAttribI1iv = (decltype(glVertexAttribI1iv))gl_loader_resolve("glVertexAttribI1iv");
+	return (*glVertexAttribI1iv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI2iv(GLuint index, const GLint * v) {
+	glVertexAttribI2iv = (decltype(glVertexAttribI2iv))gl_loader_resolve("glVertexAttribI2iv");
+	return (*glVertexAttribI2iv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI3iv(GLuint index, const GLint * v) {
+	glVertexAttribI3iv = (decltype(glVertexAttribI3iv))gl_loader_resolve("glVertexAttribI3iv");
+	return (*glVertexAttribI3iv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4iv(GLuint index, const GLint * v) {
+	glVertexAttribI4iv = (decltype(glVertexAttribI4iv))gl_loader_resolve("glVertexAttribI4iv");
+	return (*glVertexAttribI4iv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI1uiv(GLuint index, const GLuint * v) {
+	glVertexAttribI1uiv = (decltype(glVertexAttribI1uiv))gl_loader_resolve("glVertexAttribI1uiv");
+	return (*glVertexAttribI1uiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI2uiv(GLuint index, const GLuint * v) {
+	glVertexAttribI2uiv = (decltype(glVertexAttribI2uiv))gl_loader_resolve("glVertexAttribI2uiv");
+	return (*glVertexAttribI2uiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI3uiv(GLuint index, const GLuint * v) {
+	glVertexAttribI3uiv = (decltype(glVertexAttribI3uiv))gl_loader_resolve("glVertexAttribI3uiv");
+	return (*glVertexAttribI3uiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4uiv(GLuint index, const GLuint * v) {
+	glVertexAttribI4uiv = (decltype(glVertexAttribI4uiv))gl_loader_resolve("glVertexAttribI4uiv");
+	return (*glVertexAttribI4uiv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4bv(GLuint index, const GLbyte * v) {
+	glVertexAttribI4bv = (decltype(glVertexAttribI4bv))gl_loader_resolve("glVertexAttribI4bv");
+	return (*glVertexAttribI4bv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4sv(GLuint index, const GLshort * v) {
+	glVertexAttribI4sv = (decltype(glVertexAttribI4sv))gl_loader_resolve("glVertexAttribI4sv");
+	return (*glVertexAttribI4sv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte * v) {
+	glVertexAttribI4ubv = (decltype(glVertexAttribI4ubv))gl_loader_resolve("glVertexAttribI4ubv");
+	return (*glVertexAttribI4ubv)(index, v);
+}
+static void APIENTRY gl_lazy_glVertexAttribI4usv(GLuint index, const GLushort * v) {
+	glVertexAttribI4usv = (decltype(glVertexAttribI4usv))gl_loader_resolve("glVertexAttribI4usv");
+	return (*glVertexAttribI4usv)(index, v);
+}
+static void APIENTRY gl_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint * params) {
+	glGetUniformuiv = (decltype(glGetUniformuiv))gl_loader_resolve("glGetUniformuiv");
+	return (*glGetUniformuiv)(program, location, params);
+}
+static void APIENTRY gl_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+	glBindFragDataLocation = (decltype(glBindFragDataLocation))gl_loader_resolve("glBindFragDataLocation");
+	return (*glBindFragDataLocation)(program, color, name);
+}
+static GLint APIENTRY gl_lazy_glGetFragDataLocation(GLuint program, const GLchar * name) {
+	glGetFragDataLocation = (decltype(glGetFragDataLocation))gl_loader_resolve("glGetFragDataLocation");
+	return (*glGetFragDataLocation)(program, name);
+}
+static void APIENTRY gl_lazy_glUniform1ui(GLint location, GLuint v0) {
+	glUniform1ui = (decltype(glUniform1ui))gl_loader_resolve("glUniform1ui");
+	return (*glUniform1ui)(location, v0);
+}
+static void APIENTRY gl_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glUniform2ui = (decltype(glUniform2ui))gl_loader_resolve("glUniform2ui");
+	return (*glUniform2ui)(location, v0, v1);
+}
+static void APIENTRY gl_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glUniform3ui = (decltype(glUniform3ui))gl_loader_resolve("glUniform3ui");
+	return (*glUniform3ui)(location, v0, v1, v2);
+}
+static void APIENTRY gl_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glUniform4ui = (decltype(glUniform4ui))gl_loader_resolve("glUniform4ui");
+	return (*glUniform4ui)(location, v0, v1, v2, v3);
+}
+static void APIENTRY gl_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+	glUniform1uiv = (decltype(glUniform1uiv))gl_loader_resolve("glUniform1uiv");
+	return (*glUniform1uiv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+	glUniform2uiv = (decltype(glUniform2uiv))gl_loader_resolve("glUniform2uiv");
+	return (*glUniform2uiv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+	glUniform3uiv = (decltype(glUniform3uiv))gl_loader_resolve("glUniform3uiv");
+	return (*glUniform3uiv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+	glUniform4uiv = (decltype(glUniform4uiv))gl_loader_resolve("glUniform4uiv");
+	return (*glUniform4uiv)(location, count, value);
+}
+static void APIENTRY gl_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+	glTexParameterIiv = (decltype(glTexParameterIiv))gl_loader_resolve("glTexParameterIiv");
+	return (*glTexParameterIiv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+	glTexParameterIuiv = (decltype(glTexParameterIuiv))gl_loader_resolve("glTexParameterIuiv");
+	return (*glTexParameterIuiv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+	glGetTexParameterIiv = (decltype(glGetTexParameterIiv))gl_loader_resolve("glGetTexParameterIiv");
+	return (*glGetTexParameterIiv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+	glGetTexParameterIuiv = (decltype(glGetTexParameterIuiv))gl_loader_resolve("glGetTexParameterIuiv");
+	return (*glGetTexParameterIuiv)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+	glClearBufferiv = (decltype(glClearBufferiv))gl_loader_resolve("glClearBufferiv");
+	return (*glClearBufferiv)(buffer, drawbuffer, value);
+}
+static void APIENTRY gl_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+	glClearBufferuiv = (decltype(glClearBufferuiv))gl_loader_resolve("glClearBufferuiv");
+	return (*glClearBufferuiv)(buffer, drawbuffer, value);
+}
+static void APIENTRY gl_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+	glClearBufferfv = (decltype(glClearBufferfv))gl_loader_resolve("glClearBufferfv");
+	return (*glClearBufferfv)(buffer, drawbuffer, value);
+}
+static void APIENTRY gl_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glClearBufferfi = (decltype(glClearBufferfi))gl_loader_resolve("glClearBufferfi");
+	return (*glClearBufferfi)(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY gl_lazy_glGetStringi(GLenum name, GLuint index) {
+	glGetStringi = (decltype(glGetStringi))gl_loader_resolve("glGetStringi");
+	return (*glGetStringi)(name, index);
+}
+static GLboolean APIENTRY gl_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glIsRenderbuffer = (decltype(glIsRenderbuffer))gl_loader_resolve("glIsRenderbuffer");
+	return (*glIsRenderbuffer)(renderbuffer);
+}
+static void APIENTRY gl_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glBindRenderbuffer = (decltype(glBindRenderbuffer))gl_loader_resolve("glBindRenderbuffer");
+	return (*glBindRenderbuffer)(target, renderbuffer);
+}
+static void APIENTRY gl_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+	glDeleteRenderbuffers = (decltype(glDeleteRenderbuffers))gl_loader_resolve("glDeleteRenderbuffers");
+	return (*glDeleteRenderbuffers)(n, renderbuffers);
+}
+static void APIENTRY gl_lazy_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+	glGenRenderbuffers = (decltype(glGenRenderbuffers))gl_loader_resolve("glGenRenderbuffers");
+	return (*glGenRenderbuffers)(n, renderbuffers);
+}
+static void APIENTRY gl_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glRenderbufferStorage = (decltype(glRenderbufferStorage))gl_loader_resolve("glRenderbufferStorage");
+	return (*glRenderbufferStorage)(target, internalformat, width, height);
+}
+static void APIENTRY gl_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+	glGetRenderbufferParameteriv = (decltype(glGetRenderbufferParameteriv))gl_loader_resolve("glGetRenderbufferParameteriv");
+	return (*glGetRenderbufferParameteriv)(target, pname, params);
+}
+static GLboolean APIENTRY gl_lazy_glIsFramebuffer(GLuint framebuffer) {
+	glIsFramebuffer = (decltype(glIsFramebuffer))gl_loader_resolve("glIsFramebuffer");
+	return (*glIsFramebuffer)(framebuffer);
+}
+static void APIENTRY gl_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glBindFramebuffer = (decltype(glBindFramebuffer))gl_loader_resolve("glBindFramebuffer");
+	return (*glBindFramebuffer)(target, framebuffer);
+}
+static void APIENTRY gl_lazy_glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+	glDeleteFramebuffers = (decltype(glDeleteFramebuffers))gl_loader_resolve("glDeleteFramebuffers");
+	return (*glDeleteFramebuffers)(n, framebuffers);
+}
+static void APIENTRY gl_lazy_glGenFramebuffers(GLsizei n, GLuint * framebuffers) {
+	glGenFramebuffers = (decltype(glGenFramebuffers))gl_loader_resolve("glGenFramebuffers");
+	return (*glGenFramebuffers)(n, framebuffers);
+}
+static GLenum APIENTRY gl_lazy_glCheckFramebufferStatus(GLenum target) {
+	glCheckFramebufferStatus = (decltype(glCheckFramebufferStatus))gl_loader_resolve("glCheckFramebufferStatus");
+	return (*glCheckFramebufferStatus)(target);
+}
+static void APIENTRY gl_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glFramebufferTexture1D = (decltype(glFramebufferTexture1D))gl_loader_resolve("glFramebufferTexture1D");
+	return (*glFramebufferTexture1D)(target, attachment, textarget, texture, level);
+}
+static void APIENTRY gl_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glFramebufferTexture2D = (decltype(glFramebufferTexture2D))gl_loader_resolve("glFramebufferTexture2D");
+	return (*glFramebufferTexture2D)(target, attachment, textarget, texture, level);
+}
+static void APIENTRY gl_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glFramebufferTexture3D = (decltype(glFramebufferTexture3D))gl_loader_resolve("glFramebufferTexture3D");
+	return (*glFramebufferTexture3D)(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY gl_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glFramebufferRenderbuffer = (decltype(glFramebufferRenderbuffer))gl_loader_resolve("glFramebufferRenderbuffer");
+	return (*glFramebufferRenderbuffer)(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY gl_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+	glGetFramebufferAttachmentParameteriv = (decltype(glGetFramebufferAttachmentParameteriv))gl_loader_resolve("glGetFramebufferAttachmentParameteriv");
+	return (*glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
+}
+static void APIENTRY gl_lazy_glGenerateMipmap(GLenum target) {
+	glGenerateMipmap = (decltype(glGenerateMipmap))gl_loader_resolve("glGenerateMipmap");
+	return (*glGenerateMipmap)(target);
+}
+static void APIENTRY gl_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glBlitFramebuffer = (decltype(glBlitFramebuffer))gl_loader_resolve("glBlitFramebuffer");
+	return (*glBlitFramebuffer)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY gl_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glRenderbufferStorageMultisample = (decltype(glRenderbufferStorageMultisample))gl_loader_resolve("glRenderbufferStorageMultisample");
+	return (*glRenderbufferStorageMultisample)(target, samples, internalformat, width, height);
+}
+static void APIENTRY gl_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glFramebufferTextureLayer = (decltype(glFramebufferTextureLayer))gl_loader_resolve("glFramebufferTextureLayer");
+	return (*glFramebufferTextureLayer)(target, attachment, texture, level, layer);
+}
+static void * APIENTRY gl_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glMapBufferRange = (decltype(glMapBufferRange))gl_loader_resolve("glMapBufferRange");
+	return (*glMapBufferRange)(target, offset, length, access);
+}
+static void APIENTRY gl_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glFlushMappedBufferRange = (decltype(glFlushMappedBufferRange))gl_loader_resolve("glFlushMappedBufferRange");
+	return (*glFlushMappedBufferRange)(target, offset, length);
+}
+static void APIENTRY gl_lazy_glBindVertexArray(GLuint array) {
+	glBindVertexArray = (decltype(glBindVertexArray))gl_loader_resolve("glBindVertexArray");
+	return (*glBindVertexArray)(array);
+}
+static void APIENTRY gl_lazy_glDeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+	glDeleteVertexArrays = (decltype(glDeleteVertexArrays))gl_loader_resolve("glDeleteVertexArrays");
+	return (*glDeleteVertexArrays)(n, arrays);
+}
+static void APIENTRY gl_lazy_glGenVertexArrays(GLsizei n, GLuint * arrays) {
+	glGenVertexArrays = (decltype(glGenVertexArrays))gl_loader_resolve("glGenVertexArrays");
+	return (*glGenVertexArrays)(n, arrays);
+}
+static GLboolean APIENTRY gl_lazy_glIsVertexArray(GLuint array) {
+	glIsVertexArray = (decltype(glIsVertexArray))gl_loader_resolve("glIsVertexArray");
+	return (*glIsVertexArray)(array);
+}
+static void APIENTRY gl_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glDrawArraysInstanced = (decltype(glDrawArraysInstanced))gl_loader_resolve("glDrawArraysInstanced");
+	return (*glDrawArraysInstanced)(mode, first, count, instancecount);
+}
+static void APIENTRY gl_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+	glDrawElementsInstanced = (decltype(glDrawElementsInstanced))gl_loader_resolve("glDrawElementsInstanced");
+	return (*glDrawElementsInstanced)(mode, count, type, indices, instancecount);
+}
+static void APIENTRY gl_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glTexBuffer = (decltype(glTexBuffer))gl_loader_resolve("glTexBuffer");
+	return (*glTexBuffer)(target, internalformat, buffer);
+}
+static void APIENTRY gl_lazy_glPrimitiveRestartIndex(GLuint index) {
+	glPrimitiveRestartIndex = (decltype(glPrimitiveRestartIndex))gl_loader_resolve("glPrimitiveRestartIndex");
+	return (*glPrimitiveRestartIndex)(index);
+}
+static void APIENTRY gl_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glCopyBufferSubData = (decltype(glCopyBufferSubData))gl_loader_resolve("glCopyBufferSubData");
+	return (*glCopyBufferSubData)(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY gl_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) {
+	glGetUniformIndices = (decltype(glGetUniformIndices))gl_loader_resolve("glGetUniformIndices");
+	return (*glGetUniformIndices)(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY gl_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+	glGetActiveUniformsiv = (decltype(glGetActiveUniformsiv))gl_loader_resolve("glGetActiveUniformsiv");
+	return (*glGetActiveUniformsiv)(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY gl_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+	glGetActiveUniformName = (decltype(glGetActiveUniformName))gl_loader_resolve("glGetActiveUniformName");
+	return (*glGetActiveUniformName)(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY gl_lazy_glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+	glGetUniformBlockIndex = (decltype(glGetUniformBlockIndex))gl_loader_resolve("glGetUniformBlockIndex");
+	return (*glGetUniformBlockIndex)(program, uniformBlockName);
+}
+static void APIENTRY gl_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+	glGetActiveUniformBlockiv = (decltype(glGetActiveUniformBlockiv))gl_loader_resolve("glGetActiveUniformBlockiv");
+	return (*glGetActiveUniformBlockiv)(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY gl_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+	glGetActiveUniformBlockName = (decltype(glGetActiveUniformBlockName))gl_loader_resolve("glGetActiveUniformBlockName");
+	return (*glGetActiveUniformBlockName)(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY gl_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glUniformBlockBinding = (decltype(glUniformBlockBinding))gl_loader_resolve("glUniformBlockBinding");
+	return (*glUniformBlockBinding)(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY gl_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+	glDrawElementsBaseVertex = (decltype(glDrawElementsBaseVertex))gl_loader_resolve("glDrawElementsBaseVertex");
+	return (*glDrawElementsBaseVertex)(mode, count, type, indices, basevertex);
+}
+static void APIENTRY gl_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+	glDrawRangeElementsBaseVertex = (decltype(glDrawRangeElementsBaseVertex))gl_loader_resolve("glDrawRangeElementsBaseVertex");
+	return (*glDrawRangeElementsBaseVertex)(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY gl_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+	glDrawElementsInstancedBaseVertex = (decltype(glDrawElementsInstancedBaseVertex))gl_loader_resolve("glDrawElementsInstancedBaseVertex");
+	return (*glDrawElementsInstancedBaseVertex)(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY gl_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) {
+	glMultiDrawElementsBaseVertex = (decltype(glMultiDrawElementsBaseVertex))gl_loader_resolve("glMultiDrawElementsBaseVertex");
+	return (*glMultiDrawElementsBaseVertex)(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY gl_lazy_glProvokingVertex(GLenum mode) {
+	glProvokingVertex = (decltype(glProvokingVertex))gl_loader_resolve("glProvokingVertex");
+	return (*glProvokingVertex)(mode);
+}
+static GLsync APIENTRY gl_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glFenceSync = (decltype(glFenceSync))gl_loader_resolve("glFenceSync");
+	return (*glFenceSync)(condition, flags);
+}
+static GLboolean APIENTRY gl_lazy_glIsSync(GLsync sync) {
+	glIsSync = (decltype(glIsSync))gl_loader_resolve("glIsSync");
+	return (*glIsSync)(sync);
+}
+static void APIENTRY gl_lazy_glDeleteSync(GLsync sync) {
+	glDeleteSync = (decltype(glDeleteSync))gl_loader_resolve("glDeleteSync");
+	return (*glDeleteSync)(sync);
+}
+static GLenum APIENTRY gl_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glClientWaitSync = (decltype(glClientWaitSync))gl_loader_resolve("glClientWaitSync");
+	return (*glClientWaitSync)(sync, flags, timeout);
+}
+static void APIENTRY gl_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glWaitSync = (decltype(glWaitSync))gl_loader_resolve("glWaitSync");
+	return (*glWaitSync)(sync, flags, timeout);
+}
+static void APIENTRY gl_lazy_glGetInteger64v(GLenum pname, GLint64 * data) {
+	glGetInteger64v = (decltype(glGetInteger64v))gl_loader_resolve("glGetInteger64v");
+	return (*glGetInteger64v)(pname, data);
+}
+static void APIENTRY gl_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values) {
+	glGetSynciv = (decltype(glGetSynciv))gl_loader_resolve("glGetSynciv");
+	return (*glGetSynciv)(sync, pname, bufSize, length, values);
+}
+static void APIENTRY gl_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+	glGetInteger64i_v = (decltype(glGetInteger64i_v))gl_loader_resolve("glGetInteger64i_v");
+	return (*glGetInteger64i_v)(target, index, data);
+}
+static void APIENTRY gl_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+	glGetBufferParameteri64v = (decltype(glGetBufferParameteri64v))gl_loader_resolve("glGetBufferParameteri64v");
+	return (*glGetBufferParameteri64v)(target, pname, params);
+}
+static void APIENTRY gl_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glFramebufferTexture = (decltype(glFramebufferTexture))gl_loader_resolve("glFramebufferTexture");
+	return (*glFramebufferTexture)(target, attachment, texture, level);
+}
+static void APIENTRY gl_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glTexImage2DMultisample = (decltype(glTexImage2DMultisample))gl_loader_resolve("glTexImage2DMultisample");
+	return (*glTexImage2DMultisample)(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY gl_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glTexImage3DMultisample = (decltype(glTexImage3DMultisample))gl_loader_resolve("glTexImage3DMultisample");
+	return (*glTexImage3DMultisample)(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY gl_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+	glGetMultisamplefv = (decltype(glGetMultisamplefv))gl_loader_resolve("glGetMultisamplefv");
+	return (*glGetMultisamplefv)(pname, index, val);
+}
+static void APIENTRY gl_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glSampleMaski = (decltype(glSampleMaski))gl_loader_resolve("glSampleMaski");
+	return (*glSampleMaski)(maskNumber, mask);
+}
+static void APIENTRY gl_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+	glBindFragDataLocationIndexed = (decltype(glBindFragDataLocationIndexed))gl_loader_resolve("glBindFragDataLocationIndexed");
+	return (*glBindFragDataLocationIndexed)(program, colorNumber, index, name);
+}
+static GLint APIENTRY gl_lazy_glGetFragDataIndex(GLuint program, const GLchar * name) {
+	glGetFragDataIndex = (decltype(glGetFragDataIndex))gl_loader_resolve("glGetFragDataIndex");
+	return (*glGetFragDataIndex)(program, name);
+}
+static void APIENTRY gl_lazy_glGenSamplers(GLsizei count, GLuint * samplers) {
+	glGenSamplers = (decltype(glGenSamplers))gl_loader_resolve("glGenSamplers");
+	return (*glGenSamplers)(count, samplers);
+}
+static void APIENTRY gl_lazy_glDeleteSamplers(GLsizei count, const GLuint * samplers) {
+	glDeleteSamplers = (decltype(glDeleteSamplers))gl_loader_resolve("glDeleteSamplers");
+	return (*glDeleteSamplers)(count, samplers);
+}
+static GLboolean APIENTRY gl_lazy_glIsSampler(GLuint sampler) {
+	glIsSampler = (decltype(glIsSampler))gl_loader_resolve("glIsSampler");
+	return (*glIsSampler)(sampler);
+}
+static void APIENTRY gl_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glBindSampler = (decltype(glBindSampler))gl_loader_resolve("glBindSampler");
+	return (*glBindSampler)(unit, sampler);
+}
+static void APIENTRY gl_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glSamplerParameteri = (decltype(glSamplerParameteri))gl_loader_resolve("glSamplerParameteri");
+	return (*glSamplerParameteri)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+	glSamplerParameteriv = (decltype(glSamplerParameteriv))gl_loader_resolve("glSamplerParameteriv");
+	return (*glSamplerParameteriv)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glSamplerParameterf = (decltype(glSamplerParameterf))gl_loader_resolve("glSamplerParameterf");
+	return (*glSamplerParameterf)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+	glSamplerParameterfv = (decltype(glSamplerParameterfv))gl_loader_resolve("glSamplerParameterfv");
+	return (*glSamplerParameterfv)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+	glSamplerParameterIiv = (decltype(glSamplerParameterIiv))gl_loader_resolve("glSamplerParameterIiv");
+	return (*glSamplerParameterIiv)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+	glSamplerParameterIuiv = (decltype(glSamplerParameterIuiv))gl_loader_resolve("glSamplerParameterIuiv");
+	return (*glSamplerParameterIuiv)(sampler, pname, param);
+}
+static void APIENTRY gl_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+	glGetSamplerParameteriv = (decltype(glGetSamplerParameteriv))gl_loader_resolve("glGetSamplerParameteriv");
+	return (*glGetSamplerParameteriv)(sampler, pname, params);
+}
+static void APIENTRY gl_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+	glGetSamplerParameterIiv = (decltype(glGetSamplerParameterIiv))gl_loader_resolve("glGetSamplerParameterIiv");
+	return (*glGetSamplerParameterIiv)(sampler, pname, params);
+}
+static void APIENTRY gl_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+	glGetSamplerParameterfv = (decltype(glGetSamplerParameterfv))gl_loader_resolve("glGetSamplerParameterfv");
+	return (*glGetSamplerParameterfv)(sampler, pname, params);
+}
+static void APIENTRY gl_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+	glGetSamplerParameterIuiv = (decltype(glGetSamplerParameterIuiv))gl_loader_resolve("glGetSamplerParameterIuiv");
+	return (*glGetSamplerParameterIuiv)(sampler, pname, params);
+}
+static void APIENTRY gl_lazy_glQueryCounter(GLuint id, GLenum target) {
+	glQueryCounter = (decltype(glQueryCounter))gl_loader_resolve("glQueryCounter");
+	return (*glQueryCounter)(id, target);
+}
+static void APIENTRY gl_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+	glGetQueryObjecti64v = (decltype(glGetQueryObjecti64v))gl_loader_resolve("glGetQueryObjecti64v");
+	return (*glGetQueryObjecti64v)(id, pname, params);
+}
+static void APIENTRY gl_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+	glGetQueryObjectui64v = (decltype(glGetQueryObjectui64v))gl_loader_resolve("glGetQueryObjectui64v");
+	return (*glGetQueryObjectui64v)(id, pname, params);
+}
+static void APIENTRY gl_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glVertexAttribDivisor = (decltype(glVertexAttribDivisor))gl_loader_resolve("glVertexAttribDivisor");
+	return (*glVertexAttribDivisor)(index, divisor);
+}
+static void APIENTRY gl_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP1ui = (decltype(glVertexAttribP1ui))gl_loader_resolve("glVertexAttribP1ui");
+	return (*glVertexAttribP1ui)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+	glVertexAttribP1uiv = (decltype(glVertexAttribP1uiv))gl_loader_resolve("glVertexAttribP1uiv");
+	return (*glVertexAttribP1uiv)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP2ui = (decltype(glVertexAttribP2ui))gl_loader_resolve("glVertexAttribP2ui");
+	return (*glVertexAttribP2ui)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+	glVertexAttribP2uiv = (decltype(glVertexAttribP2uiv))gl_loader_resolve("glVertexAttribP2uiv");
+	return (*glVertexAttribP2uiv)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP3ui = (decltype(glVertexAttribP3ui))gl_loader_resolve("glVertexAttribP3ui");
+	return (*glVertexAttribP3ui)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+	glVertexAttribP3uiv = (decltype(glVertexAttribP3uiv))gl_loader_resolve("glVertexAttribP3uiv");
+	return (*glVertexAttribP3uiv)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP4ui = (decltype(glVertexAttribP4ui))gl_loader_resolve("glVertexAttribP4ui");
+	return (*glVertexAttribP4ui)(index, type, normalized, value);
+}
+static void APIENTRY gl_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+	glVertexAttribP4uiv = (decltype(glVertexAttribP4uiv))gl_loader_resolve("glVertexAttribP4uiv");
+	return (*glVertexAttribP4uiv)(index, type, normalized, value);
+}
+
+void (APIENTRY *glCullFace)(GLenum mode) = gl_lazy_glCullFace;
+void (APIENTRY *glFrontFace)(GLenum mode) = gl_lazy_glFrontFace;
+void (APIENTRY *glHint)(GLenum target, GLenum mode) = gl_lazy_glHint;
+void (APIENTRY *glLineWidth)(GLfloat width) = gl_lazy_glLineWidth;
+void (APIENTRY *glPointSize)(GLfloat size) = gl_lazy_glPointSize;
+void (APIENTRY *glPolygonMode)(GLenum face, GLenum mode) = gl_lazy_glPolygonMode;
+void (APIENTRY *glScissor)(GLint x, GLint y, GLsizei width, GLsizei height) = gl_lazy_glScissor;
+void (APIENTRY *glTexParameterf)(GLenum target, GLenum pname, GLfloat param) = gl_lazy_glTexParameterf;
+void (APIENTRY *glTexParameterfv)(GLenum target, GLenum pname, const GLfloat * params) = gl_lazy_glTexParameterfv;
+void (APIENTRY *glTexParameteri)(GLenum target, GLenum pname, GLint param) = gl_lazy_glTexParameteri;
+void (APIENTRY *glTexParameteriv)(GLenum target, GLenum pname, const GLint * params) = gl_lazy_glTexParameteriv;
+void (APIENTRY *glTexImage1D)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexImage1D;
+void (APIENTRY *glTexImage2D)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexImage2D;
+void (APIENTRY *glDrawBuffer)(GLenum buf) = gl_lazy_glDrawBuffer;
+void (APIENTRY *glClear)(GLbitfield mask) = gl_lazy_glClear;
+void (APIENTRY *glClearColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) = gl_lazy_glClearColor;
+void (APIENTRY *glClearStencil)(GLint s) = gl_lazy_glClearStencil;
+void (APIENTRY *glClearDepth)(GLdouble depth) = gl_lazy_glClearDepth;
+void (APIENTRY *glStencilMask)(GLuint mask) = gl_lazy_glStencilMask;
+void (APIENTRY *glColorMask)(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) = gl_lazy_glColorMask;
+void (APIENTRY *glDepthMask)(GLboolean flag) = gl_lazy_glDepthMask;
+void (APIENTRY *glDisable)(GLenum cap) = gl_lazy_glDisable;
+void (APIENTRY *glEnable)(GLenum cap) = gl_lazy_glEnable;
+void (APIENTRY *glFinish)() = gl_lazy_glFinish;
+void (APIENTRY *glFlush)() = gl_lazy_glFlush;
+void (APIENTRY *glBlendFunc)(GLenum sfactor, GLenum dfactor) = gl_lazy_glBlendFunc;
+void (APIENTRY *glLogicOp)(GLenum opcode) = gl_lazy_glLogicOp;
+void (APIENTRY *glStencilFunc)(GLenum func, GLint ref, GLuint mask) = gl_lazy_glStencilFunc;
+void (APIENTRY *glStencilOp)(GLenum fail, GLenum zfail, GLenum zpass) = gl_lazy_glStencilOp;
+void (APIENTRY *glDepthFunc)(GLenum func) = gl_lazy_glDepthFunc;
+void (APIENTRY *glPixelStoref)(GLenum pname, GLfloat param) = gl_lazy_glPixelStoref;
+void (APIENTRY *glPixelStorei)(GLenum pname, GLint param) = gl_lazy_glPixelStorei;
+void (APIENTRY *glReadBuffer)(GLenum src) = gl_lazy_glReadBuffer;
+void (APIENTRY *glReadPixels)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) = gl_lazy_glReadPixels;
+void (APIENTRY *glGetBooleanv)(GLenum pname, GLboolean * data) = gl_lazy_glGetBooleanv;
+void (APIENTRY *glGetDoublev)(GLenum pname, GLdouble * data) = gl_lazy_glGetDoublev;
+GLenum (APIENTRY *glGetError)() = gl_lazy_glGetError;
+void (APIENTRY *glGetFloatv)(GLenum pname, GLfloat * data) = gl_lazy_glGetFloatv;
+void (APIENTRY *glGetIntegerv)(GLenum pname, GLint * data) = gl_lazy_glGetIntegerv;
+const GLubyte * (APIENTRY *glGetString)(GLenum name) = gl_lazy_glGetString;
+void (APIENTRY *glGetTexImage)(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) = gl_lazy_glGetTexImage;
+void (APIENTRY *glGetTexParameterfv)(GLenum target, GLenum pname, GLfloat * params) = gl_lazy_glGetTexParameterfv;
+void (APIENTRY *glGetTexParameteriv)(GLenum target, GLenum pname, GLint * params) = gl_lazy_glGetTexParameteriv;
+void (APIENTRY *glGetTexLevelParameterfv)(GLenum target, GLint level, GLenum pname, GLfloat * params) = gl_lazy_glGetTexLevelParameterfv;
+void (APIENTRY *glGetTexLevelParameteriv)(GLenum target, GLint level, GLenum pname, GLint * params) = gl_lazy_glGetTexLevelParameteriv;
+GLboolean (APIENTRY *glIsEnabled)(GLenum cap) = gl_lazy_glIsEnabled;
+void (APIENTRY *glDepthRange)(GLdouble n, GLdouble f) = gl_lazy_glDepthRange;
+void (APIENTRY *glViewport)(GLint x, GLint y, GLsizei width, GLsizei height) = gl_lazy_glViewport;
+void (APIENTRY *glDrawArrays)(GLenum mode, GLint first, GLsizei count) = gl_lazy_glDrawArrays;
+void (APIENTRY *glDrawElements)(GLenum mode, GLsizei count, GLenum type, const void * indices) = gl_lazy_glDrawElements;
+void (APIENTRY *glGetPointerv)(GLenum pname, void ** params) = gl_lazy_glGetPointerv;
+void (APIENTRY *glPolygonOffset)(GLfloat factor, GLfloat units) = gl_lazy_glPolygonOffset;
+void (APIENTRY *glCopyTexImage1D)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) = gl_lazy_glCopyTexImage1D;
+void (APIENTRY *glCopyTexImage2D)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) = gl_lazy_glCopyTexImage2D;
+void (APIENTRY *glCopyTexSubImage1D)(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) = gl_lazy_glCopyTexSubImage1D;
+void (APIENTRY *glCopyTexSubImage2D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) = gl_lazy_glCopyTexSubImage2D;
+void (APIENTRY *glTexSubImage1D)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexSubImage1D;
+void (APIENTRY *glTexSubImage2D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexSubImage2D;
+void (APIENTRY *glBindTexture)(GLenum target, GLuint texture) = gl_lazy_glBindTexture;
+void (APIENTRY *glDeleteTextures)(GLsizei n, const GLuint * textures) = gl_lazy_glDeleteTextures;
+void (APIENTRY *glGenTextures)(GLsizei n, GLuint * textures) = gl_lazy_glGenTextures;
+GLboolean (APIENTRY *glIsTexture)(GLuint texture) = gl_lazy_glIsTexture;
+void (APIENTRY *glDrawRangeElements)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) = gl_lazy_glDrawRangeElements;
+void (APIENTRY *glTexImage3D)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexImage3D;
+void (APIENTRY *glTexSubImage3D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) = gl_lazy_glTexSubImage3D;
+void (APIENTRY *glCopyTexSubImage3D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) = gl_lazy_glCopyTexSubImage3D;
+void (APIENTRY *glActiveTexture)(GLenum texture) = gl_lazy_glActiveTexture;
+void (APIENTRY *glSampleCoverage)(GLfloat value, GLboolean invert) = gl_lazy_glSampleCoverage;
+void (APIENTRY *glCompressedTexImage3D)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexImage3D;
+void (APIENTRY *glCompressedTexImage2D)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexImage2D;
+void (APIENTRY *glCompressedTexImage1D)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexImage1D;
+void (APIENTRY *glCompressedTexSubImage3D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexSubImage3D;
+void (APIENTRY *glCompressedTexSubImage2D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexSubImage2D;
+void (APIENTRY *glCompressedTexSubImage1D)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) = gl_lazy_glCompressedTexSubImage1D;
+void (APIENTRY *glGetCompressedTexImage)(GLenum target, GLint level, void * img) = gl_lazy_glGetCompressedTexImage;
+void (APIENTRY *glBlendFuncSeparate)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) = gl_lazy_glBlendFuncSeparate;
+void (APIENTRY *glMultiDrawArrays)(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) = gl_lazy_glMultiDrawArrays;
+void (APIENTRY *glMultiDrawElements)(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) = gl_lazy_glMultiDrawElements;
+void (APIENTRY *glPointParameterf)(GLenum pname, GLfloat param) = gl_lazy_glPointParameterf;
+void (APIENTRY *glPointParameterfv)(GLenum pname, const GLfloat * params) = gl_lazy_glPointParameterfv;
+void (APIENTRY *glPointParameteri)(GLenum pname, GLint param) = gl_lazy_glPointParameteri;
+void (APIENTRY *glPointParameteriv)(GLenum pname, const GLint * params) = gl_lazy_glPointParameteriv;
+void (APIENTRY *glBlendColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) = gl_lazy_glBlendColor;
+void (APIENTRY *glBlendEquation)(GLenum mode) = gl_lazy_glBlendEquation;
+void (APIENTRY *glGenQueries)(GLsizei n, GLuint * ids) = gl_lazy_glGenQueries;
+void (APIENTRY *glDeleteQueries)(GLsizei n, const GLuint * ids) = gl_lazy_glDeleteQueries;
+GLboolean (APIENTRY *glIsQuery)(GLuint id) = gl_lazy_glIsQuery;
+void (APIENTRY *glBeginQuery)(GLenum target, GLuint id) = gl_lazy_glBeginQuery;
+void (APIENTRY *glEndQuery)(GLenum target) = gl_lazy_glEndQuery;
+void (APIENTRY *glGetQueryiv)(GLenum target, GLenum pname, GLint * params) = gl_lazy_glGetQueryiv;
+void (APIENTRY *glGetQueryObjectiv)(GLuint id, GLenum pname, GLint * params) = gl_lazy_glGetQueryObjectiv;
+void (APIENTRY *glGetQueryObjectuiv)(GLuint id, GLenum pname, GLuint * params) = gl_lazy_glGetQueryObjectuiv;
+void (APIENTRY *glBindBuffer)(GLenum target, GLuint buffer) = gl_lazy_glBindBuffer;
+void (APIENTRY *glDeleteBuffers)(GLsizei n, const GLuint * buffers) = gl_lazy_glDeleteBuffers;
+void (APIENTRY *glGenBuffers)(GLsizei n, GLuint * buffers) = gl_lazy_glGenBuffers;
+GLboolean (APIENTRY *glIsBuffer)(GLuint buffer) = gl_lazy_glIsBuffer;
+void (APIENTRY *glBufferData)(GLenum target, GLsizeiptr size, const void * data, GLenum usage) = gl_lazy_glBufferData;
+void (APIENTRY *glBufferSubData)(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) = gl_lazy_glBufferSubData;
+void (APIENTRY *glGetBufferSubData)(GLenum target, GLintptr offset, GLsizeiptr size, void * data) = gl_lazy_glGetBufferSubData;
+void * (APIENTRY *glMapBuffer)(GLenum target, GLenum access) = gl_lazy_glMapBuffer;
+GLboolean (APIENTRY *glUnmapBuffer)(GLenum target) = gl_lazy_glUnmapBuffer;
+void (APIENTRY *glGetBufferParameteriv)(GLenum target, GLenum pname, GLint * params) = gl_lazy_glGetBufferParameteriv;
+void (APIENTRY *glGetBufferPointerv)(GLenum target, GLenum pname, void ** params) = gl_lazy_glGetBufferPointerv;
+void (APIENTRY *glBlendEquationSeparate)(GLenum modeRGB, GLenum modeAlpha) = gl_lazy_glBlendEquationSeparate;
+void (APIENTRY *glDrawBuffers)(GLsizei n, const GLenum * bufs) = gl_lazy_glDrawBuffers;
+void (APIENTRY *glStencilOpSeparate)(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) = gl_lazy_glStencilOpSeparate;
+void (APIENTRY *glStencilFuncSeparate)(GLenum face, GLenum func, GLint ref, GLuint mask) = gl_lazy_glStencilFuncSeparate;
+void (APIENTRY *glStencilMaskSeparate)(GLenum face, GLuint mask) = gl_lazy_glStencilMaskSeparate;
+void (APIENTRY *glAttachShader)(GLuint program, GLuint shader) = gl_lazy_glAttachShader;
+void (APIENTRY *glBindAttribLocation)(GLuint program, GLuint index, const GLchar * name) = gl_lazy_glBindAttribLocation;
+void (APIENTRY *glCompileShader)(GLuint shader) = gl_lazy_glCompileShader;
+GLuint (APIENTRY *glCreateProgram)() = gl_lazy_glCreateProgram;
+GLuint (APIENTRY *glCreateShader)(GLenum type) = gl_lazy_glCreateShader;
+void (APIENTRY *glDeleteProgram)(GLuint program) = gl_lazy_glDeleteProgram;
+void (APIENTRY *glDeleteShader)(GLuint shader) = gl_lazy_glDeleteShader;
+void (APIENTRY *glDetachShader)(GLuint program, GLuint shader) = gl_lazy_glDetachShader;
+void (APIENTRY *glDisableVertexAttribArray)(GLuint index) = gl_lazy_glDisableVertexAttribArray;
+void (APIENTRY *glEnableVertexAttribArray)(GLuint index) = gl_lazy_glEnableVertexAttribArray;
+void (APIENTRY *glGetActiveAttrib)(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) = gl_lazy_glGetActiveAttrib;
+void (APIENTRY *glGetActiveUniform)(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) = gl_lazy_glGetActiveUniform;
+void (APIENTRY *glGetAttachedShaders)(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) = gl_lazy_glGetAttachedShaders;
+GLint (APIENTRY *glGetAttribLocation)(GLuint program, const GLchar * name) = gl_lazy_glGetAttribLocation;
+void (APIENTRY *glGetProgramiv)(GLuint program, GLenum pname, GLint * params) = gl_lazy_glGetProgramiv;
+void (APIENTRY *glGetProgramInfoLog)(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) = gl_lazy_glGetProgramInfoLog;
+void (APIENTRY *glGetShaderiv)(GLuint shader, GLenum pname, GLint * params) = gl_lazy_glGetShaderiv;
+void (APIENTRY *glGetShaderInfoLog)(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) = gl_lazy_glGetShaderInfoLog;
+void (APIENTRY *glGetShaderSource)(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) = gl_lazy_glGetShaderSource;
+GLint (APIENTRY *glGetUniformLocation)(GLuint program, const GLchar * name) = gl_lazy_glGetUniformLocation;
+void (APIENTRY *glGetUniformfv)(GLuint program, GLint location, GLfloat * params) = gl_lazy_glGetUniformfv;
+void (APIENTRY *glGetUniformiv)(GLuint program, GLint location, GLint * params) = gl_lazy_glGetUniformiv;
+void (APIENTRY *glGetVertexAttribdv)(GLuint index, GLenum pname, GLdouble * params) = gl_lazy_glGetVertexAttribdv;
+void (APIENTRY *glGetVertexAttribfv)(GLuint index, GLenum pname, GLfloat * params) = gl_lazy_glGetVertexAttribfv;
+void (APIENTRY *glGetVertexAttribiv)(GLuint index, GLenum pname, GLint * params) = gl_lazy_glGetVertexAttribiv;
+void (APIENTRY *glGetVertexAttribPointerv)(GLuint index, GLenum pname, void ** pointer) = gl_lazy_glGetVertexAttribPointerv;
+GLboolean (APIENTRY *glIsProgram)(GLuint program) = gl_lazy_glIsProgram;
+GLboolean (APIENTRY *glIsShader)(GLuint shader) = gl_lazy_glIsShader;
+void (APIENTRY *glLinkProgram)(GLuint program) = gl_lazy_glLinkProgram;
+void (APIENTRY *glShaderSource)(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) = gl_lazy_glShaderSource;
+void (APIENTRY *glUseProgram)(GLuint program) = gl_lazy_glUseProgram;
+void (APIENTRY *glUniform1f)(GLint location, GLfloat v0) = gl_lazy_glUniform1f;
+void (APIENTRY *glUniform2f)(GLint location, GLfloat v0, GLfloat v1) = gl_lazy_glUniform2f;
+void (APIENTRY *glUniform3f)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) = gl_lazy_glUniform3f;
+void (APIENTRY *glUniform4f)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) = gl_lazy_glUniform4f;
+void (APIENTRY *glUniform1i)(GLint location, GLint v0) = gl_lazy_glUniform1i;
+void (APIENTRY *glUniform2i)(GLint location, GLint v0, GLint v1) = gl_lazy_glUniform2i;
+void (APIENTRY *glUniform3i)(GLint location, GLint v0, GLint v1, GLint v2) = gl_lazy_glUniform3i;
+void (APIENTRY *glUniform4i)(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) = gl_lazy_glUniform4i;
+void (APIENTRY *glUniform1fv)(GLint location, GLsizei count, const GLfloat * value) = gl_lazy_glUniform1fv;
+void (APIENTRY *glUniform2fv)(GLint location, GLsizei count, const GLfloat * value) = gl_lazy_glUniform2fv;
+void (APIENTRY *glUniform3fv)(GLint location, GLsizei count, const GLfloat * value) = gl_lazy_glUniform3fv;
+void (APIENTRY *glUniform4fv)(GLint location, GLsizei count, const GLfloat * value) = gl_lazy_glUniform4fv;
+void (APIENTRY *glUniform1iv)(GLint location, GLsizei count, const GLint * value) = gl_lazy_glUniform1iv;
+void (APIENTRY *glUniform2iv)(GLint location, GLsizei count, const GLint * value) = gl_lazy_glUniform2iv;
+void (APIENTRY *glUniform3iv)(GLint location, GLsizei count, const GLint * value) = gl_lazy_glUniform3iv;
+void (APIENTRY *glUniform4iv)(GLint location, GLsizei count, const GLint * value) = gl_lazy_glUniform4iv;
+void (APIENTRY *glUniformMatrix2fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix2fv;
+void (APIENTRY *glUniformMatrix3fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix3fv;
+void (APIENTRY *glUniformMatrix4fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix4fv;
+void (APIENTRY *glValidateProgram)(GLuint program) = gl_lazy_glValidateProgram;
+void (APIENTRY *glVertexAttrib1d)(GLuint index, GLdouble x) = gl_lazy_glVertexAttrib1d;
+void (APIENTRY *glVertexAttrib1dv)(GLuint index, const GLdouble * v) = gl_lazy_glVertexAttrib1dv;
+void (APIENTRY *glVertexAttrib1f)(GLuint index, GLfloat x) = gl_lazy_glVertexAttrib1f;
+void (APIENTRY *glVertexAttrib1fv)(GLuint index, const GLfloat * v) = gl_lazy_glVertexAttrib1fv;
+void (APIENTRY *glVertexAttrib1s)(GLuint index, GLshort x) = gl_lazy_glVertexAttrib1s;
+void (APIENTRY *glVertexAttrib1sv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttrib1sv;
+void (APIENTRY *glVertexAttrib2d)(GLuint index, GLdouble x, GLdouble y) = gl_lazy_glVertexAttrib2d;
+void (APIENTRY *glVertexAttrib2dv)(GLuint index, const GLdouble * v) = gl_lazy_glVertexAttrib2dv;
+void (APIENTRY *glVertexAttrib2f)(GLuint index, GLfloat x, GLfloat y) = gl_lazy_glVertexAttrib2f;
+void (APIENTRY *glVertexAttrib2fv)(GLuint index, const GLfloat * v) = gl_lazy_glVertexAttrib2fv;
+void (APIENTRY *glVertexAttrib2s)(GLuint index, GLshort x, GLshort y) = gl_lazy_glVertexAttrib2s;
+void (APIENTRY *glVertexAttrib2sv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttrib2sv;
+void (APIENTRY *glVertexAttrib3d)(GLuint index, GLdouble x, GLdouble y, GLdouble z) = gl_lazy_glVertexAttrib3d;
+void (APIENTRY *glVertexAttrib3dv)(GLuint index, const GLdouble * v) = gl_lazy_glVertexAttrib3dv;
+void (APIENTRY *glVertexAttrib3f)(GLuint index, GLfloat x, GLfloat y, GLfloat z) = gl_lazy_glVertexAttrib3f;
+void (APIENTRY *glVertexAttrib3fv)(GLuint index, const GLfloat * v) = gl_lazy_glVertexAttrib3fv;
+void (APIENTRY *glVertexAttrib3s)(GLuint index, GLshort x, GLshort y, GLshort z) = gl_lazy_glVertexAttrib3s;
+void (APIENTRY *glVertexAttrib3sv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttrib3sv;
+void (APIENTRY *glVertexAttrib4Nbv)(GLuint index, const GLbyte * v) = gl_lazy_glVertexAttrib4Nbv;
+void (APIENTRY *glVertexAttrib4Niv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttrib4Niv;
+void (APIENTRY *glVertexAttrib4Nsv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttrib4Nsv;
+void (APIENTRY *glVertexAttrib4Nub)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) = gl_lazy_glVertexAttrib4Nub;
+void (APIENTRY *glVertexAttrib4Nubv)(GLuint index, const GLubyte * v) = gl_lazy_glVertexAttrib4Nubv;
+void (APIENTRY *glVertexAttrib4Nuiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttrib4Nuiv;
+void (APIENTRY *glVertexAttrib4Nusv)(GLuint index, const GLushort * v) = gl_lazy_glVertexAttrib4Nusv;
+void (APIENTRY *glVertexAttrib4bv)(GLuint index, const GLbyte * v) = gl_lazy_glVertexAttrib4bv;
+void (APIENTRY *glVertexAttrib4d)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) = gl_lazy_glVertexAttrib4d;
+void (APIENTRY *glVertexAttrib4dv)(GLuint index, const GLdouble * v) = gl_lazy_glVertexAttrib4dv;
+void (APIENTRY *glVertexAttrib4f)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) = gl_lazy_glVertexAttrib4f;
+void (APIENTRY *glVertexAttrib4fv)(GLuint index, const GLfloat * v) = gl_lazy_glVertexAttrib4fv;
+void (APIENTRY *glVertexAttrib4iv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttrib4iv;
+void (APIENTRY *glVertexAttrib4s)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) = gl_lazy_glVertexAttrib4s;
+void (APIENTRY *glVertexAttrib4sv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttrib4sv;
+void (APIENTRY *glVertexAttrib4ubv)(GLuint index, const GLubyte * v) = gl_lazy_glVertexAttrib4ubv;
+void (APIENTRY *glVertexAttrib4uiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttrib4uiv;
+void (APIENTRY *glVertexAttrib4usv)(GLuint index, const GLushort * v) = gl_lazy_glVertexAttrib4usv;
+void (APIENTRY *glVertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) = gl_lazy_glVertexAttribPointer;
+void (APIENTRY *glUniformMatrix2x3fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix2x3fv;
+void (APIENTRY *glUniformMatrix3x2fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix3x2fv;
+void (APIENTRY *glUniformMatrix2x4fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix2x4fv;
+void (APIENTRY *glUniformMatrix4x2fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix4x2fv;
+void (APIENTRY *glUniformMatrix3x4fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix3x4fv;
+void (APIENTRY *glUniformMatrix4x3fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) = gl_lazy_glUniformMatrix4x3fv;
+void (APIENTRY *glColorMaski)(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) = gl_lazy_glColorMaski;
+void (APIENTRY *glGetBooleani_v)(GLenum target, GLuint index, GLboolean * data) = gl_lazy_glGetBooleani_v;
+void (APIENTRY *glGetIntegeri_v)(GLenum target, GLuint index, GLint * data) = gl_lazy_glGetIntegeri_v;
+void (APIENTRY *glEnablei)(GLenum target, GLuint index) = gl_lazy_glEnablei;
+void (APIENTRY *glDisablei)(GLenum target, GLuint index) = gl_lazy_glDisablei;
+GLboolean (APIENTRY *glIsEnabledi)(GLenum target, GLuint index) = gl_lazy_glIsEnabledi;
+void (APIENTRY *glBeginTransformFeedback)(GLenum primitiveMode) = gl_lazy_glBeginTransformFeedback;
+void (APIENTRY *glEndTransformFeedback)() = gl_lazy_glEndTransformFeedback;
+void (APIENTRY *glBindBufferRange)(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) = gl_lazy_glBindBufferRange;
+void (APIENTRY *glBindBufferBase)(GLenum target, GLuint index, GLuint buffer) = gl_lazy_glBindBufferBase;
+void (APIENTRY *glTransformFeedbackVaryings)(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) = gl_lazy_glTransformFeedbackVaryings;
+void (APIENTRY *glGetTransformFeedbackVarying)(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) = gl_lazy_glGetTransformFeedbackVarying;
+void (APIENTRY *glClampColor)(GLenum target, GLenum clamp) = gl_lazy_glClampColor;
+void (APIENTRY *glBeginConditionalRender)(GLuint id, GLenum mode) = gl_lazy_glBeginConditionalRender;
+void (APIENTRY *glEndConditionalRender)() = gl_lazy_glEndConditionalRender;
+void (APIENTRY *glVertexAttribIPointer)(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) = gl_lazy_glVertexAttribIPointer;
+void (APIENTRY *glGetVertexAttribIiv)(GLuint index, GLenum pname, GLint * params) = gl_lazy_glGetVertexAttribIiv;
+void (APIENTRY *glGetVertexAttribIuiv)(GLuint index, GLenum pname, GLuint * params) = gl_lazy_glGetVertexAttribIuiv;
+void (APIENTRY *glVertexAttribI1i)(GLuint index, GLint x) = gl_lazy_glVertexAttribI1i;
+void (APIENTRY *glVertexAttribI2i)(GLuint index, GLint x, GLint y) = gl_lazy_glVertexAttribI2i;
+void (APIENTRY *glVertexAttribI3i)(GLuint index, GLint x, GLint y, GLint z) = gl_lazy_glVertexAttribI3i;
+void (APIENTRY *glVertexAttribI4i)(GLuint index, GLint x, GLint y, GLint z, GLint w) = gl_lazy_glVertexAttribI4i;
+void (APIENTRY *glVertexAttribI1ui)(GLuint index, GLuint x) = gl_lazy_glVertexAttribI1ui;
+void (APIENTRY *glVertexAttribI2ui)(GLuint index, GLuint x, GLuint y) = gl_lazy_glVertexAttribI2ui;
+void (APIENTRY *glVertexAttribI3ui)(GLuint index, GLuint x, GLuint y, GLuint z) = gl_lazy_glVertexAttribI3ui;
+void (APIENTRY *glVertexAttribI4ui)(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) = gl_lazy_glVertexAttribI4ui;
+void (APIENTRY *glVertexAttribI1iv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttribI1iv;
+void (APIENTRY *glVertexAttribI2iv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttribI2iv;
+void (APIENTRY *glVertexAttribI3iv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttribI3iv;
+void (APIENTRY *glVertexAttribI4iv)(GLuint index, const GLint * v) = gl_lazy_glVertexAttribI4iv;
+void (APIENTRY *glVertexAttribI1uiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttribI1uiv;
+void (APIENTRY *glVertexAttribI2uiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttribI2uiv;
+void (APIENTRY *glVertexAttribI3uiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttribI3uiv;
+void (APIENTRY *glVertexAttribI4uiv)(GLuint index, const GLuint * v) = gl_lazy_glVertexAttribI4uiv;
+void (APIENTRY *glVertexAttribI4bv)(GLuint index, const GLbyte * v) = gl_lazy_glVertexAttribI4bv;
+void (APIENTRY *glVertexAttribI4sv)(GLuint index, const GLshort * v) = gl_lazy_glVertexAttribI4sv;
+void (APIENTRY *glVertexAttribI4ubv)(GLuint index, const GLubyte * v) = gl_lazy_glVertexAttribI4ubv;
+void (APIENTRY *glVertexAttribI4usv)(GLuint index, const GLushort * v) = gl_lazy_glVertexAttribI4usv;
+void (APIENTRY *glGetUniformuiv)(GLuint program, GLint location, GLuint * params) = gl_lazy_glGetUniformuiv;
+void (APIENTRY *glBindFragDataLocation)(GLuint program, GLuint color, const GLchar * name) = gl_lazy_glBindFragDataLocation;
+GLint (APIENTRY *glGetFragDataLocation)(GLuint program, const GLchar * name) = gl_lazy_glGetFragDataLocation;
+void (APIENTRY *glUniform1ui)(GLint location, GLuint v0) = gl_lazy_glUniform1ui;
+void (APIENTRY *glUniform2ui)(GLint location, GLuint v0, GLuint v1) = gl_lazy_glUniform2ui;
+void (APIENTRY *glUniform3ui)(GLint location, GLuint v0, GLuint v1, GLuint v2) = gl_lazy_glUniform3ui;
+void (APIENTRY *glUniform4ui)(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) = gl_lazy_glUniform4ui;
+void (APIENTRY *glUniform1uiv)(GLint location, GLsizei count, const GLuint * value) = gl_lazy_glUniform1uiv;
+void (APIENTRY *glUniform2uiv)(GLint location, GLsizei count, const GLuint * value) = gl_lazy_glUniform2uiv;
+void (APIENTRY *glUniform3uiv)(GLint location, GLsizei count, const GLuint * value) = gl_lazy_glUniform3uiv;
+void (APIENTRY *glUniform4uiv)(GLint location, GLsizei count, const GLuint * value) = gl_lazy_glUniform4uiv;
+void (APIENTRY *glTexParameterIiv)(GLenum target, GLenum pname, const GLint * params) = gl_lazy_glTexParameterIiv;
+void (APIENTRY *glTexParameterIuiv)(GLenum target, GLenum pname, const GLuint * params) = gl_lazy_glTexParameterIuiv;
+void (APIENTRY *glGetTexParameterIiv)(GLenum target, GLenum pname, GLint * params) = gl_lazy_glGetTexParameterIiv;
+void (APIENTRY *glGetTexParameterIuiv)(GLenum target, GLenum pname, GLuint * params) = gl_lazy_glGetTexParameterIuiv;
+void (APIENTRY *glClearBufferiv)(GLenum buffer, GLint drawbuffer, const GLint * value) = gl_lazy_glClearBufferiv;
+void (APIENTRY *glClearBufferuiv)(GLenum buffer, GLint drawbuffer, const GLuint * value) = gl_lazy_glClearBufferuiv;
+void (APIENTRY *glClearBufferfv)(GLenum buffer, GLint drawbuffer, const GLfloat * value) = gl_lazy_glClearBufferfv;
+void (APIENTRY *glClearBufferfi)(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) = gl_lazy_glClearBufferfi;
+const GLubyte * (APIENTRY *glGetStringi)(GLenum name, GLuint index) = gl_lazy_glGetStringi;
+GLboolean (APIENTRY *glIsRenderbuffer)(GLuint renderbuffer) = gl_lazy_glIsRenderbuffer;
+void (APIENTRY *glBindRenderbuffer)(GLenum target, GLuint renderbuffer) = gl_lazy_glBindRenderbuffer;
+void (APIENTRY *glDeleteRenderbuffers)(GLsizei n, const GLuint * renderbuffers) = gl_lazy_glDeleteRenderbuffers;
+void (APIENTRY *glGenRenderbuffers)(GLsizei n, GLuint * renderbuffers) = gl_lazy_glGenRenderbuffers;
+void (APIENTRY *glRenderbufferStorage)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) = gl_lazy_glRenderbufferStorage;
+void (APIENTRY *glGetRenderbufferParameteriv)(GLenum target, GLenum pname, GLint * params) = gl_lazy_glGetRenderbufferParameteriv;
+GLboolean (APIENTRY *glIsFramebuffer)(GLuint framebuffer) = gl_lazy_glIsFramebuffer;
+void (APIENTRY *glBindFramebuffer)(GLenum target, GLuint framebuffer) = gl_lazy_glBindFramebuffer;
+void (APIENTRY *glDeleteFramebuffers)(GLsizei n, const GLuint * framebuffers) = gl_lazy_glDeleteFramebuffers;
+void (APIENTRY *glGenFramebuffers)(GLsizei n, GLuint * framebuffers) = gl_lazy_glGenFramebuffers;
+GLenum (APIENTRY *glCheckFramebufferStatus)(GLenum target) = gl_lazy_glCheckFramebufferStatus;
+void (APIENTRY *glFramebufferTexture1D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) = gl_lazy_glFramebufferTexture1D;
+void (APIENTRY *glFramebufferTexture2D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) = gl_lazy_glFramebufferTexture2D;
+void (APIENTRY *glFramebufferTexture3D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) = gl_lazy_glFramebufferTexture3D;
+void (APIENTRY *glFramebufferRenderbuffer)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) = gl_lazy_glFramebufferRenderbuffer;
+void (APIENTRY *glGetFramebufferAttachmentParameteriv)(GLenum target, GLenum attachment, GLenum pname, GLint * params) = gl_lazy_glGetFramebufferAttachmentParameteriv;
+void (APIENTRY *glGenerateMipmap)(GLenum target) = gl_lazy_glGenerateMipmap;
+void (APIENTRY *glBlitFramebuffer)(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) = gl_lazy_glBlitFramebuffer;
+void (APIENTRY *glRenderbufferStorageMultisample)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) = gl_lazy_glRenderbufferStorageMultisample;
+void (APIENTRY *glFramebufferTextureLayer)(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) = gl_lazy_glFramebufferTextureLayer;
+void * (APIENTRY *glMapBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) = gl_lazy_glMapBufferRange;
+void (APIENTRY *glFlushMappedBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length) = gl_lazy_glFlushMappedBufferRange;
+void (APIENTRY *glBindVertexArray)(GLuint array) = gl_lazy_glBindVertexArray;
+void (APIENTRY *glDeleteVertexArrays)(GLsizei n, const GLuint * arrays) = gl_lazy_glDeleteVertexArrays;
+void (APIENTRY *glGenVertexArrays)(GLsizei n, GLuint * arrays) = gl_lazy_glGenVertexArrays;
+GLboolean (APIENTRY *glIsVertexArray)(GLuint array) = gl_lazy_glIsVertexArray;
+void (APIENTRY *glDrawArraysInstanced)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) = gl_lazy_glDrawArraysInstanced;
+void (APIENTRY *glDrawElementsInstanced)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) = gl_lazy_glDrawElementsInstanced;
+void (APIENTRY *glTexBuffer)(GLenum target, GLenum internalformat, GLuint buffer) = gl_lazy_glTexBuffer;
+void (APIENTRY *glPrimitiveRestartIndex)(GLuint index) = gl_lazy_glPrimitiveRestartIndex;
+void (APIENTRY *glCopyBufferSubData)(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) = gl_lazy_glCopyBufferSubData;
+void (APIENTRY *glGetUniformIndices)(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) = gl_lazy_glGetUniformIndices;
+void (APIENTRY *glGetActiveUniformsiv)(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) = gl_lazy_glGetActiveUniformsiv;
+void (APIENTRY *glGetActiveUniformName)(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) = gl_lazy_glGetActiveUniformName;
+GLuint (APIENTRY *glGetUniformBlockIndex)(GLuint program, const GLchar * uniformBlockName) = gl_lazy_glGetUniformBlockIndex;
+void (APIENTRY *glGetActiveUniformBlockiv)(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) = gl_lazy_glGetActiveUniformBlockiv;
+void (APIENTRY *glGetActiveUniformBlockName)(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) = gl_lazy_glGetActiveUniformBlockName;
+void (APIENTRY *glUniformBlockBinding)(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) = gl_lazy_glUniformBlockBinding;
+void (APIENTRY *glDrawElementsBaseVertex)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) = gl_lazy_glDrawElementsBaseVertex;
+void (APIENTRY *glDrawRangeElementsBaseVertex)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) = gl_lazy_glDrawRangeElementsBaseVertex;
+void (APIENTRY *glDrawElementsInstancedBaseVertex)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) = gl_lazy_glDrawElementsInstancedBaseVertex;
+void (APIENTRY *glMultiDrawElementsBaseVertex)(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) = gl_lazy_glMultiDrawElementsBaseVertex;
+void (APIENTRY *glProvokingVertex)(GLenum mode) = gl_lazy_glProvokingVertex;
+GLsync (APIENTRY *glFenceSync)(GLenum condition, GLbitfield flags) = gl_lazy_glFenceSync;
+GLboolean (APIENTRY *glIsSync)(GLsync sync) = gl_lazy_glIsSync;
+void (APIENTRY *glDeleteSync)(GLsync sync) = gl_lazy_glDeleteSync;
+GLenum (APIENTRY *glClientWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout) = gl_lazy_glClientWaitSync;
+void (APIENTRY *glWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout) = gl_lazy_glWaitSync;
+void (APIENTRY *glGetInteger64v)(GLenum pname, GLint64 * data) = gl_lazy_glGetInteger64v;
+void (APIENTRY *glGetSynciv)(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values) = gl_lazy_glGetSynciv;
+void (APIENTRY *glGetInteger64i_v)(GLenum target, GLuint index, GLint64 * data) = gl_lazy_glGetInteger64i_v;
+void (APIENTRY *glGetBufferParameteri64v)(GLenum target, GLenum pname, GLint64 * params) = gl_lazy_glGetBufferParameteri64v;
+void (APIENTRY *glFramebufferTexture)(GLenum target, GLenum attachment, GLuint texture, GLint level) = gl_lazy_glFramebufferTexture;
+void (APIENTRY *glTexImage2DMultisample)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) = gl_lazy_glTexImage2DMultisample;
+void (APIENTRY *glTexImage3DMultisample)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) = gl_lazy_glTexImage3DMultisample;
+void (APIENTRY *glGetMultisamplefv)(GLenum pname, GLuint index, GLfloat * val) = gl_lazy_glGetMultisamplefv;
+void (APIENTRY *glSampleMaski)(GLuint maskNumber, GLbitfield mask) = gl_lazy_glSampleMaski;
+void (APIENTRY *glBindFragDataLocationIndexed)(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) = gl_lazy_glBindFragDataLocationIndexed;
+GLint (APIENTRY *glGetFragDataIndex)(GLuint program, const GLchar * name) = gl_lazy_glGetFragDataIndex;
+void (APIENTRY *glGenSamplers)(GLsizei count, GLuint * samplers) = gl_lazy_glGenSamplers;
+void (APIENTRY *glDeleteSamplers)(GLsizei count, const GLuint * samplers) = gl_lazy_glDeleteSamplers;
+GLboolean (APIENTRY *glIsSampler)(GLuint sampler) = gl_lazy_glIsSampler;
+void (APIENTRY *glBindSampler)(GLuint unit, GLuint sampler) = gl_lazy_glBindSampler;
+void (APIENTRY *glSamplerParameteri)(GLuint sampler, GLenum pname, GLint param) = gl_lazy_glSamplerParameteri;
+void (APIENTRY *glSamplerParameteriv)(GLuint sampler, GLenum pname, const GLint * param) = gl_lazy_glSamplerParameteriv;
+void (APIENTRY *glSamplerParameterf)(GLuint sampler, GLenum pname, GLfloat param) = gl_lazy_glSamplerParameterf;
+void (APIENTRY *glSamplerParameterfv)(GLuint sampler, GLenum pname, const GLfloat * param) = gl_lazy_glSamplerParameterfv;
+void (APIENTRY *glSamplerParameterIiv)(GLuint sampler, GLenum pname, const GLint * param) = gl_lazy_glSamplerParameterIiv;
+void (APIENTRY *glSamplerParameterIuiv)(GLuint sampler, GLenum pname, const GLuint * param) = gl_lazy_glSamplerParameterIuiv;
+void (APIENTRY *glGetSamplerParameteriv)(GLuint sampler, GLenum pname, GLint * params) = gl_lazy_glGetSamplerParameteriv;
+void (APIENTRY *glGetSamplerParameterIiv)(GLuint sampler, GLenum pname, GLint * params) = gl_lazy_glGetSamplerParameterIiv;
+void (APIENTRY *glGetSamplerParameterfv)(GLuint sampler, GLenum pname, GLfloat * params) = gl_lazy_glGetSamplerParameterfv;
+void (APIENTRY *glGetSamplerParameterIuiv)(GLuint sampler, GLenum pname, GLuint * params) = gl_lazy_glGetSamplerParameterIuiv;
+void (APIENTRY *glQueryCounter)(GLuint id, GLenum target) = gl_lazy_glQueryCounter;
+void (APIENTRY *glGetQueryObjecti64v)(GLuint id, GLenum pname, GLint64 * params) = gl_lazy_glGetQueryObjecti64v;
+void (APIENTRY *glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64 * params) = gl_lazy_glGetQueryObjectui64v;
+void (APIENTRY *glVertexAttribDivisor)(GLuint index, GLuint divisor) = gl_lazy_glVertexAttribDivisor;
+void (APIENTRY *glVertexAttribP1ui)(GLuint index, GLenum type, GLboolean normalized, GLuint value) = gl_lazy_glVertexAttribP1ui;
+void (APIENTRY *glVertexAttribP1uiv)(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) = gl_lazy_glVertexAttribP1uiv;
+void (APIENTRY *glVertexAttribP2ui)(GLuint index, GLenum type, GLboolean normalized, GLuint value) = gl_lazy_glVertexAttribP2ui;
+void (APIENTRY *glVertexAttribP2uiv)(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) = gl_lazy_glVertexAttribP2uiv;
+void (APIENTRY *glVertexAttribP3ui)(GLuint index, GLenum type, GLboolean normalized, GLuint value) = gl_lazy_glVertexAttribP3ui;
+void (APIENTRY *glVertexAttribP3uiv)(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) = gl_lazy_glVertexAttribP3uiv;
+void (APIENTRY *glVertexAttribP4ui)(GLuint index, GLenum type, GLboolean normalized, GLuint value) = gl_lazy_glVertexAttribP4ui;
+void (APIENTRY *glVertexAttribP4uiv)(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) = gl_lazy_glVertexAttribP4uiv;
+
+//point everything back at the stubs (for when the backend changes):
+static void gl_loader_reset() {
+	glCullFace = gl_lazy_glCullFace;
+	glFrontFace = gl_lazy_glFrontFace;
+	glHint = gl_lazy_glHint;
+	glLineWidth = gl_lazy_glLineWidth;
+	glPointSize = gl_lazy_glPointSize;
+	glPolygonMode = gl_lazy_glPolygonMode;
+	glScissor = gl_lazy_glScissor;
+	glTexParameterf = gl_lazy_glTexParameterf;
+	glTexParameterfv = gl_lazy_glTexParameterfv;
+	glTexParameteri = gl_lazy_glTexParameteri;
+	glTexParameteriv = gl_lazy_glTexParameteriv;
+	glTexImage1D = gl_lazy_glTexImage1D;
+	glTexImage2D = gl_lazy_glTexImage2D;
+	glDrawBuffer = gl_lazy_glDrawBuffer;
+	glClear = gl_lazy_glClear;
+	glClearColor = gl_lazy_glClearColor;
+	glClearStencil = gl_lazy_glClearStencil;
+	glClearDepth = gl_lazy_glClearDepth;
+	glStencilMask = gl_lazy_glStencilMask;
+	glColorMask = gl_lazy_glColorMask;
+	glDepthMask = gl_lazy_glDepthMask;
+	glDisable = gl_lazy_glDisable;
+	glEnable = gl_lazy_glEnable;
+	glFinish = gl_lazy_glFinish;
+	glFlush = gl_lazy_glFlush;
+	glBlendFunc = gl_lazy_glBlendFunc;
+	glLogicOp = gl_lazy_glLogicOp;
+	glStencilFunc = gl_lazy_glStencilFunc;
+	glStencilOp = gl_lazy_glStencilOp;
+	glDepthFunc = gl_lazy_glDepthFunc;
+	glPixelStoref = gl_lazy_glPixelStoref;
+	glPixelStorei = gl_lazy_glPixelStorei;
+	glReadBuffer = gl_lazy_glReadBuffer;
+	glReadPixels = gl_lazy_glReadPixels;
+	glGetBooleanv = gl_lazy_glGetBooleanv;
+	glGetDoublev = gl_lazy_glGetDoublev;
+	glGetError = gl_lazy_glGetError;
+	glGetFloatv = gl_lazy_glGetFloatv;
+	glGetIntegerv = gl_lazy_glGetIntegerv;
+	glGetString = gl_lazy_glGetString;
+	glGetTexImage = gl_lazy_glGetTexImage;
+	glGetTexParameterfv = gl_lazy_glGetTexParameterfv;
+	glGetTexParameteriv = gl_lazy_glGetTexParameteriv;
+	glGetTexLevelParameterfv = gl_lazy_glGetTexLevelParameterfv;
+	glGetTexLevelParameteriv = gl_lazy_glGetTexLevelParameteriv;
+	glIsEnabled = gl_lazy_glIsEnabled;
+	glDepthRange = gl_lazy_glDepthRange;
+	glViewport = gl_lazy_glViewport;
+	glDrawArrays = gl_lazy_glDrawArrays;
+	glDrawElements = gl_lazy_glDrawElements;
+	glGetPointerv = gl_lazy_glGetPointerv;
+	glPolygonOffset = gl_lazy_glPolygonOffset;
+	glCopyTexImage1D = gl_lazy_glCopyTexImage1D;
+	glCopyTexImage2D = gl_lazy_glCopyTexImage2D;
+	glCopyTexSubImage1D = gl_lazy_glCopyTexSubImage1D;
+	glCopyTexSubImage2D = gl_lazy_glCopyTexSubImage2D;
+	glTexSubImage1D = gl_lazy_glTexSubImage1D;
+	glTexSubImage2D = gl_lazy_glTexSubImage2D;
+	glBindTexture = gl_lazy_glBindTexture;
+	glDeleteTextures = gl_lazy_glDeleteTextures;
+	glGenTextures = gl_lazy_glGenTextures;
+	glIsTexture = gl_lazy_glIsTexture;
+	glDrawRangeElements = gl_lazy_glDrawRangeElements;
+	glTexImage3D = gl_lazy_glTexImage3D;
+	glTexSubImage3D = gl_lazy_glTexSubImage3D;
+	glCopyTexSubImage3D = gl_lazy_glCopyTexSubImage3D;
+	glActiveTexture = gl_lazy_glActiveTexture;
+	glSampleCoverage = gl_lazy_glSampleCoverage;
+	glCompressedTexImage3D = gl_lazy_glCompressedTexImage3D;
+	glCompressedTexImage2D = gl_lazy_glCompressedTexImage2D;
+	glCompressedTexImage1D = gl_lazy_glCompressedTexImage1D;
+	glCompressedTexSubImage3D = gl_lazy_glCompressedTexSubImage3D;
+	glCompressedTexSubImage2D = gl_lazy_glCompressedTexSubImage2D;
+	glCompressedTexSubImage1D = gl_lazy_glCompressedTexSubImage1D;
+	glGetCompressedTexImage = gl_lazy_glGetCompressedTexImage;
+	glBlendFuncSeparate = gl_lazy_glBlendFuncSeparate;
+	glMultiDrawArrays = gl_lazy_glMultiDrawArrays;
+	glMultiDrawElements = gl_lazy_glMultiDrawElements;
+	glPointParameterf = gl_lazy_glPointParameterf;
+	glPointParameterfv = gl_lazy_glPointParameterfv;
+	glPointParameteri = gl_lazy_glPointParameteri;
+	glPointParameteriv = gl_lazy_glPointParameteriv;
+	glBlendColor = gl_lazy_glBlendColor;
+	glBlendEquation = gl_lazy_glBlendEquation;
+	glGenQueries = gl_lazy_glGenQueries;
+	glDeleteQueries = gl_lazy_glDeleteQueries;
+	glIsQuery = gl_lazy_glIsQuery;
+	glBeginQuery = gl_lazy_glBeginQuery;
+	glEndQuery = gl_lazy_glEndQuery;
+	glGetQueryiv = gl_lazy_glGetQueryiv;
+	glGetQueryObjectiv = gl_lazy_glGetQueryObjectiv;
+	glGetQueryObjectuiv = gl_lazy_glGetQueryObjectuiv;
+	glBindBuffer = gl_lazy_glBindBuffer;
+	glDeleteBuffers = gl_lazy_glDeleteBuffers;
+	glGenBuffers = gl_lazy_glGenBuffers;
+	glIsBuffer = gl_lazy_glIsBuffer;
+	glBufferData = gl_lazy_glBufferData;
+	glBufferSubData = gl_lazy_glBufferSubData;
+	glGetBufferSubData = gl_lazy_glGetBufferSubData;
+	glMapBuffer = gl_lazy_glMapBuffer;
+	glUnmapBuffer = gl_lazy_glUnmapBuffer;
+	glGetBufferParameteriv = gl_lazy_glGetBufferParameteriv;
+	glGetBufferPointerv = gl_lazy_glGetBufferPointerv;
+	glBlendEquationSeparate = gl_lazy_glBlendEquationSeparate;
+	glDrawBuffers = gl_lazy_glDrawBuffers;
+	glStencilOpSeparate = gl_lazy_glStencilOpSeparate;
+	glStencilFuncSeparate = gl_lazy_glStencilFuncSeparate;
+	glStencilMaskSeparate = gl_lazy_glStencilMaskSeparate;
+	glAttachShader = gl_lazy_glAttachShader;
+	glBindAttribLocation = gl_lazy_glBindAttribLocation;
+	glCompileShader = gl_lazy_glCompileShader;
+	glCreateProgram = gl_lazy_glCreateProgram;
+	glCreateShader = gl_lazy_glCreateShader;
+	glDeleteProgram = gl_lazy_glDeleteProgram;
+	glDeleteShader = gl_lazy_glDeleteShader;
+	glDetachShader = gl_lazy_glDetachShader;
+	glDisableVertexAttribArray = gl_lazy_glDisableVertexAttribArray;
+	glEnableVertexAttribArray = gl_lazy_glEnableVertexAttribArray;
+	glGetActiveAttrib = gl_lazy_glGetActiveAttrib;
+	glGetActiveUniform = gl_lazy_glGetActiveUniform;
+	glGetAttachedShaders = gl_lazy_glGetAttachedShaders;
+	glGetAttribLocation = gl_lazy_glGetAttribLocation;
+	glGetProgramiv = gl_lazy_glGetProgramiv;
+	glGetProgramInfoLog = gl_lazy_glGetProgramInfoLog;
+	glGetShaderiv = gl_lazy_glGetShaderiv;
+	glGetShaderInfoLog = gl_lazy_glGetShaderInfoLog;
+	glGetShaderSource = gl_lazy_glGetShaderSource;
+	glGetUniformLocation = gl_lazy_glGetUniformLocation;
+	glGetUniformfv = gl_lazy_glGetUniformfv;
+	glGetUniformiv = gl_lazy_glGetUniformiv;
+	glGetVertexAttribdv = gl_lazy_glGetVertexAttribdv;
+	glGetVertexAttribfv = gl_lazy_glGetVertexAttribfv;
+	glGetVertexAttribiv = gl_lazy_glGetVertexAttribiv;
+	glGetVertexAttribPointerv = gl_lazy_glGetVertexAttribPointerv;
+	glIsProgram = gl_lazy_glIsProgram;
+	glIsShader = gl_lazy_glIsShader;
+	glLinkProgram = gl_lazy_glLinkProgram;
+	glShaderSource = gl_lazy_glShaderSource;
+	glUseProgram = gl_lazy_glUseProgram;
+	glUniform1f = gl_lazy_glUniform1f;
+	glUniform2f = gl_lazy_glUniform2f;
+	glUniform3f = gl_lazy_glUniform3f;
+	glUniform4f = gl_lazy_glUniform4f;
+	glUniform1i = gl_lazy_glUniform1i;
+	glUniform2i = gl_lazy_glUniform2i;
+	glUniform3i = gl_lazy_glUniform3i;
+	glUniform4i = gl_lazy_glUniform4i;
+	glUniform1fv = gl_lazy_glUniform1fv;
+	glUniform2fv = gl_lazy_glUniform2fv;
+	glUniform3fv = gl_lazy_glUniform3fv;
+	glUniform4fv = gl_lazy_glUniform4fv;
+	glUniform1iv = gl_lazy_glUniform1iv;
+	glUniform2iv = gl_lazy_glUniform2iv;
+	glUniform3iv = gl_lazy_glUniform3iv;
+	glUniform4iv = gl_lazy_glUniform4iv;
+	glUniformMatrix2fv = gl_lazy_glUniformMatrix2fv;
+	glUniformMatrix3fv = gl_lazy_glUniformMatrix3fv;
+	glUniformMatrix4fv = gl_lazy_glUniformMatrix4fv;
+	glValidateProgram = gl_lazy_glValidateProgram;
+	glVertexAttrib1d = gl_lazy_glVertexAttrib1d;
+	glVertexAttrib1dv = gl_lazy_glVertexAttrib1dv;
+	glVertexAttrib1f = gl_lazy_glVertexAttrib1f;
+	glVertexAttrib1fv = gl_lazy_glVertexAttrib1fv;
+	glVertexAttrib1s = gl_lazy_glVertexAttrib1s;
+	glVertexAttrib1sv = gl_lazy_glVertexAttrib1sv;
+	glVertexAttrib2d = gl_lazy_glVertexAttrib2d;
+	glVertexAttrib2dv = gl_lazy_glVertexAttrib2dv;
+	glVertexAttrib2f = gl_lazy_glVertexAttrib2f;
+	glVertexAttrib2fv = gl_lazy_glVertexAttrib2fv;
+	glVertexAttrib2s = gl_lazy_glVertexAttrib2s;
+	glVertexAttrib2sv = gl_lazy_glVertexAttrib2sv;
+	glVertexAttrib3d = gl_lazy_glVertexAttrib3d;
+	glVertexAttrib3dv = gl_lazy_glVertexAttrib3dv;
+	glVertexAttrib3f = gl_lazy_glVertexAttrib3f;
+	glVertexAttrib3fv = gl_lazy_glVertexAttrib3fv;
+	glVertexAttrib3s = gl_lazy_glVertexAttrib3s;
+	glVertexAttrib3sv = gl_lazy_glVertexAttrib3sv;
+	glVertexAttrib4Nbv = gl_lazy_glVertexAttrib4Nbv;
+	glVertexAttrib4Niv = gl_lazy_glVertexAttrib4Niv;
+	glVertexAttrib4Nsv = gl_lazy_glVertexAttrib4Nsv;
+	glVertexAttrib4Nub = gl_lazy_glVertexAttrib4Nub;
+	glVertexAttrib4Nubv = gl_lazy_glVertexAttrib4Nubv;
+	glVertexAttrib4Nuiv = gl_lazy_glVertexAttrib4Nuiv;
+	glVertexAttrib4Nusv = gl_lazy_glVertexAttrib4Nusv;
+	glVertexAttrib4bv = gl_lazy_glVertexAttrib4bv;
+	glVertexAttrib4d = gl_lazy_glVertexAttrib4d;
+	glVertexAttrib4dv = gl_lazy_glVertexAttrib4dv;
+	glVertexAttrib4f = gl_lazy_glVertexAttrib4f;
+	glVertexAttrib4fv = gl_lazy_glVertexAttrib4fv;
+	glVertexAttrib4iv = gl_lazy_glVertexAttrib4iv;
+	glVertexAttrib4s = gl_lazy_glVertexAttrib4s;
+	glVertexAttrib4sv = gl_lazy_glVertexAttrib4sv;
+	glVertexAttrib4ubv = gl_lazy_glVertexAttrib4ubv;
+	glVertexAttrib4uiv = gl_lazy_glVertexAttrib4uiv;
+	glVertexAttrib4usv = gl_lazy_glVertexAttrib4usv;
+	glVertexAttribPointer = gl_lazy_glVertexAttribPointer;
+	glUniformMatrix2x3fv = gl_lazy_glUniformMatrix2x3fv;
+	glUniformMatrix3x2fv = gl_lazy_glUniformMatrix3x2fv;
+	glUniformMatrix2x4fv = gl_lazy_glUniformMatrix2x4fv;
+	glUniformMatrix4x2fv = gl_lazy_glUniformMatrix4x2fv;
+	glUniformMatrix3x4fv = gl_lazy_glUniformMatrix3x4fv;
+	glUniformMatrix4x3fv = gl_lazy_glUniformMatrix4x3fv;
+	glColorMaski = gl_lazy_glColorMaski;
+	glGetBooleani_v = gl_lazy_glGetBooleani_v;
+	glGetIntegeri_v = gl_lazy_glGetIntegeri_v;
+	glEnablei = gl_lazy_glEnablei;
+	glDisablei = gl_lazy_glDisablei;
+	glIsEnabledi = gl_lazy_glIsEnabledi;
+	glBeginTransformFeedback = gl_lazy_glBeginTransformFeedback;
+	glEndTransformFeedback = gl_lazy_glEndTransformFeedback;
+	glBindBufferRange = gl_lazy_glBindBufferRange;
+	glBindBufferBase = gl_lazy_glBindBufferBase;
+	glTransformFeedbackVaryings = gl_lazy_glTransformFeedbackVaryings;
+	glGetTransformFeedbackVarying = gl_lazy_glGetTransformFeedbackVarying;
+	glClampColor = gl_lazy_glClampColor;
+	glBeginConditionalRender = gl_lazy_glBeginConditionalRender;
+	glEndConditionalRender = gl_lazy_glEndConditionalRender;
+	glVertexAttribIPointer = gl_lazy_glVertexAttribIPointer;
+	glGetVertexAttribIiv = gl_lazy_glGetVertexAttribIiv;
+	glGetVertexAttribIuiv = gl_lazy_glGetVertexAttribIuiv;
+	glVertexAttribI1i = gl_lazy_glVertexAttribI1i;
+	glVertexAttribI2i = gl_lazy_glVertexAttribI2i;
+	glVertexAttribI3i = gl_lazy_glVertexAttribI3i;
+	glVertexAttribI4i = gl_lazy_glVertexAttribI4i;
+	glVertexAttribI1ui = gl_lazy_glVertexAttribI1ui;
+	glVertexAttribI2ui = gl_lazy_glVertexAttribI2ui;
+	glVertexAttribI3ui = gl_lazy_glVertexAttribI3ui;
+	glVertexAttribI4ui = gl_lazy_glVertexAttribI4ui;
+	glVertexAttribI1iv = gl_lazy_glVertexAttribI1iv;
+	glVertexAttribI2iv = gl_lazy_glVertexAttribI2iv;
+	glVertexAttribI3iv = gl_lazy_glVertexAttribI3iv;
+	glVertexAttribI4iv = gl_lazy_glVertexAttribI4iv;
+	glVertexAttribI1uiv = gl_lazy_glVertexAttribI1uiv;
+	glVertexAttribI2uiv = gl_lazy_glVertexAttribI2uiv;
+	glVertexAttribI3uiv = gl_lazy_glVertexAttribI3uiv;
+	glVertexAttribI4uiv = gl_lazy_glVertexAttribI4uiv;
+	glVertexAttribI4bv = gl_lazy_glVertexAttribI4bv;
+	glVertexAttribI4sv = gl_lazy_glVertexAttribI4sv;
+	glVertexAttribI4ubv = gl_lazy_glVertexAttribI4ubv;
+	glVertexAttribI4usv = gl_lazy_glVertexAttribI4usv;
+	glGetUniformuiv = gl_lazy_glGetUniformuiv;
+	glBindFragDataLocation = gl_lazy_glBindFragDataLocation;
+	glGetFragDataLocation = gl_lazy_glGetFragDataLocation;
+	glUniform1ui = gl_lazy_glUniform1ui;
+	glUniform2ui = gl_lazy_glUniform2ui;
+	glUniform3ui = gl_lazy_glUniform3ui;
+	glUniform4ui = gl_lazy_glUniform4ui;
+	glUniform1uiv = gl_lazy_glUniform1uiv;
+	glUniform2uiv = gl_lazy_glUniform2uiv;
+	glUniform3uiv = gl_lazy_glUniform3uiv;
+	glUniform4uiv = gl_lazy_glUniform4uiv;
+	glTexParameterIiv = gl_lazy_glTexParameterIiv;
+	glTexParameterIuiv = gl_lazy_glTexParameterIuiv;
+	glGetTexParameterIiv = gl_lazy_glGetTexParameterIiv;
+	glGetTexParameterIuiv = gl_lazy_glGetTexParameterIuiv;
+	glClearBufferiv = gl_lazy_glClearBufferiv;
+	glClearBufferuiv = gl_lazy_glClearBufferuiv;
+	glClearBufferfv = gl_lazy_glClearBufferfv;
+	glClearBufferfi = gl_lazy_glClearBufferfi;
+	glGetStringi = gl_lazy_glGetStringi;
+	glIsRenderbuffer = gl_lazy_glIsRenderbuffer;
+	glBindRenderbuffer = gl_lazy_glBindRenderbuffer;
+	glDeleteRenderbuffers = gl_lazy_glDeleteRenderbuffers;
+	glGenRenderbuffers = gl_lazy_glGenRenderbuffers;
+	glRenderbufferStorage = gl_lazy_glRenderbufferStorage;
+	glGetRenderbufferParameteriv = gl_lazy_glGetRenderbufferParameteriv;
+	glIsFramebuffer = gl_lazy_glIsFramebuffer;
+	glBindFramebuffer = gl_lazy_glBindFramebuffer;
+	glDeleteFramebuffers = gl_lazy_glDeleteFramebuffers;
+	glGenFramebuffers = gl_lazy_glGenFramebuffers;
+	glCheckFramebufferStatus = gl_lazy_glCheckFramebufferStatus;
+	glFramebufferTexture1D = gl_lazy_glFramebufferTexture1D;
+	glFramebufferTexture2D = gl_lazy_glFramebufferTexture2D;
+	glFramebufferTexture3D = gl_lazy_glFramebufferTexture3D;
+	glFramebufferRenderbuffer = gl_lazy_glFramebufferRenderbuffer;
+	glGetFramebufferAttachmentParameteriv = gl_lazy_glGetFramebufferAttachmentParameteriv;
+	glGenerateMipmap = gl_lazy_glGenerateMipmap;
+	glBlitFramebuffer = gl_lazy_glBlitFramebuffer;
+	glRenderbufferStorageMultisample = gl_lazy_glRenderbufferStorageMultisample;
+	glFramebufferTextureLayer = gl_lazy_glFramebufferTextureLayer;
+	glMapBufferRange = gl_lazy_glMapBufferRange;
+	glFlushMappedBufferRange = gl_lazy_glFlushMappedBufferRange;
+	glBindVertexArray = gl_lazy_glBindVertexArray;
+	glDeleteVertexArrays = gl_lazy_glDeleteVertexArrays;
+	glGenVertexArrays = gl_lazy_glGenVertexArrays;
+	glIsVertexArray = gl_lazy_glIsVertexArray;
+	glDrawArraysInstanced = gl_lazy_glDrawArraysInstanced;
+	glDrawElementsInstanced = gl_lazy_glDrawElementsInstanced;
+	glTexBuffer = gl_lazy_glTexBuffer;
+	glPrimitiveRestartIndex = gl_lazy_glPrimitiveRestartIndex;
+	glCopyBufferSubData = gl_lazy_glCopyBufferSubData;
+	glGetUniformIndices = gl_lazy_glGetUniformIndices;
+	glGetActiveUniformsiv = gl_lazy_glGetActiveUniformsiv;
+	glGetActiveUniformName = gl_lazy_glGetActiveUniformName;
+	glGetUniformBlockIndex = gl_lazy_glGetUniformBlockIndex;
+	glGetActiveUniformBlockiv = gl_lazy_glGetActiveUniformBlockiv;
+	glGetActiveUniformBlockName = gl_lazy_glGetActiveUniformBlockName;
+	glUniformBlockBinding = gl_lazy_glUniformBlockBinding;
+	glDrawElementsBaseVertex = gl_lazy_glDrawElementsBaseVertex;
+	glDrawRangeElementsBaseVertex = gl_lazy_glDrawRangeElementsBaseVertex;
+	glDrawElementsInstancedBaseVertex = gl_lazy_glDrawElementsInstancedBaseVertex;
+	glMultiDrawElementsBaseVertex = gl_lazy_glMultiDrawElementsBaseVertex;
+	glProvokingVertex = gl_lazy_glProvokingVertex;
+	glFenceSync = gl_lazy_glFenceSync;
+	glIsSync = gl_lazy_glIsSync;
+	glDeleteSync = gl_lazy_glDeleteSync;
+	glClientWaitSync = gl_lazy_glClientWaitSync;
+	glWaitSync = gl_lazy_glWaitSync;
+	glGetInteger64v = gl_lazy_glGetInteger64v;
+	glGetSynciv = gl_lazy_glGetSynciv;
+	glGetInteger64i_v = gl_lazy_glGetInteger64i_v;
+	glGetBufferParameteri64v = gl_lazy_glGetBufferParameteri64v;
+	glFramebufferTexture = gl_lazy_glFramebufferTexture;
+	glTexImage2DMultisample = gl_lazy_glTexImage2DMultisample;
+	glTexImage3DMultisample = gl_lazy_glTexImage3DMultisample;
+	glGetMultisamplefv = gl_lazy_glGetMultisamplefv;
+	glSampleMaski = gl_lazy_glSampleMaski;
+	glBindFragDataLocationIndexed = gl_lazy_glBindFragDataLocationIndexed;
+	glGetFragDataIndex = gl_lazy_glGetFragDataIndex;
+	glGenSamplers = gl_lazy_glGenSamplers;
+	glDeleteSamplers = gl_lazy_glDeleteSamplers;
+	glIsSampler = gl_lazy_glIsSampler;
+	glBindSampler = gl_lazy_glBindSampler;
+	glSamplerParameteri = gl_lazy_glSamplerParameteri;
+	glSamplerParameteriv = gl_lazy_glSamplerParameteriv;
+	glSamplerParameterf = gl_lazy_glSamplerParameterf;
+	glSamplerParameterfv = gl_lazy_glSamplerParameterfv;
+	glSamplerParameterIiv = gl_lazy_glSamplerParameterIiv;
+	glSamplerParameterIuiv = gl_lazy_glSamplerParameterIuiv;
+	glGetSamplerParameteriv = gl_lazy_glGetSamplerParameteriv;
+	glGetSamplerParameterIiv = gl_lazy_glGetSamplerParameterIiv;
+	glGetSamplerParameterfv = gl_lazy_glGetSamplerParameterfv;
+	glGetSamplerParameterIuiv = gl_lazy_glGetSamplerParameterIuiv;
+	glQueryCounter = gl_lazy_glQueryCounter;
+	glGetQueryObjecti64v = gl_lazy_glGetQueryObjecti64v;
+	glGetQueryObjectui64v = gl_lazy_glGetQueryObjectui64v;
+	glVertexAttribDivisor = gl_lazy_glVertexAttribDivisor;
+	glVertexAttribP1ui = gl_lazy_glVertexAttribP1ui;
+	glVertexAttribP1uiv = gl_lazy_glVertexAttribP1uiv;
+	glVertexAttribP2ui = gl_lazy_glVertexAttribP2ui;
+	glVertexAttribP2uiv = gl_lazy_glVertexAttribP2uiv;
+	glVertexAttribP3ui = gl_lazy_glVertexAttribP3ui;
+	glVertexAttribP3uiv = gl_lazy_glVertexAttribP3uiv;
+	glVertexAttribP4ui = gl_lazy_glVertexAttribP4ui;
+	glVertexAttribP4uiv = gl_lazy_glVertexAttribP4uiv;
+	gl_loader_stats.resolved = 0;
+	gl_loader_stats.resolve_ms = 0.0;
+}
+
+//a backend is a library with a GetProcAddress and a GetCurrentContext:
+struct GLLoaderLibrary {
+	char const *backend;
+	std::vector< char const * > libraries; //(tried in order)
+	char const *get_proc_address;
+	char const *get_current_context;
+};
+
+//returns true if 'library' could be opened and (if 'need_context') has a current context:
+static bool gl_loader_open(GLLoaderLibrary const &library, bool need_context) {
+	for (char const *filename : library.libraries) {
+		void *handle = dlopen(filename, RTLD_LAZY | RTLD_LOCAL);
+		if (!handle) continue;
+		auto get_proc_address = (GLLoaderGetProcAddress)dlsym(handle, library.get_proc_address);
+		auto get_current_context = (void *(*)())dlsym(handle, library.get_current_context);
+		if (!get_proc_address || !get_current_context || (need_context && !get_current_context())) {
+			dlclose(handle);
+			continue;
+		}
+		//(the library is deliberately never closed, since the pointers it handed out point into it)
+		gl_loader_get_proc_address = get_proc_address;
+		gl_loader_stats.backend = library.backend;
+		return true;
+	}
+	return false;
+}
+
+void init_GL(GLLoaderBackend backend) {
+	static std::vector< GLLoaderLibrary > const libraries{
+		{ "EGL", { "libEGL.so.1", "libEGL.so" }, "eglGetProcAddress", "eglGetCurrentContext" },
+		{ "GLX", { "libGLX.so.0", "libGL.so.1", "libGL.so" }, "glXGetProcAddressARB", "glXGetCurrentContext" },
+		{ "OSMesa", { "libOSMesa.so.8", "libOSMesa.so.6", "libOSMesa.so" }, "OSMesaGetProcAddress", "OSMesaGetCurrentContext" },
+	};
+
+	auto before = std::chrono::steady_clock::now();
+
+	gl_loader_reset();
+	gl_loader_get_proc_address = nullptr;
+	gl_loader_stats.backend = "none";
+
+	bool opened = false;
+	if (backend == GLLoaderAuto) {
+		//pick the first backend with a context current (e.g., SDL uses GLX or EGL depending on the video driver):
+		for (auto const &library : libraries) {
+			if (gl_loader_open(library, true)) {
+				opened = true;
+				break;
+			}
+		}
+	} else {
+		//(an explicit backend must own the current context too, or its entry points would be for some other driver)
+		opened = gl_loader_open(libraries.at(backend - GLLoaderEGL), true);
+	}
+
+	gl_loader_stats.open_ms = std::chrono::duration< double, std::milli >(std::chrono::steady_clock::now() - before).count();
+
+	if (!opened) {
+		if (backend == GLLoaderAuto) {
+			throw std::runtime_error("init_GL: no EGL, GLX, or OSMesa context is current.");
+		} else {
+			throw std::runtime_error(std::string("init_GL: couldn't load the ") + libraries.at(backend - GLLoaderEGL).backend + " library, or it has no current context.");
+		}
+	}
+}
+
+#endif //__linux__
+
+bool gl_extension_supported(char const *name) {
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i) {
+		char const *extension = reinterpret_cast< char const * >(glGetStringi(GL_EXTENSIONS, GLuint(i)));
+		if (extension && std::strcmp(extension, name) == 0) return true;
+	}
+	return false;
+}
+
+//------------ call layer ------------
+
+char const *gl_layer_names[GLP_COUNT] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+
+//------------ call profiling layer ------------
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+bool gl_profile_enabled = false;
+
+static uint64_t gl_profile_calls[GLP_COUNT];
+static uint64_t gl_profile_nanoseconds[GLP_COUNT];
+
+
+uint64_t gl_profile_now() {
+	return std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void gl_profile_record(uint32_t index, uint64_t start) {
+	gl_profile_calls[index] += 1;
+	gl_profile_nanoseconds[index] += gl_profile_now() - start;
+}
+
+void gl_profile_reset() {
+	std::fill(gl_profile_calls, gl_profile_calls + GLP_COUNT, 0);
+	std::fill(gl_profile_nanoseconds, gl_profile_nanoseconds + GLP_COUNT, 0);
+}
+
+void gl_profile_dump(std::ostream &out) {
+	std::vector< uint32_t > called;
+	uint64_t total_calls = 0;
+	uint64_t total_nanoseconds = 0;
+	for (uint32_t i = 0; i < GLP_COUNT; ++i) {
+		if (gl_profile_calls[i] == 0) continue;
+		called.emplace_back(i);
+		total_calls += gl_profile_calls[i];
+		total_nanoseconds += gl_profile_nanoseconds[i];
+	}
+	std::stable_sort(called.begin(), called.end(), [](uint32_t a, uint32_t b) {
+		return gl_profile_nanoseconds[a] > gl_profile_nanoseconds[b];
+	});
+
+	std::ios::fmtflags flags = out.flags();
+	out << "GL calls: " << total_calls << " calls, " << std::fixed << std::setprecision(3) << (total_nanoseconds / 1.0e6) << " ms\n";
+	out << "      calls   total ms     avg us  function\n";
+	for (uint32_t i : called) {
+		out << std::setw(11) << gl_profile_calls[i]
+		    << std::setw(11) << std::setprecision(3) << (gl_profile_nanoseconds[i] / 1.0e6)
+		    << std::setw(11) << std::setprecision(3) << (gl_profile_nanoseconds[i] / 1.0e3 / gl_profile_calls[i])
+		    << "  " << gl_layer_names[i] << "\n";
+	}
+	out.flush();
+	out.flags(flags);
+}
+
+//------------ call recording layer ------------
+
+#include <cstring>
+
+char const *gl_record_signatures[GLP_COUNT] = {
+	"v", //glCullFace
+	"v", //glFrontFace
+	"vv", //glHint
+	"v", //glLineWidth
+	"v", //glPointSize
+	"vv", //glPolygonMode
+	"vvvv", //glScissor
+	"vvv", //glTexParameterf
+	"vvi", //glTexParameterfv
+	"vvv", //glTexParameteri
+	"vvi", //glTexParameteriv
+	"vvvvvvvi", //glTexImage1D
+	"vvvvvvvvi", //glTexImage2D
+	"v", //glDrawBuffer
+	"v", //glClear
+	"vvvv", //glClearColor
+	"v", //glClearStencil
+	"v", //glClearDepth
+	"v", //glStencilMask
+	"vvvv", //glColorMask
+	"v", //glDepthMask
+	"v", //glDisable
+	"v", //glEnable
+	"", //glFinish
+	"", //glFlush
+	"vv", //glBlendFunc
+	"v", //glLogicOp
+	"vvv", //glStencilFunc
+	"vvv", //glStencilOp
+	"v", //glDepthFunc
+	"vv", //glPixelStoref
+	"vv", //glPixelStorei
+	"v", //glReadBuffer
+	"vvvvvvo", //glReadPixels
+	"vo", //glGetBooleanv
+	"vo", //glGetDoublev
+	"", //glGetError
+	"vo", //glGetFloatv
+	"vo", //glGetIntegerv
+	"v", //glGetString
+	"vvvvo", //glGetTexImage
+	"vvo", //glGetTexParameterfv
+	"vvo", //glGetTexParameteriv
+	"vvvo", //glGetTexLevelParameterfv
+	"vvvo", //glGetTexLevelParameteriv
+	"v", //glIsEnabled
+	"vv", //glDepthRange
+	"vvvv", //glViewport
+	"vvv", //glDrawArrays
+	"vvvi", //glDrawElements
+	"vo", //glGetPointerv
+	"vv", //glPolygonOffset
+	"vvvvvvv", //glCopyTexImage1D
+	"vvvvvvvv", //glCopyTexImage2D
+	"vvvvvv", //glCopyTexSubImage1D
+	"vvvvvvvv", //glCopyTexSubImage2D
+	"vvvvvvi", //glTexSubImage1D
+	"vvvvvvvvi", //glTexSubImage2D
+	"vv", //glBindTexture
+	"vi", //glDeleteTextures
+	"vo", //glGenTextures
+	"v", //glIsTexture
+	"vvvvvi", //glDrawRangeElements
+	"vvvvvvvvvi", //glTexImage3D
+	"vvvvvvvvvvi", //glTexSubImage3D
+	"vvvvvvvvv", //glCopyTexSubImage3D
+	"v", //glActiveTexture
+	"vv", //glSampleCoverage
+	"vvvvvvvvi", //glCompressedTexImage3D
+	"vvvvvvvi", //glCompressedTexImage2D
+	"vvvvvvi", //glCompressedTexImage1D
+	"vvvvvvvvvvi", //glCompressedTexSubImage3D
+	"vvvvvvvvi", //glCompressedTexSubImage2D
+	"vvvvvvi", //glCompressedTexSubImage1D
+	"vvo", //glGetCompressedTexImage
+	"vvvv", //glBlendFuncSeparate
+	"viiv", //glMultiDrawArrays
+	"viviv", //glMultiDrawElements
+	"vv", //glPointParameterf
+	"vi", //glPointParameterfv
+	"vv", //glPointParameteri
+	"vi", //glPointParameteriv
+	"vvvv", //glBlendColor
+	"v", //glBlendEquation
+	"vo", //glGenQueries
+	"vi", //glDeleteQueries
+	"v", //glIsQuery
+	"vv", //glBeginQuery
+	"v", //glEndQuery
+	"vvo", //glGetQueryiv
+	"vvo", //glGetQueryObjectiv
+	"vvo", //glGetQueryObjectuiv
+	"vv", //glBindBuffer
+	"vi", //glDeleteBuffers
+	"vo", //glGenBuffers
+	"v", //glIsBuffer
+	"vviv", //glBufferData
+	"vvvi", //glBufferSubData
+	"vvvo", //glGetBufferSubData
+	"vv", //glMapBuffer
+	"v", //glUnmapBuffer
+	"vvo", //glGetBufferParameteriv
+	"vvo", //glGetBufferPointerv
+	"vv", //glBlendEquationSeparate
+	"vi", //glDrawBuffers
+	"vvvv", //glStencilOpSeparate
+	"vvvv", //glStencilFuncSeparate
+	"vv", //glStencilMaskSeparate
+	"vv", //glAttachShader
+	"vvi", //glBindAttribLocation
+	"v", //glCompileShader
+	"", //glCreateProgram
+	"v", //glCreateShader
+	"v", //glDeleteProgram
+	"v", //glDeleteShader
+	"vv", //glDetachShader
+	"v", //glDisableVertexAttribArray
+	"v", //glEnableVertexAttribArray
+	"vvvoooo", //glGetActiveAttrib
+	"vvvoooo", //glGetActiveUniform
+	"vvoo", //glGetAttachedShaders
+	"vi", //glGetAttribLocation
+	"vvo", //glGetProgramiv
+	"vvoo", //glGetProgramInfoLog
+	"vvo", //glGetShaderiv
+	"vvoo", //glGetShaderInfoLog
+	"vvoo", //glGetShaderSource
+	"vi", //glGetUniformLocation
+	"vvo", //glGetUniformfv
+	"vvo", //glGetUniformiv
+	"vvo", //glGetVertexAttribdv
+	"vvo", //glGetVertexAttribfv
+	"vvo", //glGetVertexAttribiv
+	"vvo", //glGetVertexAttribPointerv
+	"v", //glIsProgram
+	"v", //glIsShader
+	"v", //glLinkProgram
+	"vvii", //glShaderSource
+	"v", //glUseProgram
+	"vv", //glUniform1f
+	"vvv", //glUniform2f
+	"vvvv", //glUniform3f
+	"vvvvv", //glUniform4f
+	"vv", //glUniform1i
+	"vvv", //glUniform2i
+	"vvvv", //glUniform3i
+	"vvvvv", //glUniform4i
+	"vvi", //glUniform1fv
+	"vvi", //glUniform2fv
+	"vvi", //glUniform3fv
+	"vvi", //glUniform4fv
+	"vvi", //glUniform1iv
+	"vvi", //glUniform2iv
+	"vvi", //glUniform3iv
+	"vvi", //glUniform4iv
+	"vvvi", //glUniformMatrix2fv
+	"vvvi", //glUniformMatrix3fv
+	"vvvi", //glUniformMatrix4fv
+	"v", //glValidateProgram
+	"vv", //glVertexAttrib1d
+	"vi", //glVertexAttrib1dv
+	"vv", //glVertexAttrib1f
+	"vi", //glVertexAttrib1fv
+	"vv", //glVertexAttrib1s
+	"vi", //glVertexAttrib1sv
+	"vvv", //glVertexAttrib2d
+	"vi", //glVertexAttrib2dv
+	"vvv", //glVertexAttrib2f
+	"vi", //glVertexAttrib2fv
+	"vvv", //glVertexAttrib2s
+	"vi", //glVertexAttrib2sv
+	"vvvv", //glVertexAttrib3d
+	"vi", //glVertexAttrib3dv
+	"vvvv", //glVertexAttrib3f
+	"vi", //glVertexAttrib3fv
+	"vvvv", //glVertexAttrib3s
+	"vi", //glVertexAttrib3sv
+	"vi", //glVertexAttrib4Nbv
+	"vi", //glVertexAttrib4Niv
+	"vi", //glVertexAttrib4Nsv
+	"vvvvv", //glVertexAttrib4Nub
+	"vi", //glVertexAttrib4Nubv
+	"vi", //glVertexAttrib4Nuiv
+	"vi", //glVertexAttrib4Nusv
+	"vi", //glVertexAttrib4bv
+	"vvvvv", //glVertexAttrib4d
+	"vi", //glVertexAttrib4dv
+	"vvvvv", //glVertexAttrib4f
+	"vi", //glVertexAttrib4fv
+	"vi", //glVertexAttrib4iv
+	"vvvvv", //glVertexAttrib4s
+	"vi", //glVertexAttrib4sv
+	"vi", //glVertexAttrib4ubv
+	"vi", //glVertexAttrib4uiv
+	"vi", //glVertexAttrib4usv
+	"vvvvvi", //glVertexAttribPointer
+	"vvvi", //glUniformMatrix2x3fv
+	"vvvi", //glUniformMatrix3x2fv
+	"vvvi", //glUniformMatrix2x4fv
+	"vvvi", //glUniformMatrix4x2fv
+	"vvvi", //glUniformMatrix3x4fv
+	"vvvi", //glUniformMatrix4x3fv
+	"vvvvv", //glColorMaski
+	"vvo", //glGetBooleani_v
+	"vvo", //glGetIntegeri_v
+	"vv", //glEnablei
+	"vv", //glDisablei
+	"vv", //glIsEnabledi
+	"v", //glBeginTransformFeedback
+	"", //glEndTransformFeedback
+	"vvvvv", //glBindBufferRange
+	"vvv", //glBindBufferBase
+	"vviv", //glTransformFeedbackVaryings
+	"vvvoooo", //glGetTransformFeedbackVarying
+	"vv", //glClampColor
+	"vv", //glBeginConditionalRender
+	"", //glEndConditionalRender
+	"vvvvi", //glVertexAttribIPointer
+	"vvo", //glGetVertexAttribIiv
+	"vvo", //glGetVertexAttribIuiv
+	"vv", //glVertexAttribI1i
+	"vvv", //glVertexAttribI2i
+	"vvvv", //glVertexAttribI3i
+	"vvvvv", //glVertexAttribI4i
+	"vv", //glVertexAttribI1ui
+	"vvv", //glVertexAttribI2ui
+	"vvvv", //glVertexAttribI3ui
+	"vvvvv", //glVertexAttribI4ui
+	"vi", //glVertexAttribI1iv
+	"vi", //glVertexAttribI2iv
+	"vi", //glVertexAttribI3iv
+	"vi", //glVertexAttribI4iv
+	"vi", //glVertexAttribI1uiv
+	"vi", //glVertexAttribI2uiv
+	"vi", //glVertexAttribI3uiv
+	"vi", //glVertexAttribI4uiv
+	"vi", //glVertexAttribI4bv
+	"vi", //glVertexAttribI4sv
+	"vi", //glVertexAttribI4ubv
+	"vi", //glVertexAttribI4usv
+	"vvo", //glGetUniformuiv
+	"vvi", //glBindFragDataLocation
+	"vi", //glGetFragDataLocation
+	"vv", //glUniform1ui
+	"vvv", //glUniform2ui
+	"vvvv", //glUniform3ui
+	"vvvvv", //glUniform4ui
+	"vvi", //glUniform1uiv
+	"vvi", //glUniform2uiv
+	"vvi", //glUniform3uiv
+	"vvi", //glUniform4uiv
+	"vvi", //glTexParameterIiv
+	"vvi", //glTexParameterIuiv
+	"vvo", //glGetTexParameterIiv
+	"vvo", //glGetTexParameterIuiv
+	"vvi", //glClearBufferiv
+	"vvi", //glClearBufferuiv
+	"vvi", //glClearBufferfv
+	"vvvv", //glClearBufferfi
+	"vv", //glGetStringi
+	"v", //glIsRenderbuffer
+	"vv", //glBindRenderbuffer
+	"vi", //glDeleteRenderbuffers
+	"vo", //glGenRenderbuffers
+	"vvvv", //glRenderbufferStorage
+	"vvo", //glGetRenderbufferParameteriv
+	"v", //glIsFramebuffer
+	"vv", //glBindFramebuffer
+	"vi", //glDeleteFramebuffers
+	"vo", //glGenFramebuffers
+	"v", //glCheckFramebufferStatus
+	"vvvvv", //glFramebufferTexture1D
+	"vvvvv", //glFramebufferTexture2D
+	"vvvvvv", //glFramebufferTexture3D
+	"vvvv", //glFramebufferRenderbuffer
+	"vvvo", //glGetFramebufferAttachmentParameteriv
+	"v", //glGenerateMipmap
+	"vvvvvvvvvv", //glBlitFramebuffer
+	"vvvvv", //glRenderbufferStorageMultisample
+	"vvvvv", //glFramebufferTextureLayer
+	"vvvv", //glMapBufferRange
+	"vvv", //glFlushMappedBufferRange
+	"v", //glBindVertexArray
+	"vi", //glDeleteVertexArrays
+	"vo", //glGenVertexArrays
+	"v", //glIsVertexArray
+	"vvvv", //glDrawArraysInstanced
+	"vvviv", //glDrawElementsInstanced
+	"vvv", //glTexBuffer
+	"v", //glPrimitiveRestartIndex
+	"vvvvv", //glCopyBufferSubData
+	"vvio", //glGetUniformIndices
+	"vvivo", //glGetActiveUniformsiv
+	"vvvoo", //glGetActiveUniformName
+	"vi", //glGetUniformBlockIndex
+	"vvvo", //glGetActiveUniformBlockiv
+	"vvvoo", //glGetActiveUniformBlockName
+	"vvv", //glUniformBlockBinding
+	"vvviv", //glDrawElementsBaseVertex
+	"vvvvviv", //glDrawRangeElementsBaseVertex
+	"vvvivv", //glDrawElementsInstancedBaseVertex
+	"vivivi", //glMultiDrawElementsBaseVertex
+	"v", //glProvokingVertex
+	"vv", //glFenceSync
+	"v", //glIsSync
+	"v", //glDeleteSync
+	"vvv", //glClientWaitSync
+	"vvv", //glWaitSync
+	"vo", //glGetInteger64v
+	"vvvoo", //glGetSynciv
+	"vvo", //glGetInteger64i_v
+	"vvo", //glGetBufferParameteri64v
+	"vvvv", //glFramebufferTexture
+	"vvvvvv", //glTexImage2DMultisample
+	"vvvvvvv", //glTexImage3DMultisample
+	"vvo", //glGetMultisamplefv
+	"vv", //glSampleMaski
+	"vvvi", //glBindFragDataLocationIndexed
+	"vi", //glGetFragDataIndex
+	"vo", //glGenSamplers
+	"vi", //glDeleteSamplers
+	"v", //glIsSampler
+	"vv", //glBindSampler
+	"vvv", //glSamplerParameteri
+	"vvi", //glSamplerParameteriv
+	"vvv", //glSamplerParameterf
+	"vvi", //glSamplerParameterfv
+	"vvi", //glSamplerParameterIiv
+	"vvi", //glSamplerParameterIuiv
+	"vvo", //glGetSamplerParameteriv
+	"vvo", //glGetSamplerParameterIiv
+	"vvo", //glGetSamplerParameterfv
+	"vvo", //glGetSamplerParameterIuiv
+	"vv", //glQueryCounter
+	"vvo", //glGetQueryObjecti64v
+	"vvo", //glGetQueryObjectui64v
+	"vv", //glVertexAttribDivisor
+	"vvvv", //glVertexAttribP1ui
+	"vvvi", //glVertexAttribP1uiv
+	"vvvv", //glVertexAttribP2ui
+	"vvvi", //glVertexAttribP2uiv
+	"vvvv", //glVertexAttribP3ui
+	"vvvi", //glVertexAttribP3uiv
+	"vvvv", //glVertexAttribP4ui
+	"vvvi", //glVertexAttribP4uiv
+};
+
+uint64_t gl_record_payload_size(uint32_t index, uint32_t param, uint64_t const *v) {
+	switch (index) {
+		case GLP_glTexParameterfv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glTexParameteriv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glTexImage1D: return (param == 7 ? gl_record_image_size(GLsizei(v[3]), 1, 1, GLenum(v[5]), GLenum(v[6])) : GLRecordNoPayload);
+		case GLP_glTexImage2D: return (param == 8 ? gl_record_image_size(GLsizei(v[3]), GLsizei(v[4]), 1, GLenum(v[6]), GLenum(v[7])) : GLRecordNoPayload);
+		case GLP_glTexSubImage1D: return (param == 6 ? gl_record_image_size(GLsizei(v[3]), 1, 1, GLenum(v[4]), GLenum(v[5])) : GLRecordNoPayload);
+		case GLP_glTexSubImage2D: return (param == 8 ? gl_record_image_size(GLsizei(v[4]), GLsizei(v[5]), 1, GLenum(v[6]), GLenum(v[7])) : GLRecordNoPayload);
+		case GLP_glDeleteTextures: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGenTextures: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glTexImage3D: return (param == 9 ? gl_record_image_size(GLsizei(v[3]), GLsizei(v[4]), GLsizei(v[5]), GLenum(v[7]), GLenum(v[8])) : GLRecordNoPayload);
+		case GLP_glTexSubImage3D: return (param == 10 ? gl_record_image_size(GLsizei(v[5]), GLsizei(v[6]), GLsizei(v[7]), GLenum(v[8]), GLenum(v[9])) : GLRecordNoPayload);
+		case GLP_glCompressedTexImage3D: return (param == 8 ? uint64_t(v[7]) : GLRecordNoPayload);
+		case GLP_glCompressedTexImage2D: return (param == 7 ? uint64_t(v[6]) : GLRecordNoPayload);
+		case GLP_glCompressedTexImage1D: return (param == 6 ? uint64_t(v[5]) : GLRecordNoPayload);
+		case GLP_glCompressedTexSubImage3D: return (param == 10 ? uint64_t(v[9]) : GLRecordNoPayload);
+		case GLP_glCompressedTexSubImage2D: return (param == 8 ? uint64_t(v[7]) : GLRecordNoPayload);
+		case GLP_glCompressedTexSubImage1D: return (param == 6 ? uint64_t(v[5]) : GLRecordNoPayload);
+		case GLP_glMultiDrawArrays:
+			if (param == 1) return uint64_t(v[3]) * 4;
+			if (param == 2) return uint64_t(v[3]) * 4;
+			return GLRecordNoPayload;
+		case GLP_glPointParameterfv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glPointParameteriv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glGenQueries: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glDeleteQueries: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glDeleteBuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGenBuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glBufferData: return (param == 2 ? uint64_t(v[1]) : GLRecordNoPayload);
+		case GLP_glBufferSubData: return (param == 3 ? uint64_t(v[2]) : GLRecordNoPayload);
+		case GLP_glDrawBuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glBindAttribLocation: return (param == 2 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[2]))) + 1) : GLRecordNoPayload);
+		case GLP_glGetAttribLocation: return (param == 1 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[1]))) + 1) : GLRecordNoPayload);
+		case GLP_glGetUniformLocation: return (param == 1 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[1]))) + 1) : GLRecordNoPayload);
+		case GLP_glUniform1fv: return (param == 2 ? uint64_t(v[1]) * 1 * 4 : GLRecordNoPayload);
+		case GLP_glUniform2fv: return (param == 2 ? uint64_t(v[1]) * 2 * 4 : GLRecordNoPayload);
+		case GLP_glUniform3fv: return (param == 2 ? uint64_t(v[1]) * 3 * 4 : GLRecordNoPayload);
+		case GLP_glUniform4fv: return (param == 2 ? uint64_t(v[1]) * 4 * 4 : GLRecordNoPayload);
+		case GLP_glUniform1iv: return (param == 2 ? uint64_t(v[1]) * 1 * 4 : GLRecordNoPayload);
+		case GLP_glUniform2iv: return (param == 2 ? uint64_t(v[1]) * 2 * 4 : GLRecordNoPayload);
+		case GLP_glUniform3iv: return (param == 2 ? uint64_t(v[1]) * 3 * 4 : GLRecordNoPayload);
+		case GLP_glUniform4iv: return (param == 2 ? uint64_t(v[1]) * 4 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix2fv: return (param == 3 ? uint64_t(v[1]) * 4 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix3fv: return (param == 3 ? uint64_t(v[1]) * 9 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix4fv: return (param == 3 ? uint64_t(v[1]) * 16 * 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib1dv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttrib1fv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib1sv: return (param == 1 ? 2 : GLRecordNoPayload);
+		case GLP_glVertexAttrib2dv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib2fv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttrib2sv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib3dv: return (param == 1 ? 24 : GLRecordNoPayload);
+		case GLP_glVertexAttrib3fv: return (param == 1 ? 12 : GLRecordNoPayload);
+		case GLP_glVertexAttrib3sv: return (param == 1 ? 6 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Nbv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Niv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Nsv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Nubv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Nuiv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4Nusv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4bv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4dv: return (param == 1 ? 32 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4fv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4iv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4sv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4ubv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4uiv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttrib4usv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glUniformMatrix2x3fv: return (param == 3 ? uint64_t(v[1]) * 6 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix3x2fv: return (param == 3 ? uint64_t(v[1]) * 6 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix2x4fv: return (param == 3 ? uint64_t(v[1]) * 8 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix4x2fv: return (param == 3 ? uint64_t(v[1]) * 8 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix3x4fv: return (param == 3 ? uint64_t(v[1]) * 12 * 4 : GLRecordNoPayload);
+		case GLP_glUniformMatrix4x3fv: return (param == 3 ? uint64_t(v[1]) * 12 * 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribI1iv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribI2iv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttribI3iv: return (param == 1 ? 12 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4iv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttribI1uiv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribI2uiv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttribI3uiv: return (param == 1 ? 12 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4uiv: return (param == 1 ? 16 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4bv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4sv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4ubv: return (param == 1 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribI4usv: return (param == 1 ? 8 : GLRecordNoPayload);
+		case GLP_glBindFragDataLocation: return (param == 2 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[2]))) + 1) : GLRecordNoPayload);
+		case GLP_glGetFragDataLocation: return (param == 1 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[1]))) + 1) : GLRecordNoPayload);
+		case GLP_glUniform1uiv: return (param == 2 ? uint64_t(v[1]) * 1 * 4 : GLRecordNoPayload);
+		case GLP_glUniform2uiv: return (param == 2 ? uint64_t(v[1]) * 2 * 4 : GLRecordNoPayload);
+		case GLP_glUniform3uiv: return (param == 2 ? uint64_t(v[1]) * 3 * 4 : GLRecordNoPayload);
+		case GLP_glUniform4uiv: return (param == 2 ? uint64_t(v[1]) * 4 * 4 : GLRecordNoPayload);
+		case GLP_glTexParameterIiv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glTexParameterIuiv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glClearBufferiv: return (param == 2 ? (GLenum(v[0]) == GL_COLOR ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glClearBufferuiv: return (param == 2 ? (GLenum(v[0]) == GL_COLOR ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glClearBufferfv: return (param == 2 ? (GLenum(v[0]) == GL_COLOR ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glDeleteRenderbuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGenRenderbuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glDeleteFramebuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGenFramebuffers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glDeleteVertexArrays: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGenVertexArrays: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glGetUniformBlockIndex: return (param == 1 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[1]))) + 1) : GLRecordNoPayload);
+		case GLP_glBindFragDataLocationIndexed: return (param == 3 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[3]))) + 1) : GLRecordNoPayload);
+		case GLP_glGetFragDataIndex: return (param == 1 ? (std::strlen(reinterpret_cast< char const * >(uintptr_t(v[1]))) + 1) : GLRecordNoPayload);
+		case GLP_glGenSamplers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glDeleteSamplers: return (param == 1 ? uint64_t(v[0]) * 4 : GLRecordNoPayload);
+		case GLP_glSamplerParameteriv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glSamplerParameterfv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glSamplerParameterIiv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glSamplerParameterIuiv: return (param == 2 ? ((GLenum(v[1]) == GL_TEXTURE_BORDER_COLOR || GLenum(v[1]) == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4) : GLRecordNoPayload);
+		case GLP_glVertexAttribP1uiv: return (param == 3 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribP2uiv: return (param == 3 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribP3uiv: return (param == 3 ? 4 : GLRecordNoPayload);
+		case GLP_glVertexAttribP4uiv: return (param == 3 ? 4 : GLRecordNoPayload);
+		default: return GLRecordNoPayload;
+	}
+}
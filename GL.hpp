@@ -9,15 +9,42 @@
  *  initialized by init_GL(). This is because the 1.1/1.0 entries are
  *  the only ones provided directly by OpenGL32.dll 
  *
- * On Linux, all are prototypes.
+ * On Linux, all are pointers, each looked up the first time it is called
+ *  through the backend (EGL, GLX, or OSMesa) chosen by init_GL(); so the
+ *  program doesn't link against libGL, and only looks up what it uses.
  *
  * On MacOS, all are prototypes.
  *
- * This file has been automatically generated from glcorearb.h by make-GL.py
+ * This file has been automatically generated from glcorearb.h by make-GL.py --loader
  *
  */
 
-void init_GL(); //will throw on failure.
+//Where entry points are looked up (only used on Linux):
+enum GLLoaderBackend {
+	GLLoaderAuto, //whichever of the below has a current context
+	GLLoaderEGL,
+	GLLoaderGLX,
+	GLLoaderOSMesa,
+};
+
+void init_GL(GLLoaderBackend backend = GLLoaderAuto); //will throw on failure.
+
+//Cost of loading (Linux only; zero elsewhere):
+struct GLLoaderStats {
+	char const *backend = "none"; //backend in use
+	double open_ms = 0.0; //time init_GL() spent opening the backend library
+	unsigned int resolved = 0; //entry points looked up so far
+	double resolve_ms = 0.0; //time spent looking them up
+};
+extern GLLoaderStats gl_loader_stats;
+
+//look up an entry point GL.hpp doesn't declare (e.g., from an extension) where init_GL() found the rest:
+// may return nullptr if there is no such function (or init_GL() hasn't been called), but some
+// backends (e.g. EGL) hand back pointers for any name, so check for the extension first.
+void *gl_get_proc_address(char const *name);
+
+//is 'name' (e.g. "GL_KHR_debug") in the current context's extension list? (checked with glGetStringi, as core profiles require)
+bool gl_extension_supported(char const *name);
 
 extern "C" {
 
@@ -26,9 +53,15 @@ extern "C" {
 #ifdef _WIN32
 	#define APIENTRY __stdcall //see: https://docs.microsoft.com/en-us/windows/win32/winprog/windows-data-types
 	#define APIENTRYFP APIENTRY * //these are function pointers on windows
+	#define APIENTRYFP11 APIENTRY //...except for 1.0/1.1
+#elif defined(__linux__)
+	#define APIENTRY
+	#define APIENTRYFP APIENTRY * //these are all function pointers on linux
+	#define APIENTRYFP11 APIENTRY *
 #else
 	#define APIENTRY
 	#define APIENTRYFP
+	#define APIENTRYFP11
 #endif
 
 //this is how khronos_ssize_t gets defined in khrplatform.h:
@@ -247,54 +280,54 @@ typedef uint8_t GLubyte;
 #define GL_TEXTURE_WRAP_S                 0x2802
 #define GL_TEXTURE_WRAP_T                 0x2803
 #define GL_REPEAT                         0x2901
-GLAPI void APIENTRY glCullFace (GLenum mode);
-GLAPI void APIENTRY glFrontFace (GLenum mode);
-GLAPI void APIENTRY glHint (GLenum target, GLenum mode);
-GLAPI void APIENTRY glLineWidth (GLfloat width);
-GLAPI void APIENTRY glPointSize (GLfloat size);
-GLAPI void APIENTRY glPolygonMode (GLenum face, GLenum mode);
-GLAPI void APIENTRY glScissor (GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI void APIENTRY glTexParameterf (GLenum target, GLenum pname, GLfloat param);
-GLAPI void APIENTRY glTexParameterfv (GLenum target, GLenum pname, const GLfloat *params);
-GLAPI void APIENTRY glTexParameteri (GLenum target, GLenum pname, GLint param);
-GLAPI void APIENTRY glTexParameteriv (GLenum target, GLenum pname, const GLint *params);
-GLAPI void APIENTRY glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
-GLAPI void APIENTRY glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
-GLAPI void APIENTRY glDrawBuffer (GLenum buf);
-GLAPI void APIENTRY glClear (GLbitfield mask);
-GLAPI void APIENTRY glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
-GLAPI void APIENTRY glClearStencil (GLint s);
-GLAPI void APIENTRY glClearDepth (GLdouble depth);
-GLAPI void APIENTRY glStencilMask (GLuint mask);
-GLAPI void APIENTRY glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
-GLAPI void APIENTRY glDepthMask (GLboolean flag);
-GLAPI void APIENTRY glDisable (GLenum cap);
-GLAPI void APIENTRY glEnable (GLenum cap);
-GLAPI void APIENTRY glFinish (void);
-GLAPI void APIENTRY glFlush (void);
-GLAPI void APIENTRY glBlendFunc (GLenum sfactor, GLenum dfactor);
-GLAPI void APIENTRY glLogicOp (GLenum opcode);
-GLAPI void APIENTRY glStencilFunc (GLenum func, GLint ref, GLuint mask);
-GLAPI void APIENTRY glStencilOp (GLenum fail, GLenum zfail, GLenum zpass);
-GLAPI void APIENTRY glDepthFunc (GLenum func);
-GLAPI void APIENTRY glPixelStoref (GLenum pname, GLfloat param);
-GLAPI void APIENTRY glPixelStorei (GLenum pname, GLint param);
-GLAPI void APIENTRY glReadBuffer (GLenum src);
-GLAPI void APIENTRY glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
-GLAPI void APIENTRY glGetBooleanv (GLenum pname, GLboolean *data);
-GLAPI void APIENTRY glGetDoublev (GLenum pname, GLdouble *data);
-GLAPI GLenum APIENTRY glGetError (void);
-GLAPI void APIENTRY glGetFloatv (GLenum pname, GLfloat *data);
-GLAPI void APIENTRY glGetIntegerv (GLenum pname, GLint *data);
-GLAPI const GLubyte *APIENTRY glGetString (GLenum name);
-GLAPI void APIENTRY glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
-GLAPI void APIENTRY glGetTexParameterfv (GLenum target, GLenum pname, GLfloat *params);
-GLAPI void APIENTRY glGetTexParameteriv (GLenum target, GLenum pname, GLint *params);
-GLAPI void APIENTRY glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params);
-GLAPI void APIENTRY glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params);
-GLAPI GLboolean APIENTRY glIsEnabled (GLenum cap);
-GLAPI void APIENTRY glDepthRange (GLdouble n, GLdouble f);
-GLAPI void APIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI void (APIENTRYFP11 glCullFace) (GLenum mode);
+GLAPI void (APIENTRYFP11 glFrontFace) (GLenum mode);
+GLAPI void (APIENTRYFP11 glHint) (GLenum target, GLenum mode);
+GLAPI void (APIENTRYFP11 glLineWidth) (GLfloat width);
+GLAPI void (APIENTRYFP11 glPointSize) (GLfloat size);
+GLAPI void (APIENTRYFP11 glPolygonMode) (GLenum face, GLenum mode);
+GLAPI void (APIENTRYFP11 glScissor) (GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI void (APIENTRYFP11 glTexParameterf) (GLenum target, GLenum pname, GLfloat param);
+GLAPI void (APIENTRYFP11 glTexParameterfv) (GLenum target, GLenum pname, const GLfloat *params);
+GLAPI void (APIENTRYFP11 glTexParameteri) (GLenum target, GLenum pname, GLint param);
+GLAPI void (APIENTRYFP11 glTexParameteriv) (GLenum target, GLenum pname, const GLint *params);
+GLAPI void (APIENTRYFP11 glTexImage1D) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
+GLAPI void (APIENTRYFP11 glTexImage2D) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+GLAPI void (APIENTRYFP11 glDrawBuffer) (GLenum buf);
+GLAPI void (APIENTRYFP11 glClear) (GLbitfield mask);
+GLAPI void (APIENTRYFP11 glClearColor) (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+GLAPI void (APIENTRYFP11 glClearStencil) (GLint s);
+GLAPI void (APIENTRYFP11 glClearDepth) (GLdouble depth);
+GLAPI void (APIENTRYFP11 glStencilMask) (GLuint mask);
+GLAPI void (APIENTRYFP11 glColorMask) (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+GLAPI void (APIENTRYFP11 glDepthMask) (GLboolean flag);
+GLAPI void (APIENTRYFP11 glDisable) (GLenum cap);
+GLAPI void (APIENTRYFP11 glEnable) (GLenum cap);
+GLAPI void (APIENTRYFP11 glFinish) (void);
+GLAPI void (APIENTRYFP11 glFlush) (void);
+GLAPI void (APIENTRYFP11 glBlendFunc) (GLenum sfactor, GLenum dfactor);
+GLAPI void (APIENTRYFP11 glLogicOp) (GLenum opcode);
+GLAPI void (APIENTRYFP11 glStencilFunc) (GLenum func, GLint ref, GLuint mask);
+GLAPI void (APIENTRYFP11 glStencilOp) (GLenum fail, GLenum zfail, GLenum zpass);
+GLAPI void (APIENTRYFP11 glDepthFunc) (GLenum func);
+GLAPI void (APIENTRYFP11 glPixelStoref) (GLenum pname, GLfloat param);
+GLAPI void (APIENTRYFP11 glPixelStorei) (GLenum pname, GLint param);
+GLAPI void (APIENTRYFP11 glReadBuffer) (GLenum src);
+GLAPI void (APIENTRYFP11 glReadPixels) (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+GLAPI void (APIENTRYFP11 glGetBooleanv) (GLenum pname, GLboolean *data);
+GLAPI void (APIENTRYFP11 glGetDoublev) (GLenum pname, GLdouble *data);
+GLAPI GLenum (APIENTRYFP11 glGetError) (void);
+GLAPI void (APIENTRYFP11 glGetFloatv) (GLenum pname, GLfloat *data);
+GLAPI void (APIENTRYFP11 glGetIntegerv) (GLenum pname, GLint *data);
+GLAPI const GLubyte *(APIENTRYFP11 glGetString) (GLenum name);
+GLAPI void (APIENTRYFP11 glGetTexImage) (GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
+GLAPI void (APIENTRYFP11 glGetTexParameterfv) (GLenum target, GLenum pname, GLfloat *params);
+GLAPI void (APIENTRYFP11 glGetTexParameteriv) (GLenum target, GLenum pname, GLint *params);
+GLAPI void (APIENTRYFP11 glGetTexLevelParameterfv) (GLenum target, GLint level, GLenum pname, GLfloat *params);
+GLAPI void (APIENTRYFP11 glGetTexLevelParameteriv) (GLenum target, GLint level, GLenum pname, GLint *params);
+GLAPI GLboolean (APIENTRYFP11 glIsEnabled) (GLenum cap);
+GLAPI void (APIENTRYFP11 glDepthRange) (GLdouble n, GLdouble f);
+GLAPI void (APIENTRYFP11 glViewport) (GLint x, GLint y, GLsizei width, GLsizei height);
 
 // from GL_VERSION_1_1:
 typedef float GLclampf;
@@ -330,20 +363,20 @@ typedef double GLclampd;
 #define GL_RGBA12                         0x805A
 #define GL_RGBA16                         0x805B
 #define GL_VERTEX_ARRAY                   0x8074
-GLAPI void APIENTRY glDrawArrays (GLenum mode, GLint first, GLsizei count);
-GLAPI void APIENTRY glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices);
-GLAPI void APIENTRY glGetPointerv (GLenum pname, void **params);
-GLAPI void APIENTRY glPolygonOffset (GLfloat factor, GLfloat units);
-GLAPI void APIENTRY glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
-GLAPI void APIENTRY glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
-GLAPI void APIENTRY glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
-GLAPI void APIENTRY glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
-GLAPI void APIENTRY glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
-GLAPI void APIENTRY glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
-GLAPI void APIENTRY glBindTexture (GLenum target, GLuint texture);
-GLAPI void APIENTRY glDeleteTextures (GLsizei n, const GLuint *textures);
-GLAPI void APIENTRY glGenTextures (GLsizei n, GLuint *textures);
-GLAPI GLboolean APIENTRY glIsTexture (GLuint texture);
+GLAPI void (APIENTRYFP11 glDrawArrays) (GLenum mode, GLint first, GLsizei count);
+GLAPI void (APIENTRYFP11 glDrawElements) (GLenum mode, GLsizei count, GLenum type, const void *indices);
+GLAPI void (APIENTRYFP11 glGetPointerv) (GLenum pname, void **params);
+GLAPI void (APIENTRYFP11 glPolygonOffset) (GLfloat factor, GLfloat units);
+GLAPI void (APIENTRYFP11 glCopyTexImage1D) (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
+GLAPI void (APIENTRYFP11 glCopyTexImage2D) (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
+GLAPI void (APIENTRYFP11 glCopyTexSubImage1D) (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+GLAPI void (APIENTRYFP11 glCopyTexSubImage2D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI void (APIENTRYFP11 glTexSubImage1D) (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+GLAPI void (APIENTRYFP11 glTexSubImage2D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+GLAPI void (APIENTRYFP11 glBindTexture) (GLenum target, GLuint texture);
+GLAPI void (APIENTRYFP11 glDeleteTextures) (GLsizei n, const GLuint *textures);
+GLAPI void (APIENTRYFP11 glGenTextures) (GLsizei n, GLuint *textures);
+GLAPI GLboolean (APIENTRYFP11 glIsTexture) (GLuint texture);
 
 // from GL_VERSION_1_2:
 #define GL_UNSIGNED_BYTE_3_3_2            0x8032
@@ -1277,3 +1310,803 @@ GLAPI void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean
 GLAPI void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 
 }
+
+//------------ call layer ------------
+//(generated by make-GL.py --profile --record)
+//Every entry point above is wrapped by a same-named macro that routes the call through gl_layer_call().
+//Profiling: while gl_profile_enabled is set, calls are counted and the CPU time spent in them accumulated.
+//Recording: while gl_record_active is set, calls and the data they reference are written out (see GLRecord.hpp).
+// With both switched off (the default), the cost is a flag check per call.
+
+#include <iosfwd>
+#include <utility>
+
+enum GLLayerIndex : uint32_t {
+	GLP_glCullFace,
+	GLP_glFrontFace,
+	GLP_glHint,
+	GLP_glLineWidth,
+	GLP_glPointSize,
+	GLP_glPolygonMode,
+	GLP_glScissor,
+	GLP_glTexParameterf,
+	GLP_glTexParameterfv,
+	GLP_glTexParameteri,
+	GLP_glTexParameteriv,
+	GLP_glTexImage1D,
+	GLP_glTexImage2D,
+	GLP_glDrawBuffer,
+	GLP_glClear,
+	GLP_glClearColor,
+	GLP_glClearStencil,
+	GLP_glClearDepth,
+	GLP_glStencilMask,
+	GLP_glColorMask,
+	GLP_glDepthMask,
+	GLP_glDisable,
+	GLP_glEnable,
+	GLP_glFinish,
+	GLP_glFlush,
+	GLP_glBlendFunc,
+	GLP_glLogicOp,
+	GLP_glStencilFunc,
+	GLP_glStencilOp,
+	GLP_glDepthFunc,
+	GLP_glPixelStoref,
+	GLP_glPixelStorei,
+	GLP_glReadBuffer,
+	GLP_glReadPixels,
+	GLP_glGetBooleanv,
+	GLP_glGetDoublev,
+	GLP_glGetError,
+	GLP_glGetFloatv,
+	GLP_glGetIntegerv,
+	GLP_glGetString,
+	GLP_glGetTexImage,
+	GLP_glGetTexParameterfv,
+	GLP_glGetTexParameteriv,
+	GLP_glGetTexLevelParameterfv,
+	GLP_glGetTexLevelParameteriv,
+	GLP_glIsEnabled,
+	GLP_glDepthRange,
+	GLP_glViewport,
+	GLP_glDrawArrays,
+	GLP_glDrawElements,
+	GLP_glGetPointerv,
+	GLP_glPolygonOffset,
+	GLP_glCopyTexImage1D,
+	GLP_glCopyTexImage2D,
+	GLP_glCopyTexSubImage1D,
+	GLP_glCopyTexSubImage2D,
+	GLP_glTexSubImage1D,
+	GLP_glTexSubImage2D,
+	GLP_glBindTexture,
+	GLP_glDeleteTextures,
+	GLP_glGenTextures,
+	GLP_glIsTexture,
+	GLP_glDrawRangeElements,
+	GLP_glTexImage3D,
+	GLP_glTexSubImage3D,
+	GLP_glCopyTexSubImage3D,
+	GLP_glActiveTexture,
+	GLP_glSampleCoverage,
+	GLP_glCompressedTexImage3D,
+	GLP_glCompressedTexImage2D,
+	GLP_glCompressedTexImage1D,
+	GLP_glCompressedTexSubImage3D,
+	GLP_glCompressedTexSubImage2D,
+	GLP_glCompressedTexSubImage1D,
+	GLP_glGetCompressedTexImage,
+	GLP_glBlendFuncSeparate,
+	GLP_glMultiDrawArrays,
+	GLP_glMultiDrawElements,
+	GLP_glPointParameterf,
+	GLP_glPointParameterfv,
+	GLP_glPointParameteri,
+	GLP_glPointParameteriv,
+	GLP_glBlendColor,
+	GLP_glBlendEquation,
+	GLP_glGenQueries,
+	GLP_glDeleteQueries,
+	GLP_glIsQuery,
+	GLP_glBeginQuery,
+	GLP_glEndQuery,
+	GLP_glGetQueryiv,
+	GLP_glGetQueryObjectiv,
+	GLP_glGetQueryObjectuiv,
+	GLP_glBindBuffer,
+	GLP_glDeleteBuffers,
+	GLP_glGenBuffers,
+	GLP_glIsBuffer,
+	GLP_glBufferData,
+	GLP_glBufferSubData,
+	GLP_glGetBufferSubData,
+	GLP_glMapBuffer,
+	GLP_glUnmapBuffer,
+	GLP_glGetBufferParameteriv,
+	GLP_glGetBufferPointerv,
+	GLP_glBlendEquationSeparate,
+	GLP_glDrawBuffers,
+	GLP_glStencilOpSeparate,
+	GLP_glStencilFuncSeparate,
+	GLP_glStencilMaskSeparate,
+	GLP_glAttachShader,
+	GLP_glBindAttribLocation,
+	GLP_glCompileShader,
+	GLP_glCreateProgram,
+	GLP_glCreateShader,
+	GLP_glDeleteProgram,
+	GLP_glDeleteShader,
+	GLP_glDetachShader,
+	GLP_glDisableVertexAttribArray,
+	GLP_glEnableVertexAttribArray,
+	GLP_glGetActiveAttrib,
+	GLP_glGetActiveUniform,
+	GLP_glGetAttachedShaders,
+	GLP_glGetAttribLocation,
+	GLP_glGetProgramiv,
+	GLP_glGetProgramInfoLog,
+	GLP_glGetShaderiv,
+	GLP_glGetShaderInfoLog,
+	GLP_glGetShaderSource,
+	GLP_glGetUniformLocation,
+	GLP_glGetUniformfv,
+	GLP_glGetUniformiv,
+	GLP_glGetVertexAttribdv,
+	GLP_glGetVertexAttribfv,
+	GLP_glGetVertexAttribiv,
+	GLP_glGetVertexAttribPointerv,
+	GLP_glIsProgram,
+	GLP_glIsShader,
+	GLP_glLinkProgram,
+	GLP_glShaderSource,
+	GLP_glUseProgram,
+	GLP_glUniform1f,
+	GLP_glUniform2f,
+	GLP_glUniform3f,
+	GLP_glUniform4f,
+	GLP_glUniform1i,
+	GLP_glUniform2i,
+	GLP_glUniform3i,
+	GLP_glUniform4i,
+	GLP_glUniform1fv,
+	GLP_glUniform2fv,
+	GLP_glUniform3fv,
+	GLP_glUniform4fv,
+	GLP_glUniform1iv,
+	GLP_glUniform2iv,
+	GLP_glUniform3iv,
+	GLP_glUniform4iv,
+	GLP_glUniformMatrix2fv,
+	GLP_glUniformMatrix3fv,
+	GLP_glUniformMatrix4fv,
+	GLP_glValidateProgram,
+	GLP_glVertexAttrib1d,
+	GLP_glVertexAttrib1dv,
+	GLP_glVertexAttrib1f,
+	GLP_glVertexAttrib1fv,
+	GLP_glVertexAttrib1s,
+	GLP_glVertexAttrib1sv,
+	GLP_glVertexAttrib2d,
+	GLP_glVertexAttrib2dv,
+	GLP_glVertexAttrib2f,
+	GLP_glVertexAttrib2fv,
+	GLP_glVertexAttrib2s,
+	GLP_glVertexAttrib2sv,
+	GLP_glVertexAttrib3d,
+	GLP_glVertexAttrib3dv,
+	GLP_glVertexAttrib3f,
+	GLP_glVertexAttrib3fv,
+	GLP_glVertexAttrib3s,
+	GLP_glVertexAttrib3sv,
+	GLP_glVertexAttrib4Nbv,
+	GLP_glVertexAttrib4Niv,
+	GLP_glVertexAttrib4Nsv,
+	GLP_glVertexAttrib4Nub,
+	GLP_glVertexAttrib4Nubv,
+	GLP_glVertexAttrib4Nuiv,
+	GLP_glVertexAttrib4Nusv,
+	GLP_glVertexAttrib4bv,
+	GLP_glVertexAttrib4d,
+	GLP_glVertexAttrib4dv,
+	GLP_glVertexAttrib4f,
+	GLP_glVertexAttrib4fv,
+	GLP_glVertexAttrib4iv,
+	GLP_glVertexAttrib4s,
+	GLP_glVertexAttrib4sv,
+	GLP_glVertexAttrib4ubv,
+	GLP_glVertexAttrib4uiv,
+	GLP_glVertexAttrib4usv,
+	GLP_glVertexAttribPointer,
+	GLP_glUniformMatrix2x3fv,
+	GLP_glUniformMatrix3x2fv,
+	GLP_glUniformMatrix2x4fv,
+	GLP_glUniformMatrix4x2fv,
+	GLP_glUniformMatrix3x4fv,
+	GLP_glUniformMatrix4x3fv,
+	GLP_glColorMaski,
+	GLP_glGetBooleani_v,
+	GLP_glGetIntegeri_v,
+	GLP_glEnablei,
+	GLP_glDisablei,
+	GLP_glIsEnabledi,
+	GLP_glBeginTransformFeedback,
+	GLP_glEndTransformFeedback,
+	GLP_glBindBufferRange,
+	GLP_glBindBufferBase,
+	GLP_glTransformFeedbackVaryings,
+	GLP_glGetTransformFeedbackVarying,
+	GLP_glClampColor,
+	GLP_glBeginConditionalRender,
+	GLP_glEndConditionalRender,
+	GLP_glVertexAttribIPointer,
+	GLP_glGetVertexAttribIiv,
+	GLP_glGetVertexAttribIuiv,
+	GLP_glVertexAttribI1i,
+	GLP_glVertexAttribI2i,
+	GLP_glVertexAttribI3i,
+	GLP_glVertexAttribI4i,
+	GLP_glVertexAttribI1ui,
+	GLP_glVertexAttribI2ui,
+	GLP_glVertexAttribI3ui,
+	GLP_glVertexAttribI4ui,
+	GLP_glVertexAttribI1iv,
+	GLP_glVertexAttribI2iv,
+	GLP_glVertexAttribI3iv,
+	GLP_glVertexAttribI4iv,
+	GLP_glVertexAttribI1uiv,
+	GLP_glVertexAttribI2uiv,
+	GLP_glVertexAttribI3uiv,
+	GLP_glVertexAttribI4uiv,
+	GLP_glVertexAttribI4bv,
+	GLP_glVertexAttribI4sv,
+	GLP_glVertexAttribI4ubv,
+	GLP_glVertexAttribI4usv,
+	GLP_glGetUniformuiv,
+	GLP_glBindFragDataLocation,
+	GLP_glGetFragDataLocation,
+	GLP_glUniform1ui,
+	GLP_glUniform2ui,
+	GLP_glUniform3ui,
+	GLP_glUniform4ui,
+	GLP_glUniform1uiv,
+	GLP_glUniform2uiv,
+	GLP_glUniform3uiv,
+	GLP_glUniform4uiv,
+	GLP_glTexParameterIiv,
+	GLP_glTexParameterIuiv,
+	GLP_glGetTexParameterIiv,
+	GLP_glGetTexParameterIuiv,
+	GLP_glClearBufferiv,
+	GLP_glClearBufferuiv,
+	GLP_glClearBufferfv,
+	GLP_glClearBufferfi,
+	GLP_glGetStringi,
+	GLP_glIsRenderbuffer,
+	GLP_glBindRenderbuffer,
+	GLP_glDeleteRenderbuffers,
+	GLP_glGenRenderbuffers,
+	GLP_glRenderbufferStorage,
+	GLP_glGetRenderbufferParameteriv,
+	GLP_glIsFramebuffer,
+	GLP_glBindFramebuffer,
+	GLP_glDeleteFramebuffers,
+	GLP_glGenFramebuffers,
+	GLP_glCheckFramebufferStatus,
+	GLP_glFramebufferTexture1D,
+	GLP_glFramebufferTexture2D,
+	GLP_glFramebufferTexture3D,
+	GLP_glFramebufferRenderbuffer,
+	GLP_glGetFramebufferAttachmentParameteriv,
+	GLP_glGenerateMipmap,
+	GLP_glBlitFramebuffer,
+	GLP_glRenderbufferStorageMultisample,
+	GLP_glFramebufferTextureLayer,
+	GLP_glMapBufferRange,
+	GLP_glFlushMappedBufferRange,
+	GLP_glBindVertexArray,
+	GLP_glDeleteVertexArrays,
+	GLP_glGenVertexArrays,
+	GLP_glIsVertexArray,
+	GLP_glDrawArraysInstanced,
+	GLP_glDrawElementsInstanced,
+	GLP_glTexBuffer,
+	GLP_glPrimitiveRestartIndex,
+	GLP_glCopyBufferSubData,
+	GLP_glGetUniformIndices,
+	GLP_glGetActiveUniformsiv,
+	GLP_glGetActiveUniformName,
+	GLP_glGetUniformBlockIndex,
+	GLP_glGetActiveUniformBlockiv,
+	GLP_glGetActiveUniformBlockName,
+	GLP_glUniformBlockBinding,
+	GLP_glDrawElementsBaseVertex,
+	GLP_glDrawRangeElementsBaseVertex,
+	GLP_glDrawElementsInstancedBaseVertex,
+	GLP_glMultiDrawElementsBaseVertex,
+	GLP_glProvokingVertex,
+	GLP_glFenceSync,
+	GLP_glIsSync,
+	GLP_glDeleteSync,
+	GLP_glClientWaitSync,
+	GLP_glWaitSync,
+	GLP_glGetInteger64v,
+	GLP_glGetSynciv,
+	GLP_glGetInteger64i_v,
+	GLP_glGetBufferParameteri64v,
+	GLP_glFramebufferTexture,
+	GLP_glTexImage2DMultisample,
+	GLP_glTexImage3DMultisample,
+	GLP_glGetMultisamplefv,
+	GLP_glSampleMaski,
+	GLP_glBindFragDataLocationIndexed,
+	GLP_glGetFragDataIndex,
+	GLP_glGenSamplers,
+	GLP_glDeleteSamplers,
+	GLP_glIsSampler,
+	GLP_glBindSampler,
+	GLP_glSamplerParameteri,
+	GLP_glSamplerParameteriv,
+	GLP_glSamplerParameterf,
+	GLP_glSamplerParameterfv,
+	GLP_glSamplerParameterIiv,
+	GLP_glSamplerParameterIuiv,
+	GLP_glGetSamplerParameteriv,
+	GLP_glGetSamplerParameterIiv,
+	GLP_glGetSamplerParameterfv,
+	GLP_glGetSamplerParameterIuiv,
+	GLP_glQueryCounter,
+	GLP_glGetQueryObjecti64v,
+	GLP_glGetQueryObjectui64v,
+	GLP_glVertexAttribDivisor,
+	GLP_glVertexAttribP1ui,
+	GLP_glVertexAttribP1uiv,
+	GLP_glVertexAttribP2ui,
+	GLP_glVertexAttribP2uiv,
+	GLP_glVertexAttribP3ui,
+	GLP_glVertexAttribP3uiv,
+	GLP_glVertexAttribP4ui,
+	GLP_glVertexAttribP4uiv,
+	GLP_COUNT
+};
+
+extern char const *gl_layer_names[GLP_COUNT]; //"glBindBuffer", etc.
+
+#define GL_PROFILE_LAYER 1
+
+extern bool gl_profile_enabled;
+
+//print call counts and time for every entry point called since the last reset (most time first):
+void gl_profile_dump(std::ostream &out);
+void gl_profile_reset();
+
+uint64_t gl_profile_now(); //nanoseconds, from an arbitrary start
+void gl_profile_record(uint32_t index, uint64_t start);
+
+struct GLProfileCall {
+	GLProfileCall(uint32_t index_) : index(index_), enabled(gl_profile_enabled) {
+		if (enabled) start = gl_profile_now();
+	}
+	~GLProfileCall() {
+		if (enabled) gl_profile_record(index, start);
+	}
+	uint32_t index;
+	bool enabled;
+	uint64_t start = 0;
+};
+
+#define GL_RECORD_LAYER 1
+
+#include <cstring>
+#include <type_traits>
+
+extern bool gl_record_active;
+
+//called after every call while recording; 'values' holds the arguments, encoded by gl_record_value():
+void gl_record_call(uint32_t index, uint64_t const *values, uint32_t count, uint64_t returned);
+
+//one character per parameter: 'v' for values, 'i' for input pointers, 'o' for output pointers:
+extern char const *gl_record_signatures[GLP_COUNT];
+
+//size of the data a pointer parameter refers to (GLRecordNoPayload if unknown or not worth recording):
+constexpr uint64_t GLRecordNoPayload = ~0ULL;
+uint64_t gl_record_payload_size(uint32_t index, uint32_t param, uint64_t const *values);
+//size of a client-memory image, assuming the default (4-byte) row alignment:
+uint64_t gl_record_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type);
+
+//arguments are stored as 64-bit values (signed integers sign-extended, floats as their bits):
+template< typename T >
+inline typename std::enable_if< std::is_integral< T >::value, uint64_t >::type gl_record_value(T v) {
+	return uint64_t(int64_t(v));
+}
+template< typename T >
+inline uint64_t gl_record_value(T *v) {
+	return uint64_t(uintptr_t(v));
+}
+inline uint64_t gl_record_value(float v) {
+	uint32_t bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return bits;
+}
+inline uint64_t gl_record_value(double v) {
+	uint64_t bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return bits;
+}
+
+template< typename R >
+struct GLLayerRecord {
+	template< typename... P >
+	static R call(uint32_t index, R (APIENTRY *fn)(P...), P... params) {
+		R ret = fn(params...);
+		uint64_t values[sizeof...(P) + 1] = { gl_record_value(params)... };
+		gl_record_call(index, values, sizeof...(P), gl_record_value(ret));
+		return ret;
+	}
+};
+template< >
+struct GLLayerRecord< void > {
+	template< typename... P >
+	static void call(uint32_t index, void (APIENTRY *fn)(P...), P... params) {
+		fn(params...);
+		uint64_t values[sizeof...(P) + 1] = { gl_record_value(params)... };
+		gl_record_call(index, values, sizeof...(P), 0);
+	}
+};
+
+//(parameters are not deduced from the arguments, so they convert just like they would for a direct call)
+template< typename T >
+struct GLLayerIdentity { typedef T type; };
+
+template< typename R, typename... P >
+inline R gl_layer_call(uint32_t index, R (APIENTRY *fn)(P...), typename GLLayerIdentity< P >::type... params) {
+	GLProfileCall call(index);
+	if (gl_record_active) return GLLayerRecord< R >::call(index, fn, params...);
+	return fn(params...);
+}
+
+#define glCullFace(...) gl_layer_call(GLP_glCullFace, glCullFace, __VA_ARGS__)
+#define glFrontFace(...) gl_layer_call(GLP_glFrontFace, glFrontFace, __VA_ARGS__)
+#define glHint(...) gl_layer_call(GLP_glHint, glHint, __VA_ARGS__)
+#define glLineWidth(...) gl_layer_call(GLP_glLineWidth, glLineWidth, __VA_ARGS__)
+#define glPointSize(...) gl_layer_call(GLP_glPointSize, glPointSize, __VA_ARGS__)
+#define glPolygonMode(...) gl_layer_call(GLP_glPolygonMode, glPolygonMode, __VA_ARGS__)
+#define glScissor(...) gl_layer_call(GLP_glScissor, glScissor, __VA_ARGS__)
+#define glTexParameterf(...) gl_layer_call(GLP_glTexParameterf, glTexParameterf, __VA_ARGS__)
+#define glTexParameterfv(...) gl_layer_call(GLP_glTexParameterfv, glTexParameterfv, __VA_ARGS__)
+#define glTexParameteri(...) gl_layer_call(GLP_glTexParameteri, glTexParameteri, __VA_ARGS__)
+#define glTexParameteriv(...) gl_layer_call(GLP_glTexParameteriv, glTexParameteriv, __VA_ARGS__)
+#define glTexImage1D(...) gl_layer_call(GLP_glTexImage1D, glTexImage1D, __VA_ARGS__)
+#define glTexImage2D(...) gl_layer_call(GLP_glTexImage2D, glTexImage2D, __VA_ARGS__)
+#define glDrawBuffer(...) gl_layer_call(GLP_glDrawBuffer, glDrawBuffer, __VA_ARGS__)
+#define glClear(...) gl_layer_call(GLP_glClear, glClear, __VA_ARGS__)
+#define glClearColor(...) gl_layer_call(GLP_glClearColor, glClearColor, __VA_ARGS__)
+#define glClearStencil(...) gl_layer_call(GLP_glClearStencil, glClearStencil, __VA_ARGS__)
+#define glClearDepth(...) gl_layer_call(GLP_glClearDepth, glClearDepth, __VA_ARGS__)
+#define glStencilMask(...) gl_layer_call(GLP_glStencilMask, glStencilMask, __VA_ARGS__)
+#define glColorMask(...) gl_layer_call(GLP_glColorMask, glColorMask, __VA_ARGS__)
+#define glDepthMask(...) gl_layer_call(GLP_glDepthMask, glDepthMask, __VA_ARGS__)
+#define glDisable(...) gl_layer_call(GLP_glDisable, glDisable, __VA_ARGS__)
+#define glEnable(...) gl_layer_call(GLP_glEnable, glEnable, __VA_ARGS__)
+#define glFinish() gl_layer_call(GLP_glFinish, glFinish)
+#define glFlush() gl_layer_call(GLP_glFlush, glFlush)
+#define glBlendFunc(...) gl_layer_call(GLP_glBlendFunc, glBlendFunc, __VA_ARGS__)
+#define glLogicOp(...) gl_layer_call(GLP_glLogicOp, glLogicOp, __VA_ARGS__)
+#define glStencilFunc(...) gl_layer_call(GLP_glStencilFunc, glStencilFunc, __VA_ARGS__)
+#define glStencilOp(...) gl_layer_call(GLP_glStencilOp, glStencilOp, __VA_ARGS__)
+#define glDepthFunc(...) gl_layer_call(GLP_glDepthFunc, glDepthFunc, __VA_ARGS__)
+#define glPixelStoref(...) gl_layer_call(GLP_glPixelStoref, glPixelStoref, __VA_ARGS__)
+#define glPixelStorei(...) gl_layer_call(GLP_glPixelStorei, glPixelStorei, __VA_ARGS__)
+#define glReadBuffer(...) gl_layer_call(GLP_glReadBuffer, glReadBuffer, __VA_ARGS__)
+#define glReadPixels(...) gl_layer_call(GLP_glReadPixels, glReadPixels, __VA_ARGS__)
+#define glGetBooleanv(...) gl_layer_call(GLP_glGetBooleanv, glGetBooleanv, __VA_ARGS__)
+#define glGetDoublev(...) gl_layer_call(GLP_glGetDoublev, glGetDoublev, __VA_ARGS__)
+#define glGetError() gl_layer_call(GLP_glGetError, glGetError)
+#define glGetFloatv(...) gl_layer_call(GLP_glGetFloatv, glGetFloatv, __VA_ARGS__)
+#define glGetIntegerv(...) gl_layer_call(GLP_glGetIntegerv, glGetIntegerv, __VA_ARGS__)
+#define glGetString(...) gl_layer_call(GLP_glGetString, glGetString, __VA_ARGS__)
+#define glGetTexImage(...) gl_layer_call(GLP_glGetTexImage, glGetTexImage, __VA_ARGS__)
+#define glGetTexParameterfv(...) gl_layer_call(GLP_glGetTexParameterfv, glGetTexParameterfv, __VA_ARGS__)
+#define glGetTexParameteriv(...) gl_layer_call(GLP_glGetTexParameteriv, glGetTexParameteriv, __VA_ARGS__)
+#define glGetTexLevelParameterfv(...) gl_layer_call(GLP_glGetTexLevelParameterfv, glGetTexLevelParameterfv, __VA_ARGS__)
+#define glGetTexLevelParameteriv(...) gl_layer_call(GLP_glGetTexLevelParameteriv, glGetTexLevelParameteriv, __VA_ARGS__)
+#define glIsEnabled(...) gl_layer_call(GLP_glIsEnabled, glIsEnabled, __VA_ARGS__)
+#define glDepthRange(...) gl_layer_call(GLP_glDepthRange, glDepthRange, __VA_ARGS__)
+#define glViewport(...) gl_layer_call(GLP_glViewport, glViewport, __VA_ARGS__)
+#define glDrawArrays(...) gl_layer_call(GLP_glDrawArrays, glDrawArrays, __VA_ARGS__)
+#define glDrawElements(...) gl_layer_call(GLP_glDrawElements, glDrawElements, __VA_ARGS__)
+#define glGetPointerv(...) gl_layer_call(GLP_glGetPointerv, glGetPointerv, __VA_ARGS__)
+#define glPolygonOffset(...) gl_layer_call(GLP_glPolygonOffset, glPolygonOffset, __VA_ARGS__)
+#define glCopyTexImage1D(...) gl_layer_call(GLP_glCopyTexImage1D, glCopyTexImage1D, __VA_ARGS__)
+#define glCopyTexImage2D(...) gl_layer_call(GLP_glCopyTexImage2D, glCopyTexImage2D, __VA_ARGS__)
+#define glCopyTexSubImage1D(...) gl_layer_call(GLP_glCopyTexSubImage1D, glCopyTexSubImage1D, __VA_ARGS__)
+#define glCopyTexSubImage2D(...) gl_layer_call(GLP_glCopyTexSubImage2D, glCopyTexSubImage2D, __VA_ARGS__)
+#define glTexSubImage1D(...) gl_layer_call(GLP_glTexSubImage1D, glTexSubImage1D, __VA_ARGS__)
+#define glTexSubImage2D(...) gl_layer_call(GLP_glTexSubImage2D, glTexSubImage2D, __VA_ARGS__)
+#define glBindTexture(...) gl_layer_call(GLP_glBindTexture, glBindTexture, __VA_ARGS__)
+#define glDeleteTextures(...) gl_layer_call(GLP_glDeleteTextures, glDeleteTextures, __VA_ARGS__)
+#define glGenTextures(...) gl_layer_call(GLP_glGenTextures, glGenTextures, __VA_ARGS__)
+#define glIsTexture(...) gl_layer_call(GLP_glIsTexture, glIsTexture, __VA_ARGS__)
+#define glDrawRangeElements(...) gl_layer_call(GLP_glDrawRangeElements, glDrawRangeElements, __VA_ARGS__)
+#define glTexImage3D(...) gl_layer_call(GLP_glTexImage3D, glTexImage3D, __VA_ARGS__)
+#define glTexSubImage3D(...) gl_layer_call(GLP_glTexSubImage3D, glTexSubImage3D, __VA_ARGS__)
+#define glCopyTexSubImage3D(...) gl_layer_call(GLP_glCopyTexSubImage3D, glCopyTexSubImage3D, __VA_ARGS__)
+#define glActiveTexture(...) gl_layer_call(GLP_glActiveTexture, glActiveTexture, __VA_ARGS__)
+#define glSampleCoverage(...) gl_layer_call(GLP_glSampleCoverage, glSampleCoverage, __VA_ARGS__)
+#define glCompressedTexImage3D(...) gl_layer_call(GLP_glCompressedTexImage3D, glCompressedTexImage3D, __VA_ARGS__)
+#define glCompressedTexImage2D(...) gl_layer_call(GLP_glCompressedTexImage2D, glCompressedTexImage2D, __VA_ARGS__)
+#define glCompressedTexImage1D(...) gl_layer_call(GLP_glCompressedTexImage1D, glCompressedTexImage1D, __VA_ARGS__)
+#define glCompressedTexSubImage3D(...) gl_layer_call(GLP_glCompressedTexSubImage3D, glCompressedTexSubImage3D, __VA_ARGS__)
+#define glCompressedTexSubImage2D(...) gl_layer_call(GLP_glCompressedTexSubImage2D, glCompressedTexSubImage2D, __VA_ARGS__)
+#define glCompressedTexSubImage1D(...) gl_layer_call(GLP_glCompressedTexSubImage1D, glCompressedTexSubImage1D, __VA_ARGS__)
+#define glGetCompressedTexImage(...) gl_layer_call(GLP_glGetCompressedTexImage, glGetCompressedTexImage, __VA_ARGS__)
+#define glBlendFuncSeparate(...) gl_layer_call(GLP_glBlendFuncSeparate, glBlendFuncSeparate, __VA_ARGS__)
+#define glMultiDrawArrays(...) gl_layer_call(GLP_glMultiDrawArrays, glMultiDrawArrays, __VA_ARGS__)
+#define glMultiDrawElements(...) gl_layer_call(GLP_glMultiDrawElements, glMultiDrawElements, __VA_ARGS__)
+#define glPointParameterf(...) gl_layer_call(GLP_glPointParameterf, glPointParameterf, __VA_ARGS__)
+#define glPointParameterfv(...) gl_layer_call(GLP_glPointParameterfv, glPointParameterfv, __VA_ARGS__)
+#define glPointParameteri(...) gl_layer_call(GLP_glPointParameteri, glPointParameteri, __VA_ARGS__)
+#define glPointParameteriv(...) gl_layer_call(GLP_glPointParameteriv, glPointParameteriv, __VA_ARGS__)
+#define glBlendColor(...) gl_layer_call(GLP_glBlendColor, glBlendColor, __VA_ARGS__)
+#define glBlendEquation(...) gl_layer_call(GLP_glBlendEquation, glBlendEquation, __VA_ARGS__)
+#define glGenQueries(...) gl_layer_call(GLP_glGenQueries, glGenQueries, __VA_ARGS__)
+#define glDeleteQueries(...) gl_layer_call(GLP_glDeleteQueries, glDeleteQueries, __VA_ARGS__)
+#define glIsQuery(...) gl_layer_call(GLP_glIsQuery, glIsQuery, __VA_ARGS__)
+#define glBeginQuery(...) gl_layer_call(GLP_glBeginQuery, glBeginQuery, __VA_ARGS__)
+#define glEndQuery(...) gl_layer_call(GLP_glEndQuery, glEndQuery, __VA_ARGS__)
+#define glGetQueryiv(...) gl_layer_call(GLP_glGetQueryiv, glGetQueryiv, __VA_ARGS__)
+#define glGetQueryObjectiv(...) gl_layer_call(GLP_glGetQueryObjectiv, glGetQueryObjectiv, __VA_ARGS__)
+#define glGetQueryObjectuiv(...) gl_layer_call(GLP_glGetQueryObjectuiv, glGetQueryObjectuiv, __VA_ARGS__)
+#define glBindBuffer(...) gl_layer_call(GLP_glBindBuffer, glBindBuffer, __VA_ARGS__)
+#define glDeleteBuffers(...) gl_layer_call(GLP_glDeleteBuffers, glDeleteBuffers, __VA_ARGS__)
+#define glGenBuffers(...) gl_layer_call(GLP_glGenBuffers, glGenBuffers, __VA_ARGS__)
+#define glIsBuffer(...) gl_layer_call(GLP_glIsBuffer, glIsBuffer, __VA_ARGS__)
+#define glBufferData(...) gl_layer_call(GLP_glBufferData, glBufferData, __VA_ARGS__)
+#define glBufferSubData(...) gl_layer_call(GLP_glBufferSubData, glBufferSubData, __VA_ARGS__)
+#define glGetBufferSubData(...) gl_layer_call(GLP_glGetBufferSubData, glGetBufferSubData, __VA_ARGS__)
+#define glMapBuffer(...) gl_layer_call(GLP_glMapBuffer, glMapBuffer, __VA_ARGS__)
+#define glUnmapBuffer(...) gl_layer_call(GLP_glUnmapBuffer, glUnmapBuffer, __VA_ARGS__)
+#define glGetBufferParameteriv(...) gl_layer_call(GLP_glGetBufferParameteriv, glGetBufferParameteriv, __VA_ARGS__)
+#define glGetBufferPointerv(...) gl_layer_call(GLP_glGetBufferPointerv, glGetBufferPointerv, __VA_ARGS__)
+#define glBlendEquationSeparate(...) gl_layer_call(GLP_glBlendEquationSeparate, glBlendEquationSeparate, __VA_ARGS__)
+#define glDrawBuffers(...) gl_layer_call(GLP_glDrawBuffers, glDrawBuffers, __VA_ARGS__)
+#define glStencilOpSeparate(...) gl_layer_call(GLP_glStencilOpSeparate, glStencilOpSeparate, __VA_ARGS__)
+#define glStencilFuncSeparate(...) gl_layer_call(GLP_glStencilFuncSeparate, glStencilFuncSeparate, __VA_ARGS__)
+#define glStencilMaskSeparate(...) gl_layer_call(GLP_glStencilMaskSeparate, glStencilMaskSeparate, __VA_ARGS__)
+#define glAttachShader(...) gl_layer_call(GLP_glAttachShader, glAttachShader, __VA_ARGS__)
+#define glBindAttribLocation(...) gl_layer_call(GLP_glBindAttribLocation, glBindAttribLocation, __VA_ARGS__)
+#define glCompileShader(...) gl_layer_call(GLP_glCompileShader, glCompileShader, __VA_ARGS__)
+#define glCreateProgram() gl_layer_call(GLP_glCreateProgram, glCreateProgram)
+#define glCreateShader(...) gl_layer_call(GLP_glCreateShader, glCreateShader, __VA_ARGS__)
+#define glDeleteProgram(...) gl_layer_call(GLP_glDeleteProgram, glDeleteProgram, __VA_ARGS__)
+#define glDeleteShader(...) gl_layer_call(GLP_glDeleteShader, glDeleteShader, __VA_ARGS__)
+#define glDetachShader(...) gl_layer_call(GLP_glDetachShader, glDetachShader, __VA_ARGS__)
+#define glDisableVertexAttribArray(...) gl_layer_call(GLP_glDisableVertexAttribArray, glDisableVertexAttribArray, __VA_ARGS__)
+#define glEnableVertexAttribArray(...) gl_layer_call(GLP_glEnableVertexAttribArray, glEnableVertexAttribArray, __VA_ARGS__)
+#define glGetActiveAttrib(...) gl_layer_call(GLP_glGetActiveAttrib, glGetActiveAttrib, __VA_ARGS__)
+#define glGetActiveUniform(...) gl_layer_call(GLP_glGetActiveUniform, glGetActiveUniform, __VA_ARGS__)
+#define glGetAttachedShaders(...) gl_layer_call(GLP_glGetAttachedShaders, glGetAttachedShaders, __VA_ARGS__)
+#define glGetAttribLocation(...) gl_layer_call(GLP_glGetAttribLocation, glGetAttribLocation, __VA_ARGS__)
+#define glGetProgramiv(...) gl_layer_call(GLP_glGetProgramiv, glGetProgramiv, __VA_ARGS__)
+#define glGetProgramInfoLog(...) gl_layer_call(GLP_glGetProgramInfoLog, glGetProgramInfoLog, __VA_ARGS__)
+#define glGetShaderiv(...) gl_layer_call(GLP_glGetShaderiv, glGetShaderiv, __VA_ARGS__)
+#define glGetShaderInfoLog(...) gl_layer_call(GLP_glGetShaderInfoLog, glGetShaderInfoLog, __VA_ARGS__)
+#define glGetShaderSource(...) gl_layer_call(GLP_glGetShaderSource, glGetShaderSource, __VA_ARGS__)
+#define glGetUniformLocation(...) gl_layer_call(GLP_glGetUniformLocation, glGetUniformLocation, __VA_ARGS__)
+#define glGetUniformfv(...) gl_layer_call(GLP_glGetUniformfv, glGetUniformfv, __VA_ARGS__)
+#define glGetUniformiv(...) gl_layer_call(GLP_glGetUniformiv, glGetUniformiv, __VA_ARGS__)
+#define glGetVertexAttribdv(...) gl_layer_call(GLP_glGetVertexAttribdv, glGetVertexAttribdv, __VA_ARGS__)
+#define glGetVertexAttribfv(...) gl_layer_call(GLP_glGetVertexAttribfv, glGetVertexAttribfv, __VA_ARGS__)
+#define glGetVertexAttribiv(...) gl_layer_call(GLP_glGetVertexAttribiv, glGetVertexAttribiv, __VA_ARGS__)
+#define glGetVertexAttribPointerv(...) gl_layer_call(GLP_glGetVertexAttribPointerv, glGetVertexAttribPointerv, __VA_ARGS__)
+#define glIsProgram(...) gl_layer_call(GLP_glIsProgram, glIsProgram, __VA_ARGS__)
+#define glIsShader(...) gl_layer_call(GLP_glIsShader, glIsShader, __VA_ARGS__)
+#define glLinkProgram(...) gl_layer_call(GLP_glLinkProgram, glLinkProgram, __VA_ARGS__)
+#define glShaderSource(...) gl_layer_call(GLP_glShaderSource, glShaderSource, __VA_ARGS__)
+#define glUseProgram(...) gl_layer_call(GLP_glUseProgram, glUseProgram, __VA_ARGS__)
+#define glUniform1f(...) gl_layer_call(GLP_glUniform1f, glUniform1f, __VA_ARGS__)
+#define glUniform2f(...) gl_layer_call(GLP_glUniform2f, glUniform2f, __VA_ARGS__)
+#define glUniform3f(...) gl_layer_call(GLP_glUniform3f, glUniform3f, __VA_ARGS__)
+#define glUniform4f(...) gl_layer_call(GLP_glUniform4f, glUniform4f, __VA_ARGS__)
+#define glUniform1i(...) gl_layer_call(GLP_glUniform1i, glUniform1i, __VA_ARGS__)
+#define glUniform2i(...) gl_layer_call(GLP_glUniform2i, glUniform2i, __VA_ARGS__)
+#define glUniform3i(...) gl_layer_call(GLP_glUniform3i, glUniform3i, __VA_ARGS__)
+#define glUniform4i(...) gl_layer_call(GLP_glUniform4i, glUniform4i, __VA_ARGS__)
+#define glUniform1fv(...) gl_layer_call(GLP_glUniform1fv, glUniform1fv, __VA_ARGS__)
+#define glUniform2fv(...) gl_layer_call(GLP_glUniform2fv, glUniform2fv, __VA_ARGS__)
+#define glUniform3fv(...) gl_layer_call(GLP_glUniform3fv, glUniform3fv, __VA_ARGS__)
+#define glUniform4fv(...) gl_layer_call(GLP_glUniform4fv, glUniform4fv, __VA_ARGS__)
+#define glUniform1iv(...) gl_layer_call(GLP_glUniform1iv, glUniform1iv, __VA_ARGS__)
+#define glUniform2iv(...) gl_layer_call(GLP_glUniform2iv, glUniform2iv, __VA_ARGS__)
+#define glUniform3iv(...) gl_layer_call(GLP_glUniform3iv, glUniform3iv, __VA_ARGS__)
+#define glUniform4iv(...) gl_layer_call(GLP_glUniform4iv, glUniform4iv, __VA_ARGS__)
+#define glUniformMatrix2fv(...) gl_layer_call(GLP_glUniformMatrix2fv, glUniformMatrix2fv, __VA_ARGS__)
+#define glUniformMatrix3fv(...) gl_layer_call(GLP_glUniformMatrix3fv, glUniformMatrix3fv, __VA_ARGS__)
+#define glUniformMatrix4fv(...) gl_layer_call(GLP_glUniformMatrix4fv, glUniformMatrix4fv, __VA_ARGS__)
+#define glValidateProgram(...) gl_layer_call(GLP_glValidateProgram, glValidateProgram, __VA_ARGS__)
+#define glVertexAttrib1d(...) gl_layer_call(GLP_glVertexAttrib1d, glVertexAttrib1d, __VA_ARGS__)
+#define glVertexAttrib1dv(...) gl_layer_call(GLP_glVertexAttrib1dv, glVertexAttrib1dv, __VA_ARGS__)
+#define glVertexAttrib1f(...) gl_layer_call(GLP_glVertexAttrib1f, glVertexAttrib1f, __VA_ARGS__)
+#define glVertexAttrib1fv(...) gl_layer_call(GLP_glVertexAttrib1fv, glVertexAttrib1fv, __VA_ARGS__)
+#define glVertexAttrib1s(...) gl_layer_call(GLP_glVertexAttrib1s, glVertexAttrib1s, __VA_ARGS__)
+#define glVertexAttrib1sv(...) gl_layer_call(GLP_glVertexAttrib1sv, glVertexAttrib1sv, __VA_ARGS__)
+#define glVertexAttrib2d(...) gl_layer_call(GLP_glVertexAttrib2d, glVertexAttrib2d, __VA_ARGS__)
+#define glVertexAttrib2dv(...) gl_layer_call(GLP_glVertexAttrib2dv, glVertexAttrib2dv, __VA_ARGS__)
+#define glVertexAttrib2f(...) gl_layer_call(GLP_glVertexAttrib2f, glVertexAttrib2f, __VA_ARGS__)
+#define glVertexAttrib2fv(...) gl_layer_call(GLP_glVertexAttrib2fv, glVertexAttrib2fv, __VA_ARGS__)
+#define glVertexAttrib2s(...) gl_layer_call(GLP_glVertexAttrib2s, glVertexAttrib2s, __VA_ARGS__)
+#define glVertexAttrib2sv(...) gl_layer_call(GLP_glVertexAttrib2sv, glVertexAttrib2sv, __VA_ARGS__)
+#define glVertexAttrib3d(...) gl_layer_call(GLP_glVertexAttrib3d, glVertexAttrib3d, __VA_ARGS__)
+#define glVertexAttrib3dv(...) gl_layer_call(GLP_glVertexAttrib3dv, glVertexAttrib3dv, __VA_ARGS__)
+#define glVertexAttrib3f(...) gl_layer_call(GLP_glVertexAttrib3f, glVertexAttrib3f, __VA_ARGS__)
+#define glVertexAttrib3fv(...) gl_layer_call(GLP_glVertexAttrib3fv, glVertexAttrib3fv, __VA_ARGS__)
+#define glVertexAttrib3s(...) gl_layer_call(GLP_glVertexAttrib3s, glVertexAttrib3s, __VA_ARGS__)
+#define glVertexAttrib3sv(...) gl_layer_call(GLP_glVertexAttrib3sv, glVertexAttrib3sv, __VA_ARGS__)
+#define glVertexAttrib4Nbv(...) gl_layer_call(GLP_glVertexAttrib4Nbv, glVertexAttrib4Nbv, __VA_ARGS__)
+#define glVertexAttrib4Niv(...) gl_layer_call(GLP_glVertexAttrib4Niv, glVertexAttrib4Niv, __VA_ARGS__)
+#define glVertexAttrib4Nsv(...) gl_layer_call(GLP_glVertexAttrib4Nsv, glVertexAttrib4Nsv, __VA_ARGS__)
+#define glVertexAttrib4Nub(...) gl_layer_call(GLP_glVertexAttrib4Nub, glVertexAttrib4Nub, __VA_ARGS__)
+#define glVertexAttrib4Nubv(...) gl_layer_call(GLP_glVertexAttrib4Nubv, glVertexAttrib4Nubv, __VA_ARGS__)
+#define glVertexAttrib4Nuiv(...) gl_layer_call(GLP_glVertexAttrib4Nuiv, glVertexAttrib4Nuiv, __VA_ARGS__)
+#define glVertexAttrib4Nusv(...) gl_layer_call(GLP_glVertexAttrib4Nusv, glVertexAttrib4Nusv, __VA_ARGS__)
+#define glVertexAttrib4bv(...) gl_layer_call(GLP_glVertexAttrib4bv, glVertexAttrib4bv, __VA_ARGS__)
+#define glVertexAttrib4d(...) gl_layer_call(GLP_glVertexAttrib4d, glVertexAttrib4d, __VA_ARGS__)
+#define glVertexAttrib4dv(...) gl_layer_call(GLP_glVertexAttrib4dv, glVertexAttrib4dv, __VA_ARGS__)
+#define glVertexAttrib4f(...) gl_layer_call(GLP_glVertexAttrib4f, glVertexAttrib4f, __VA_ARGS__)
+#define glVertexAttrib4fv(...) gl_layer_call(GLP_glVertexAttrib4fv, glVertexAttrib4fv, __VA_ARGS__)
+#define glVertexAttrib4iv(...) gl_layer_call(GLP_glVertexAttrib4iv, glVertexAttrib4iv, __VA_ARGS__)
+#define glVertexAttrib4s(...) gl_layer_call(GLP_glVertexAttrib4s, glVertexAttrib4s, __VA_ARGS__)
+#define glVertexAttrib4sv(...) gl_layer_call(GLP_glVertexAttrib4sv, glVertexAttrib4sv, __VA_ARGS__)
+#define glVertexAttrib4ubv(...) gl_layer_call(GLP_glVertexAttrib4ubv, glVertexAttrib4ubv, __VA_ARGS__)
+#define glVertexAttrib4uiv(...) gl_layer_call(GLP_glVertexAttrib4uiv, glVertexAttrib4uiv, __VA_ARGS__)
+#define glVertexAttrib4usv(...) gl_layer_call(GLP_glVertexAttrib4usv, glVertexAttrib4usv, __VA_ARGS__)
+#define glVertexAttribPointer(...) gl_layer_call(GLP_glVertexAttribPointer, glVertexAttribPointer, __VA_ARGS__)
+#define glUniformMatrix2x3fv(...) gl_layer_call(GLP_glUniformMatrix2x3fv, glUniformMatrix2x3fv, __VA_ARGS__)
+#define glUniformMatrix3x2fv(...) gl_layer_call(GLP_glUniformMatrix3x2fv, glUniformMatrix3x2fv, __VA_ARGS__)
+#define glUniformMatrix2x4fv(...) gl_layer_call(GLP_glUniformMatrix2x4fv, glUniformMatrix2x4fv, __VA_ARGS__)
+#define glUniformMatrix4x2fv(...) gl_layer_call(GLP_glUniformMatrix4x2fv, glUniformMatrix4x2fv, __VA_ARGS__)
+#define glUniformMatrix3x4fv(...) gl_layer_call(GLP_glUniformMatrix3x4fv, glUniformMatrix3x4fv, __VA_ARGS__)
+#define glUniformMatrix4x3fv(...) gl_layer_call(GLP_glUniformMatrix4x3fv, glUniformMatrix4x3fv, __VA_ARGS__)
+#define glColorMaski(...) gl_layer_call(GLP_glColorMaski, glColorMaski, __VA_ARGS__)
+#define glGetBooleani_v(...) gl_layer_call(GLP_glGetBooleani_v, glGetBooleani_v, __VA_ARGS__)
+#define glGetIntegeri_v(...) gl_layer_call(GLP_glGetIntegeri_v, glGetIntegeri_v, __VA_ARGS__)
+#define glEnablei(...) gl_layer_call(GLP_glEnablei, glEnablei, __VA_ARGS__)
+#define glDisablei(...) gl_layer_call(GLP_glDisablei, glDisablei, __VA_ARGS__)
+#define glIsEnabledi(...) gl_layer_call(GLP_glIsEnabledi, glIsEnabledi, __VA_ARGS__)
+#define glBeginTransformFeedback(...) gl_layer_call(GLP_glBeginTransformFeedback, glBeginTransformFeedback, __VA_ARGS__)
+#define glEndTransformFeedback() gl_layer_call(GLP_glEndTransformFeedback, glEndTransformFeedback)
+#define glBindBufferRange(...) gl_layer_call(GLP_glBindBufferRange, glBindBufferRange, __VA_ARGS__)
+#define glBindBufferBase(...) gl_layer_call(GLP_glBindBufferBase, glBindBufferBase, __VA_ARGS__)
+#define glTransformFeedbackVaryings(...) gl_layer_call(GLP_glTransformFeedbackVaryings, glTransformFeedbackVaryings, __VA_ARGS__)
+#define glGetTransformFeedbackVarying(...) gl_layer_call(GLP_glGetTransformFeedbackVarying, glGetTransformFeedbackVarying, __VA_ARGS__)
+#define glClampColor(...) gl_layer_call(GLP_glClampColor, glClampColor, __VA_ARGS__)
+#define glBeginConditionalRender(...) gl_layer_call(GLP_glBeginConditionalRender, glBeginConditionalRender, __VA_ARGS__)
+#define glEndConditionalRender() gl_layer_call(GLP_glEndConditionalRender, glEndConditionalRender)
+#define glVertexAttribIPointer(...) gl_layer_call(GLP_glVertexAttribIPointer, glVertexAttribIPointer, __VA_ARGS__)
+#define glGetVertexAttribIiv(...) gl_layer_call(GLP_glGetVertexAttribIiv, glGetVertexAttribIiv, __VA_ARGS__)
+#define glGetVertexAttribIuiv(...) gl_layer_call(GLP_glGetVertexAttribIuiv, glGetVertexAttribIuiv, __VA_ARGS__)
+#define glVertexAttribI1i(...) gl_layer_call(GLP_glVertexAttribI1i, glVertexAttribI1i, __VA_ARGS__)
+#define glVertexAttribI2i(...) gl_layer_call(GLP_glVertexAttribI2i, glVertexAttribI2i, __VA_ARGS__)
+#define glVertexAttribI3i(...) gl_layer_call(GLP_glVertexAttribI3i, glVertexAttribI3i, __VA_ARGS__)
+#define glVertexAttribI4i(...) gl_layer_call(GLP_glVertexAttribI4i, glVertexAttribI4i, __VA_ARGS__)
+#define glVertexAttribI1ui(...) gl_layer_call(GLP_glVertexAttribI1ui, glVertexAttribI1ui, __VA_ARGS__)
+#define glVertexAttribI2ui(...) gl_layer_call(GLP_glVertexAttribI2ui, glVertexAttribI2ui, __VA_ARGS__)
+#define glVertexAttribI3ui(...) gl_layer_call(GLP_glVertexAttribI3ui, glVertexAttribI3ui, __VA_ARGS__)
+#define glVertexAttribI4ui(...) gl_layer_call(GLP_glVertexAttribI4ui, glVertexAttribI4ui, __VA_ARGS__)
+#define glVertexAttribI1iv(...) gl_layer_call(GLP_glVertexAttribI1iv, glVertexAttribI1iv, __VA_ARGS__)
+#define glVertexAttribI2iv(...) gl_layer_call(GLP_glVertexAttribI2iv, glVertexAttribI2iv, __VA_ARGS__)
+#define glVertexAttribI3iv(...) gl_layer_call(GLP_glVertexAttribI3iv, glVertexAttribI3iv, __VA_ARGS__)
+#define glVertexAttribI4iv(...) gl_layer_call(GLP_glVertexAttribI4iv, glVertexAttribI4iv, __VA_ARGS__)
+#define glVertexAttribI1uiv(...) gl_layer_call(GLP_glVertexAttribI1uiv, glVertexAttribI1uiv, __VA_ARGS__)
+#define glVertexAttribI2uiv(...) gl_layer_call(GLP_glVertexAttribI2uiv, glVertexAttribI2uiv, __VA_ARGS__)
+#define glVertexAttribI3uiv(...) gl_layer_call(GLP_glVertexAttribI3uiv, glVertexAttribI3uiv, __VA_ARGS__)
+#define glVertexAttribI4uiv(...) gl_layer_call(GLP_glVertexAttribI4uiv, glVertexAttribI4uiv, __VA_ARGS__)
+#define glVertexAttribI4bv(...) gl_layer_call(GLP_glVertexAttribI4bv, glVertexAttribI4bv, __VA_ARGS__)
+#define glVertexAttribI4sv(...) gl_layer_call(GLP_glVertexAttribI4sv, glVertexAttribI4sv, __VA_ARGS__)
+#define glVertexAttribI4ubv(...) gl_layer_call(GLP_glVertexAttribI4ubv, glVertexAttribI4ubv, __VA_ARGS__)
+#define glVertexAttribI4usv(...) gl_layer_call(GLP_glVertexAttribI4usv, glVertexAttribI4usv, __VA_ARGS__)
+#define glGetUniformuiv(...) gl_layer_call(GLP_glGetUniformuiv, glGetUniformuiv, __VA_ARGS__)
+#define glBindFragDataLocation(...) gl_layer_call(GLP_glBindFragDataLocation, glBindFragDataLocation, __VA_ARGS__)
+#define glGetFragDataLocation(...) gl_layer_call(GLP_glGetFragDataLocation, glGetFragDataLocation, __VA_ARGS__)
+#define glUniform1ui(...) gl_layer_call(GLP_glUniform1ui, glUniform1ui, __VA_ARGS__)
+#define glUniform2ui(...) gl_layer_call(GLP_glUniform2ui, glUniform2ui, __VA_ARGS__)
+#define glUniform3ui(...) gl_layer_call(GLP_glUniform3ui, glUniform3ui, __VA_ARGS__)
+#define glUniform4ui(...) gl_layer_call(GLP_glUniform4ui, glUniform4ui, __VA_ARGS__)
+#define glUniform1uiv(...) gl_layer_call(GLP_glUniform1uiv, glUniform1uiv, __VA_ARGS__)
+#define glUniform2uiv(...) gl_layer_call(GLP_glUniform2uiv, glUniform2uiv, __VA_ARGS__)
+#define glUniform3uiv(...) gl_layer_call(GLP_glUniform3uiv, glUniform3uiv, __VA_ARGS__)
+#define glUniform4uiv(...) gl_layer_call(GLP_glUniform4uiv, glUniform4uiv, __VA_ARGS__)
+#define glTexParameterIiv(...) gl_layer_call(GLP_glTexParameterIiv, glTexParameterIiv, __VA_ARGS__)
+#define glTexParameterIuiv(...) gl_layer_call(GLP_glTexParameterIuiv, glTexParameterIuiv, __VA_ARGS__)
+#define glGetTexParameterIiv(...) gl_layer_call(GLP_glGetTexParameterIiv, glGetTexParameterIiv, __VA_ARGS__)
+#define glGetTexParameterIuiv(...) gl_layer_call(GLP_glGetTexParameterIuiv, glGetTexParameterIuiv, __VA_ARGS__)
+#define glClearBufferiv(...) gl_layer_call(GLP_glClearBufferiv, glClearBufferiv, __VA_ARGS__)
+#define glClearBufferuiv(...) gl_layer_call(GLP_glClearBufferuiv, glClearBufferuiv, __VA_ARGS__)
+#define glClearBufferfv(...) gl_layer_call(GLP_glClearBufferfv, glClearBufferfv, __VA_ARGS__)
+#define glClearBufferfi(...) gl_layer_call(GLP_glClearBufferfi, glClearBufferfi, __VA_ARGS__)
+#define glGetStringi(...) gl_layer_call(GLP_glGetStringi, glGetStringi, __VA_ARGS__)
+#define glIsRenderbuffer(...) gl_layer_call(GLP_glIsRenderbuffer, glIsRenderbuffer, __VA_ARGS__)
+#define glBindRenderbuffer(...) gl_layer_call(GLP_glBindRenderbuffer, glBindRenderbuffer, __VA_ARGS__)
+#define glDeleteRenderbuffers(...) gl_layer_call(GLP_glDeleteRenderbuffers, glDeleteRenderbuffers, __VA_ARGS__)
+#define glGenRenderbuffers(...) gl_layer_call(GLP_glGenRenderbuffers, glGenRenderbuffers, __VA_ARGS__)
+#define glRenderbufferStorage(...) gl_layer_call(GLP_glRenderbufferStorage, glRenderbufferStorage, __VA_ARGS__)
+#define glGetRenderbufferParameteriv(...) gl_layer_call(GLP_glGetRenderbufferParameteriv, glGetRenderbufferParameteriv, __VA_ARGS__)
+#define glIsFramebuffer(...) gl_layer_call(GLP_glIsFramebuffer, glIsFramebuffer, __VA_ARGS__)
+#define glBindFramebuffer(...) gl_layer_call(GLP_glBindFramebuffer, glBindFramebuffer, __VA_ARGS__)
+#define glDeleteFramebuffers(...) gl_layer_call(GLP_glDeleteFramebuffers, glDeleteFramebuffers, __VA_ARGS__)
+#define glGenFramebuffers(...) gl_layer_call(GLP_glGenFramebuffers, glGenFramebuffers, __VA_ARGS__)
+#define glCheckFramebufferStatus(...) gl_layer_call(GLP_glCheckFramebufferStatus, glCheckFramebufferStatus, __VA_ARGS__)
+#define glFramebufferTexture1D(...) gl_layer_call(GLP_glFramebufferTexture1D, glFramebufferTexture1D, __VA_ARGS__)
+#define glFramebufferTexture2D(...) gl_layer_call(GLP_glFramebufferTexture2D, glFramebufferTexture2D, __VA_ARGS__)
+#define glFramebufferTexture3D(...) gl_layer_call(GLP_glFramebufferTexture3D, glFramebufferTexture3D, __VA_ARGS__)
+#define glFramebufferRenderbuffer(...) gl_layer_call(GLP_glFramebufferRenderbuffer, glFramebufferRenderbuffer, __VA_ARGS__)
+#define glGetFramebufferAttachmentParameteriv(...) gl_layer_call(GLP_glGetFramebufferAttachmentParameteriv, glGetFramebufferAttachmentParameteriv, __VA_ARGS__)
+#define glGenerateMipmap(...) gl_layer_call(GLP_glGenerateMipmap, glGenerateMipmap, __VA_ARGS__)
+#define glBlitFramebuffer(...) gl_layer_call(GLP_glBlitFramebuffer, glBlitFramebuffer, __VA_ARGS__)
+#define glRenderbufferStorageMultisample(...) gl_layer_call(GLP_glRenderbufferStorageMultisample, glRenderbufferStorageMultisample, __VA_ARGS__)
+#define glFramebufferTextureLayer(...) gl_layer_call(GLP_glFramebufferTextureLayer, glFramebufferTextureLayer, __VA_ARGS__)
+#define glMapBufferRange(...) gl_layer_call(GLP_glMapBufferRange, glMapBufferRange, __VA_ARGS__)
+#define glFlushMappedBufferRange(...) gl_layer_call(GLP_glFlushMappedBufferRange, glFlushMappedBufferRange, __VA_ARGS__)
+#define glBindVertexArray(...) gl_layer_call(GLP_glBindVertexArray, glBindVertexArray, __VA_ARGS__)
+#define glDeleteVertexArrays(...) gl_layer_call(GLP_glDeleteVertexArrays, glDeleteVertexArrays, __VA_ARGS__)
+#define glGenVertexArrays(...) gl_layer_call(GLP_glGenVertexArrays, glGenVertexArrays, __VA_ARGS__)
+#define glIsVertexArray(...) gl_layer_call(GLP_glIsVertexArray, glIsVertexArray, __VA_ARGS__)
+#define glDrawArraysInstanced(...) gl_layer_call(GLP_glDrawArraysInstanced, glDrawArraysInstanced, __VA_ARGS__)
+#define glDrawElementsInstanced(...) gl_layer_call(GLP_glDrawElementsInstanced, glDrawElementsInstanced, __VA_ARGS__)
+#define glTexBuffer(...) gl_layer_call(GLP_glTexBuffer, glTexBuffer, __VA_ARGS__)
+#define glPrimitiveRestartIndex(...) gl_layer_call(GLP_glPrimitiveRestartIndex, glPrimitiveRestartIndex, __VA_ARGS__)
+#define glCopyBufferSubData(...) gl_layer_call(GLP_glCopyBufferSubData, glCopyBufferSubData, __VA_ARGS__)
+#define glGetUniformIndices(...) gl_layer_call(GLP_glGetUniformIndices, glGetUniformIndices, __VA_ARGS__)
+#define glGetActiveUniformsiv(...) gl_layer_call(GLP_glGetActiveUniformsiv, glGetActiveUniformsiv, __VA_ARGS__)
+#define glGetActiveUniformName(...) gl_layer_call(GLP_glGetActiveUniformName, glGetActiveUniformName, __VA_ARGS__)
+#define glGetUniformBlockIndex(...) gl_layer_call(GLP_glGetUniformBlockIndex, glGetUniformBlockIndex, __VA_ARGS__)
+#define glGetActiveUniformBlockiv(...) gl_layer_call(GLP_glGetActiveUniformBlockiv, glGetActiveUniformBlockiv, __VA_ARGS__)
+#define glGetActiveUniformBlockName(...) gl_layer_call(GLP_glGetActiveUniformBlockName, glGetActiveUniformBlockName, __VA_ARGS__)
+#define glUniformBlockBinding(...) gl_layer_call(GLP_glUniformBlockBinding, glUniformBlockBinding, __VA_ARGS__)
+#define glDrawElementsBaseVertex(...) gl_layer_call(GLP_glDrawElementsBaseVertex, glDrawElementsBaseVertex, __VA_ARGS__)
+#define glDrawRangeElementsBaseVertex(...) gl_layer_call(GLP_glDrawRangeElementsBaseVertex, glDrawRangeElementsBaseVertex, __VA_ARGS__)
+#define glDrawElementsInstancedBaseVertex(...) gl_layer_call(GLP_glDrawElementsInstancedBaseVertex, glDrawElementsInstancedBaseVertex, __VA_ARGS__)
+#define glMultiDrawElementsBaseVertex(...) gl_layer_call(GLP_glMultiDrawElementsBaseVertex, glMultiDrawElementsBaseVertex, __VA_ARGS__)
+#define glProvokingVertex(...) gl_layer_call(GLP_glProvokingVertex, glProvokingVertex, __VA_ARGS__)
+#define glFenceSync(...) gl_layer_call(GLP_glFenceSync, glFenceSync, __VA_ARGS__)
+#define glIsSync(...) gl_layer_call(GLP_glIsSync, glIsSync, __VA_ARGS__)
+#define glDeleteSync(...) gl_layer_call(GLP_glDeleteSync, glDeleteSync, __VA_ARGS__)
+#define glClientWaitSync(...) gl_layer_call(GLP_glClientWaitSync, glClientWaitSync, __VA_ARGS__)
+#define glWaitSync(...) gl_layer_call(GLP_glWaitSync, glWaitSync, __VA_ARGS__)
+#define glGetInteger64v(...) gl_layer_call(GLP_glGetInteger64v, glGetInteger64v, __VA_ARGS__)
+#define glGetSynciv(...) gl_layer_call(GLP_glGetSynciv, glGetSynciv, __VA_ARGS__)
+#define glGetInteger64i_v(...) gl_layer_call(GLP_glGetInteger64i_v, glGetInteger64i_v, __VA_ARGS__)
+#define glGetBufferParameteri64v(...) gl_layer_call(GLP_glGetBufferParameteri64v, glGetBufferParameteri64v, __VA_ARGS__)
+#define glFramebufferTexture(...) gl_layer_call(GLP_glFramebufferTexture, glFramebufferTexture, __VA_ARGS__)
+#define glTexImage2DMultisample(...) gl_layer_call(GLP_glTexImage2DMultisample, glTexImage2DMultisample, __VA_ARGS__)
+#define glTexImage3DMultisample(...) gl_layer_call(GLP_glTexImage3DMultisample, glTexImage3DMultisample, __VA_ARGS__)
+#define glGetMultisamplefv(...) gl_layer_call(GLP_glGetMultisamplefv, glGetMultisamplefv, __VA_ARGS__)
+#define glSampleMaski(...) gl_layer_call(GLP_glSampleMaski, glSampleMaski, __VA_ARGS__)
+#define glBindFragDataLocationIndexed(...) gl_layer_call(GLP_glBindFragDataLocationIndexed, glBindFragDataLocationIndexed, __VA_ARGS__)
+#define glGetFragDataIndex(...) gl_layer_call(GLP_glGetFragDataIndex, glGetFragDataIndex, __VA_ARGS__)
+#define glGenSamplers(...) gl_layer_call(GLP_glGenSamplers, glGenSamplers, __VA_ARGS__)
+#define glDeleteSamplers(...) gl_layer_call(GLP_glDeleteSamplers, glDeleteSamplers, __VA_ARGS__)
+#define glIsSampler(...) gl_layer_call(GLP_glIsSampler, glIsSampler, __VA_ARGS__)
+#define glBindSampler(...) gl_layer_call(GLP_glBindSampler, glBindSampler, __VA_ARGS__)
+#define glSamplerParameteri(...) gl_layer_call(GLP_glSamplerParameteri, glSamplerParameteri, __VA_ARGS__)
+#define glSamplerParameteriv(...) gl_layer_call(GLP_glSamplerParameteriv, glSamplerParameteriv, __VA_ARGS__)
+#define glSamplerParameterf(...) gl_layer_call(GLP_glSamplerParameterf, glSamplerParameterf, __VA_ARGS__)
+#define glSamplerParameterfv(...) gl_layer_call(GLP_glSamplerParameterfv, glSamplerParameterfv, __VA_ARGS__)
+#define glSamplerParameterIiv(...) gl_layer_call(GLP_glSamplerParameterIiv, glSamplerParameterIiv, __VA_ARGS__)
+#define glSamplerParameterIuiv(...) gl_layer_call(GLP_glSamplerParameterIuiv, glSamplerParameterIuiv, __VA_ARGS__)
+#define glGetSamplerParameteriv(...) gl_layer_call(GLP_glGetSamplerParameteriv, glGetSamplerParameteriv, __VA_ARGS__)
+#define glGetSamplerParameterIiv(...) gl_layer_call(GLP_glGetSamplerParameterIiv, glGetSamplerParameterIiv, __VA_ARGS__)
+#define glGetSamplerParameterfv(...) gl_layer_call(GLP_glGetSamplerParameterfv, glGetSamplerParameterfv, __VA_ARGS__)
+#define glGetSamplerParameterIuiv(...) gl_layer_call(GLP_glGetSamplerParameterIuiv, glGetSamplerParameterIuiv, __VA_ARGS__)
+#define glQueryCounter(...) gl_layer_call(GLP_glQueryCounter, glQueryCounter, __VA_ARGS__)
+#define glGetQueryObjecti64v(...) gl_layer_call(GLP_glGetQueryObjecti64v, glGetQueryObjecti64v, __VA_ARGS__)
+#define glGetQueryObjectui64v(...) gl_layer_call(GLP_glGetQueryObjectui64v, glGetQueryObjectui64v, __VA_ARGS__)
+#define glVertexAttribDivisor(...) gl_layer_call(GLP_glVertexAttribDivisor, glVertexAttribDivisor, __VA_ARGS__)
+#define glVertexAttribP1ui(...) gl_layer_call(GLP_glVertexAttribP1ui, glVertexAttribP1ui, __VA_ARGS__)
+#define glVertexAttribP1uiv(...) gl_layer_call(GLP_glVertexAttribP1uiv, glVertexAttribP1uiv, __VA_ARGS__)
+#define glVertexAttribP2ui(...) gl_layer_call(GLP_glVertexAttribP2ui, glVertexAttribP2ui, __VA_ARGS__)
+#define glVertexAttribP2uiv(...) gl_layer_call(GLP_glVertexAttribP2uiv, glVertexAttribP2uiv, __VA_ARGS__)
+#define glVertexAttribP3ui(...) gl_layer_call(GLP_glVertexAttribP3ui, glVertexAttribP3ui, __VA_ARGS__)
+#define glVertexAttribP3uiv(...) gl_layer_call(GLP_glVertexAttribP3uiv, glVertexAttribP3uiv, __VA_ARGS__)
+#define glVertexAttribP4ui(...) gl_layer_call(GLP_glVertexAttribP4ui, glVertexAttribP4ui, __VA_ARGS__)
+#define glVertexAttribP4uiv(...) gl_layer_call(GLP_glVertexAttribP4uiv, glVertexAttribP4uiv, __VA_ARGS__)
@@ -0,0 +1,109 @@
+#include "GLReadback.hpp"
+
+#include "GLStateCache.hpp"
+#include "gl_errors.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+GLReadback::GLReadback(uint32_t count) : slots(count) {
+	for (Slot &slot : slots) {
+		glGenBuffers(1, &slot.buffer);
+	}
+}
+
+GLReadback::~GLReadback() {
+	for (Slot &slot : slots) {
+		if (slot.state == Mapped) {
+			gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		if (slot.fence) glDeleteSync(slot.fence);
+	}
+	gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+	for (Slot &slot : slots) {
+		glDeleteBuffers(1, &slot.buffer);
+	}
+}
+
+bool GLReadback::read(glm::uvec2 const &size, uint64_t tag) {
+	auto free = std::find_if(slots.begin(), slots.end(), [](Slot const &slot) { return slot.state == Free; });
+	if (free == slots.end()) return false;
+	Slot &slot = *free;
+
+	slot.state = Reading;
+	slot.sequence = next_sequence++;
+	slot.frame = Frame();
+	slot.frame.slot = uint32_t(free - slots.begin());
+	slot.frame.tag = tag;
+	slot.frame.size = size;
+	slot.frame.read_time = std::chrono::high_resolution_clock::now();
+	slot.released = false;
+
+	gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	GLsizeiptr bytes = GLsizeiptr(size.x) * size.y * 4;
+	if (bytes > slot.capacity) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+		slot.capacity = bytes;
+	}
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	//(with a pack buffer bound, the last argument is an offset into it, and this returns without waiting)
+	glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	//(everything else reads pixels into client memory, so leave no pack buffer bound)
+	gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	GL_ERRORS();
+	return true;
+}
+
+void GLReadback::poll(std::vector< Frame > *finished, bool wait) {
+	for (Slot &slot : slots) {
+		if (slot.state == Mapped && slot.released) {
+			gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			slot.state = Free;
+		}
+	}
+
+	//reads finish in the order they were started:
+	std::vector< Slot * > reading;
+	for (Slot &slot : slots) {
+		if (slot.state == Reading) reading.emplace_back(&slot);
+	}
+	std::sort(reading.begin(), reading.end(), [](Slot const *a, Slot const *b) { return a->sequence < b->sequence; });
+
+	for (Slot *slot : reading) {
+		slot->frame.polls += 1;
+		GLenum status = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GLuint64(1000000000) : 0);
+		if (status == GL_TIMEOUT_EXPIRED && !wait) break;
+		glDeleteSync(slot->fence);
+		slot->fence = 0;
+
+		gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+		GLsizeiptr bytes = GLsizeiptr(slot->frame.size.x) * slot->frame.size.y * 4;
+		slot->frame.pixels = reinterpret_cast< glm::u8vec4 const * >(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT));
+		if (!slot->frame.pixels) {
+			std::cerr << "WARNING: failed to map a pixel pack buffer; dropping a frame read back." << std::endl;
+			slot->state = Free;
+			continue;
+		}
+		slot->state = Mapped;
+		finished->emplace_back(slot->frame);
+	}
+	gl_state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+void GLReadback::release(uint32_t slot) {
+	slots.at(slot).released = true;
+}
+
+uint32_t GLReadback::in_flight() const {
+	return uint32_t(std::count_if(slots.begin(), slots.end(), [](Slot const &slot) { return slot.state == Reading; }));
+}
+
+uint32_t GLReadback::mapped() const {
+	return uint32_t(std::count_if(slots.begin(), slots.end(), [](Slot const &slot) { return slot.state == Mapped; }));
+}
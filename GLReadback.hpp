@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+ * GLReadback reads frames back from GL without stalling the render thread:
+ *  each read goes into a pixel buffer object, and is only mapped once a fence
+ *  says the GPU is done with it (usually a frame or so later).
+ *
+ * Mapped pixels may be handed to other threads; they stay valid until
+ *  release() is called (from any thread), after which the next poll() (on
+ *  the GL thread) unmaps the buffer so it can be read into again.
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+struct GLReadback {
+	//at most 'slots' reads can be in flight (or mapped) at once:
+	GLReadback(uint32_t slots);
+	//(unmaps everything, whether released or not, so make sure nothing is still reading mapped pixels)
+	~GLReadback();
+	GLReadback(GLReadback const &) = delete;
+	GLReadback &operator=(GLReadback const &) = delete;
+
+	struct Frame {
+		uint32_t slot = 0; //(pass to release())
+		uint64_t tag = 0; //as passed to read()
+		glm::uvec2 size = glm::uvec2(0);
+		glm::u8vec4 const *pixels = nullptr; //RGBA8, lower-left origin
+		std::chrono::high_resolution_clock::time_point read_time; //when read() was called
+		uint32_t polls = 0; //calls to poll() it took for the read to finish
+	};
+
+	//start reading 'size' pixels from the lower left of the current read framebuffer/buffer:
+	// returns false (and reads nothing) if all slots are busy.
+	bool read(glm::uvec2 const &size, uint64_t tag = 0);
+
+	//unmap released slots, and map any reads that have finished (oldest first) into 'finished':
+	// 'wait' blocks until every read in flight has finished.
+	void poll(std::vector< Frame > *finished, bool wait = false);
+
+	//done with a frame's pixels (may be called from any thread):
+	void release(uint32_t slot);
+
+	uint32_t in_flight() const; //reads not yet mapped
+	uint32_t mapped() const; //frames handed out by poll and not yet unmapped
+
+private:
+	enum State { Free, Reading, Mapped };
+	struct Slot {
+		State state = Free;
+		GLuint buffer = 0;
+		GLsizeiptr capacity = 0;
+		GLsync fence = 0;
+		uint64_t sequence = 0; //(order reads were started in)
+		Frame frame;
+		std::atomic< bool > released{false};
+	};
+	std::vector< Slot > slots;
+	uint64_t next_sequence = 0;
+};
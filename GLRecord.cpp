@@ -0,0 +1,184 @@
+#include "GLRecord.hpp"
+
+#include "GL.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#ifdef GL_RECORD_LAYER
+
+bool gl_record_active = false;
+
+//state of the recording in progress:
+static struct {
+	std::string filename;
+	std::ofstream out;
+	uint32_t frame_limit = 0;
+	uint32_t frames = 0;
+	uint64_t calls = 0;
+	uint64_t bytes = 0;
+	std::vector< uint64_t > buffer; //current frame (written out at gl_record_frame)
+	std::vector< bool > warned; //per entry point, for one-time warnings
+} record;
+
+static void put_bytes(void const *data, uint64_t size) {
+	size_t at = record.buffer.size();
+	record.buffer.resize(at + (size + 7) / 8, 0);
+	std::memcpy(record.buffer.data() + at, data, size);
+}
+
+static void flush() {
+	record.out.write(reinterpret_cast< char const * >(record.buffer.data()), record.buffer.size() * sizeof(uint64_t));
+	record.bytes += record.buffer.size() * sizeof(uint64_t);
+	record.buffer.clear();
+}
+
+static void warn_once(uint32_t index, std::string const &what) {
+	if (record.warned[index]) return;
+	record.warned[index] = true;
+	std::cerr << "WARNING: recording " << gl_layer_names[index] << ": " << what << std::endl;
+}
+
+void gl_record_call(uint32_t index, uint64_t const *values, uint32_t count, uint64_t returned) {
+	struct Payload {
+		uint32_t param;
+		void const *data;
+		uint64_t size;
+	};
+	Payload payloads[16];
+	uint32_t payload_count = 0;
+
+	std::string source; //(glShaderSource strings, concatenated)
+
+	char const *signature = gl_record_signatures[index];
+	if (index == GLP_glShaderSource) {
+		GLsizei strings = GLsizei(values[1]);
+		GLchar const *const *string = reinterpret_cast< GLchar const *const * >(uintptr_t(values[2]));
+		GLint const *length = reinterpret_cast< GLint const * >(uintptr_t(values[3]));
+		for (GLsizei s = 0; s < strings; ++s) {
+			if (length && length[s] >= 0) source.append(string[s], length[s]);
+			else source.append(string[s]);
+		}
+		payloads[payload_count++] = Payload{ 2, source.c_str(), source.size() + 1 };
+	} else {
+		for (uint32_t p = 0; p < count; ++p) {
+			if (signature[p] == 'v' || values[p] < GLRecordMinPointer) continue;
+			uint64_t size = gl_record_payload_size(index, p, values);
+			if (size == GLRecordNoPayload) {
+				if (signature[p] == 'i') warn_once(index, "size of data for parameter " + std::to_string(p) + " isn't known; replay will read zeros.");
+				continue;
+			}
+			payloads[payload_count++] = Payload{ p, reinterpret_cast< void const * >(uintptr_t(values[p])), size };
+		}
+	}
+	if (index == GLP_glMapBuffer || index == GLP_glMapBufferRange) {
+		warn_once(index, "writes to mapped buffers aren't recorded.");
+	}
+
+	record.buffer.emplace_back(uint64_t(index) | (uint64_t(count) << 16) | (uint64_t(payload_count) << 24));
+	record.buffer.insert(record.buffer.end(), values, values + count);
+	record.buffer.emplace_back(returned);
+	for (uint32_t i = 0; i < payload_count; ++i) {
+		record.buffer.emplace_back(uint64_t(payloads[i].param) | (payloads[i].size << 8));
+		put_bytes(payloads[i].data, payloads[i].size);
+	}
+	record.calls += 1;
+}
+
+uint64_t gl_record_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type) {
+	uint32_t components = 4;
+	switch (format) {
+		case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+		case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+			components = 1; break;
+		case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+			components = 2; break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+			components = 3; break;
+		default:
+			components = 4; break;
+	}
+	uint32_t pixel = 0;
+	switch (type) {
+		case GL_UNSIGNED_BYTE: case GL_BYTE:
+			pixel = components; break;
+		case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+			pixel = 2 * components; break;
+		case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+			pixel = 4 * components; break;
+		case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+			pixel = 1; break;
+		case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+		case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+		case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+			pixel = 2; break;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			pixel = 8; break;
+		default: //(remaining packed types are 32 bits per pixel)
+			pixel = 4; break;
+	}
+	uint64_t row = (uint64_t(width) * pixel + 3) / 4 * 4;
+	return row * uint64_t(height) * uint64_t(depth);
+}
+
+void gl_record_start(std::string const &filename, uint32_t frames) {
+	gl_record_stop();
+
+	record.out.open(filename, std::ios::binary);
+	if (!record.out) {
+		std::cerr << "WARNING: failed to open '" << filename << "' to record GL calls." << std::endl;
+		return;
+	}
+	record.filename = filename;
+	record.frame_limit = frames;
+	record.frames = 0;
+	record.calls = 0;
+	record.bytes = 0;
+	record.warned.assign(GLP_COUNT, false);
+
+	record.buffer.emplace_back(GLRecordMagic);
+	record.buffer.emplace_back(GLP_COUNT);
+
+	gl_record_active = true;
+}
+
+void gl_record_frame() {
+	if (!gl_record_active) return;
+
+	record.buffer.emplace_back(GLRecordFrameMarker);
+	flush();
+	record.frames += 1;
+
+	if (record.frames >= record.frame_limit) gl_record_stop();
+}
+
+void gl_record_stop() {
+	if (!gl_record_active) return;
+	gl_record_active = false;
+
+	flush();
+	record.out.close();
+	std::cout << "Recorded " << record.calls << " GL calls over " << record.frames << " frames ("
+	          << (record.bytes / 1024) << " kB) to '" << record.filename << "'." << std::endl;
+}
+
+bool gl_recording() {
+	return gl_record_active;
+}
+
+#else //GL_RECORD_LAYER
+
+void gl_record_start(std::string const &filename, uint32_t frames) {
+	std::cerr << "NOTE: GL.hpp was generated without 'make-GL.py --record'; not recording to '" << filename << "'." << std::endl;
+}
+void gl_record_frame() {
+}
+void gl_record_stop() {
+}
+bool gl_recording() {
+	return false;
+}
+
+#endif //GL_RECORD_LAYER
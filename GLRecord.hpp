@@ -0,0 +1,37 @@
+#pragma once
+
+/*
+ * Records the GL command stream (every call, plus the buffer/texture/uniform
+ *  data it reads from client memory) to a file, so it can be re-issued by
+ *  the standalone replayer (gl_replay_main.cpp) for driver benchmarking.
+ *
+ * Requires GL.hpp generated with 'make-GL.py --record' (defines GL_RECORD_LAYER).
+ *
+ * File format (all fields are little-endian uint64_t, data is padded to 8 bytes):
+ *   GLRecordMagic, GLP_COUNT
+ *   per call:  index | value count << 16 | payload count << 24
+ *              values[value count], returned value
+ *              per payload:  parameter | byte count << 8, bytes
+ *   per frame: GLRecordFrameMarker
+ *
+ * Limitations: writes through glMapBuffer* pointers aren't seen, and pixel
+ *  uploads are sized assuming the default unpack state (4-byte row alignment).
+ *  Input pointers that can't be sized are reported once and replayed as zeros.
+ */
+
+#include <cstdint>
+#include <string>
+
+//start recording to 'filename'; recording stops itself after 'frames' calls to gl_record_frame():
+void gl_record_start(std::string const &filename, uint32_t frames);
+//mark the end of a frame (call after swapping):
+void gl_record_frame();
+//stop recording early (does nothing if not recording):
+void gl_record_stop();
+//is a recording in progress? (writes through mapped buffers aren't recorded, so uploads should come from client memory while one is)
+bool gl_recording();
+
+constexpr uint64_t GLRecordMagic = 0x3130304345524c47ULL; //"GLREC001"
+constexpr uint64_t GLRecordFrameMarker = 0xffff;
+//pointer arguments smaller than this are offsets into bound buffers (or null), not client memory:
+constexpr uint64_t GLRecordMinPointer = 0x10000;
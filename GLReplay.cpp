@@ -0,0 +1,157 @@
+#include "GLReplay.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+//scratch space for each output pointer argument (enough for a 4k RGBA float readback):
+static constexpr size_t OutputSize = size_t(64) << 20;
+//zeros handed out for input data that wasn't recorded:
+static constexpr size_t ZerosSize = size_t(16) << 20;
+
+GLReplay::GLReplay(std::string const &filename) {
+	std::ifstream in(filename, std::ios::binary | std::ios::ate);
+	if (!in) {
+		throw std::runtime_error("Failed to open GL recording '" + filename + "'.");
+	}
+	std::streamoff size = in.tellg();
+	in.seekg(0);
+	data.resize(size_t(size) / sizeof(uint64_t));
+	if (!in.read(reinterpret_cast< char * >(data.data()), data.size() * sizeof(uint64_t))) {
+		throw std::runtime_error("Failed to read GL recording '" + filename + "'.");
+	}
+
+	if (data.size() < 2 || data[0] != GLRecordMagic) {
+		throw std::runtime_error("'" + filename + "' isn't a GL recording.");
+	}
+	if (data[1] != GLP_COUNT) {
+		throw std::runtime_error("'" + filename + "' was recorded with a different GL.hpp (" + std::to_string(data[1]) + " entry points, expecting " + std::to_string(uint32_t(GLP_COUNT)) + ").");
+	}
+
+	//split into calls and frames:
+	frames.emplace_back();
+	size_t at = 2;
+	auto truncated = [&filename]() {
+		return std::runtime_error("GL recording '" + filename + "' is truncated or corrupt.");
+	};
+	while (at < data.size()) {
+		uint64_t header = data[at++];
+		if (header == GLRecordFrameMarker) {
+			frames.emplace_back();
+			continue;
+		}
+		GLReplayCall call;
+		call.index = uint32_t(header & 0xffff);
+		call.count = uint32_t((header >> 16) & 0xff);
+		uint32_t payload_count = uint32_t((header >> 24) & 0xff);
+		if (call.index >= GLP_COUNT || call.count > GLReplayCall::MaxParams) throw truncated();
+		if (at + call.count + 1 > data.size()) throw truncated();
+		call.values = data.data() + at;
+		at += call.count;
+		call.returned = data[at++];
+		for (uint32_t p = 0; p < GLReplayCall::MaxParams; ++p) {
+			call.payloads[p] = nullptr;
+		}
+		for (uint32_t i = 0; i < payload_count; ++i) {
+			if (at >= data.size()) throw truncated();
+			uint32_t param = uint32_t(data[at] & 0xff);
+			uint64_t bytes = data[at] >> 8;
+			at += 1;
+			if (param >= call.count || (bytes + 7) / 8 > data.size() - at) throw truncated();
+			call.payloads[param] = data.data() + at;
+			at += size_t((bytes + 7) / 8);
+		}
+		frames.back().emplace_back(call);
+		calls += 1;
+	}
+	//(recordings end with a frame marker, which leaves an empty frame at the end)
+	if (frames.back().empty()) frames.pop_back();
+
+	warned.assign(GLP_COUNT, false);
+}
+
+void GLReplay::replay_frame(size_t frame) {
+	for (GLReplayCall const &c : frames.at(frame)) {
+		call = &c;
+		gl_replay_dispatch(*this);
+	}
+	call = nullptr;
+}
+
+float GLReplay::float_value(uint32_t i) const {
+	uint32_t bits = uint32_t(call->values[i]);
+	float ret;
+	std::memcpy(&ret, &bits, sizeof(ret));
+	return ret;
+}
+
+double GLReplay::double_value(uint32_t i) const {
+	double ret;
+	std::memcpy(&ret, &call->values[i], sizeof(ret));
+	return ret;
+}
+
+uint64_t GLReplay::translation_key(Kind kind, uint64_t program, uint64_t recorded) const {
+	if (kind == Uniform) return (program << 32) | uint32_t(recorded);
+	return recorded;
+}
+
+uint64_t GLReplay::name(Kind kind, uint32_t i) const {
+	uint64_t recorded = call->values[i];
+	if (kind == Framebuffer && recorded == 0) return default_framebuffer;
+	auto f = translation[kind].find(translation_key(kind, recorded_program, recorded));
+	if (f == translation[kind].end()) return recorded;
+	return f->second;
+}
+
+GLuint const *GLReplay::names(Kind kind, uint32_t i) {
+	GLuint const *recorded = reinterpret_cast< GLuint const * >(pointer(i));
+	GLsizei n = GLsizei(call->values[0]);
+	names_scratch.resize(n > 0 ? n : 0);
+	for (GLsizei j = 0; j < n; ++j) {
+		auto f = translation[kind].find(recorded[j]);
+		names_scratch[j] = (f == translation[kind].end() ? recorded[j] : GLuint(f->second));
+	}
+	return names_scratch.data();
+}
+
+void const *GLReplay::pointer(uint32_t i) {
+	if (call->payloads[i]) return call->payloads[i];
+	if (call->values[i] < GLRecordMinPointer) return reinterpret_cast< void const * >(uintptr_t(call->values[i]));
+	if (!warned[call->index]) {
+		warned[call->index] = true;
+		std::cerr << "WARNING: replaying " << gl_layer_names[call->index] << ": data for parameter " << i << " wasn't recorded; using zeros." << std::endl;
+	}
+	if (zeros.empty()) zeros.assign(ZerosSize, 0);
+	return zeros.data();
+}
+
+void *GLReplay::output(uint32_t i) {
+	if (!outputs[i]) outputs[i].reset(new uint8_t[OutputSize]);
+	return outputs[i].get();
+}
+
+GLchar const *GLReplay::shader_source(uint32_t i) const {
+	return reinterpret_cast< GLchar const * >(call->payloads[i]);
+}
+
+void GLReplay::returned(Kind kind, uint64_t replayed) {
+	//(glGetUniformLocation's first argument is the program the location belongs to)
+	uint64_t program = (kind == Uniform ? call->values[0] : 0);
+	translation[kind][translation_key(kind, program, call->returned)] = replayed;
+}
+
+void GLReplay::generated(Kind kind, uint32_t i) {
+	GLuint const *recorded = reinterpret_cast< GLuint const * >(call->payloads[i]);
+	GLuint const *replayed = reinterpret_cast< GLuint const * >(outputs[i].get());
+	if (!recorded) return;
+	GLsizei n = GLsizei(call->values[0]);
+	for (GLsizei j = 0; j < n; ++j) {
+		translation[kind][recorded[j]] = replayed[j];
+	}
+}
+
+void GLReplay::unknown_call() {
+	std::cerr << "WARNING: skipping unknown GL call " << call->index << "." << std::endl;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * GLReplay loads a GL command stream written by GLRecord (see GLRecord.hpp)
+ *  and re-issues it against the current context.
+ *
+ * Object names, uniform locations, and attribute locations handed out by the
+ *  driver during replay may differ from the ones seen while recording, so
+ *  they are translated as calls are issued.
+ *
+ */
+
+#include "GL.hpp"
+#include "GLRecord.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct GLReplayCall {
+	static constexpr uint32_t MaxParams = 16;
+
+	uint32_t index = 0; //GLP_* entry point
+	uint32_t count = 0; //number of values
+	uint64_t const *values = nullptr; //arguments, as recorded
+	uint64_t returned = 0; //return value, as recorded
+	void const *payloads[MaxParams]; //data read through pointer arguments (nullptr if not recorded)
+};
+
+struct GLReplay {
+	//throws std::runtime_error if 'filename' can't be read or isn't a recording made with this GL.hpp:
+	GLReplay(std::string const &filename);
+
+	std::vector< std::vector< GLReplayCall > > frames;
+	uint64_t calls = 0; //total over all frames
+
+	//issue every call in frames[frame]:
+	void replay_frame(size_t frame);
+
+	//what recorded uses of framebuffer 0 become (e.g. a HeadlessContext's framebuffer, since a surfaceless context has no default one):
+	GLuint default_framebuffer = 0;
+
+	//----- used by gl_replay_dispatch() -----
+
+	enum Kind : uint32_t { Buffer, Texture, VertexArray, Framebuffer, Renderbuffer, Program, Shader, Sampler, Query, Uniform, Attrib, Sync, KindCount };
+
+	GLReplayCall const *call = nullptr; //call being issued
+	uint64_t recorded_program = 0; //program in use (as recorded), since uniform locations are per-program
+
+	uint64_t value(uint32_t i) const { return call->values[i]; }
+	float float_value(uint32_t i) const;
+	double double_value(uint32_t i) const;
+	//argument 'i' translated from a recorded name of 'kind' to the replayed name (unknown names pass through):
+	uint64_t name(Kind kind, uint32_t i) const;
+	//an array of names of 'kind' read by argument 'i', translated:
+	GLuint const *names(Kind kind, uint32_t i);
+	//data read by argument 'i' (or the argument itself, if it was a buffer offset; or zeros, if it wasn't recorded):
+	void const *pointer(uint32_t i);
+	//somewhere for argument 'i' to write to:
+	void *output(uint32_t i);
+	//glShaderSource strings (recorded concatenated):
+	GLchar const *shader_source(uint32_t i) const;
+
+	//note the name of 'kind' the call returned during replay:
+	void returned(Kind kind, uint64_t replayed);
+	//note the names of 'kind' a glGen* call wrote to output(i):
+	void generated(Kind kind, uint32_t i);
+
+	void unknown_call();
+
+private:
+	std::vector< uint64_t > data; //the whole file
+	std::unordered_map< uint64_t, uint64_t > translation[KindCount];
+	std::unique_ptr< uint8_t[] > outputs[GLReplayCall::MaxParams];
+	std::vector< uint8_t > zeros;
+	std::vector< GLuint > names_scratch;
+	std::vector< bool > warned;
+
+	uint64_t translation_key(Kind kind, uint64_t program, uint64_t recorded) const;
+};
+
+//issue r.call (generated by 'make-GL.py --record' into GLReplayDispatch.cpp):
+void gl_replay_dispatch(GLReplay &r);
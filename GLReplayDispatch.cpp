@@ -0,0 +1,1054 @@
+//generated by make-GL.py --record; issues one recorded call (see GLReplay.hpp)
+
+#include "GLReplay.hpp"
+
+void gl_replay_dispatch(GLReplay &r) {
+	switch (r.call->index) {
+		case GLP_glCullFace: {
+			glCullFace(GLenum(r.value(0)));
+		} break;
+		case GLP_glFrontFace: {
+			glFrontFace(GLenum(r.value(0)));
+		} break;
+		case GLP_glHint: {
+			glHint(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glLineWidth: {
+			glLineWidth(r.float_value(0));
+		} break;
+		case GLP_glPointSize: {
+			glPointSize(r.float_value(0));
+		} break;
+		case GLP_glPolygonMode: {
+			glPolygonMode(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glScissor: {
+			glScissor(GLint(r.value(0)), GLint(r.value(1)), GLsizei(r.value(2)), GLsizei(r.value(3)));
+		} break;
+		case GLP_glTexParameterf: {
+			glTexParameterf(GLenum(r.value(0)), GLenum(r.value(1)), r.float_value(2));
+		} break;
+		case GLP_glTexParameterfv: {
+			glTexParameterfv(GLenum(r.value(0)), GLenum(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glTexParameteri: {
+			glTexParameteri(GLenum(r.value(0)), GLenum(r.value(1)), GLint(r.value(2)));
+		} break;
+		case GLP_glTexParameteriv: {
+			glTexParameteriv(GLenum(r.value(0)), GLenum(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glTexImage1D: {
+			glTexImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLsizei(r.value(3)), GLint(r.value(4)), GLenum(r.value(5)), GLenum(r.value(6)), (const void *)r.pointer(7));
+		} break;
+		case GLP_glTexImage2D: {
+			glTexImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLint(r.value(5)), GLenum(r.value(6)), GLenum(r.value(7)), (const void *)r.pointer(8));
+		} break;
+		case GLP_glDrawBuffer: {
+			glDrawBuffer(GLenum(r.value(0)));
+		} break;
+		case GLP_glClear: {
+			glClear(GLbitfield(r.value(0)));
+		} break;
+		case GLP_glClearColor: {
+			glClearColor(r.float_value(0), r.float_value(1), r.float_value(2), r.float_value(3));
+		} break;
+		case GLP_glClearStencil: {
+			glClearStencil(GLint(r.value(0)));
+		} break;
+		case GLP_glClearDepth: {
+			glClearDepth(r.double_value(0));
+		} break;
+		case GLP_glStencilMask: {
+			glStencilMask(GLuint(r.value(0)));
+		} break;
+		case GLP_glColorMask: {
+			glColorMask(GLboolean(r.value(0)), GLboolean(r.value(1)), GLboolean(r.value(2)), GLboolean(r.value(3)));
+		} break;
+		case GLP_glDepthMask: {
+			glDepthMask(GLboolean(r.value(0)));
+		} break;
+		case GLP_glDisable: {
+			glDisable(GLenum(r.value(0)));
+		} break;
+		case GLP_glEnable: {
+			glEnable(GLenum(r.value(0)));
+		} break;
+		case GLP_glFinish: {
+			glFinish();
+		} break;
+		case GLP_glFlush: {
+			glFlush();
+		} break;
+		case GLP_glBlendFunc: {
+			glBlendFunc(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glLogicOp: {
+			glLogicOp(GLenum(r.value(0)));
+		} break;
+		case GLP_glStencilFunc: {
+			glStencilFunc(GLenum(r.value(0)), GLint(r.value(1)), GLuint(r.value(2)));
+		} break;
+		case GLP_glStencilOp: {
+			glStencilOp(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)));
+		} break;
+		case GLP_glDepthFunc: {
+			glDepthFunc(GLenum(r.value(0)));
+		} break;
+		case GLP_glPixelStoref: {
+			glPixelStoref(GLenum(r.value(0)), r.float_value(1));
+		} break;
+		case GLP_glPixelStorei: {
+			glPixelStorei(GLenum(r.value(0)), GLint(r.value(1)));
+		} break;
+		case GLP_glReadBuffer: {
+			glReadBuffer(GLenum(r.value(0)));
+		} break;
+		case GLP_glReadPixels: {
+			glReadPixels(GLint(r.value(0)), GLint(r.value(1)), GLsizei(r.value(2)), GLsizei(r.value(3)), GLenum(r.value(4)), GLenum(r.value(5)), (void *)r.output(6));
+		} break;
+		case GLP_glGetBooleanv: {
+			glGetBooleanv(GLenum(r.value(0)), (GLboolean *)r.output(1));
+		} break;
+		case GLP_glGetDoublev: {
+			glGetDoublev(GLenum(r.value(0)), (GLdouble *)r.output(1));
+		} break;
+		case GLP_glGetError: {
+			glGetError();
+		} break;
+		case GLP_glGetFloatv: {
+			glGetFloatv(GLenum(r.value(0)), (GLfloat *)r.output(1));
+		} break;
+		case GLP_glGetIntegerv: {
+			glGetIntegerv(GLenum(r.value(0)), (GLint *)r.output(1));
+		} break;
+		case GLP_glGetString: {
+			glGetString(GLenum(r.value(0)));
+		} break;
+		case GLP_glGetTexImage: {
+			glGetTexImage(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLenum(r.value(3)), (void *)r.output(4));
+		} break;
+		case GLP_glGetTexParameterfv: {
+			glGetTexParameterfv(GLenum(r.value(0)), GLenum(r.value(1)), (GLfloat *)r.output(2));
+		} break;
+		case GLP_glGetTexParameteriv: {
+			glGetTexParameteriv(GLenum(r.value(0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetTexLevelParameterfv: {
+			glGetTexLevelParameterfv(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), (GLfloat *)r.output(3));
+		} break;
+		case GLP_glGetTexLevelParameteriv: {
+			glGetTexLevelParameteriv(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), (GLint *)r.output(3));
+		} break;
+		case GLP_glIsEnabled: {
+			glIsEnabled(GLenum(r.value(0)));
+		} break;
+		case GLP_glDepthRange: {
+			glDepthRange(r.double_value(0), r.double_value(1));
+		} break;
+		case GLP_glViewport: {
+			glViewport(GLint(r.value(0)), GLint(r.value(1)), GLsizei(r.value(2)), GLsizei(r.value(3)));
+		} break;
+		case GLP_glDrawArrays: {
+			glDrawArrays(GLenum(r.value(0)), GLint(r.value(1)), GLsizei(r.value(2)));
+		} break;
+		case GLP_glDrawElements: {
+			glDrawElements(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), (const void *)r.pointer(3));
+		} break;
+		case GLP_glGetPointerv: {
+			glGetPointerv(GLenum(r.value(0)), (void **)r.output(1));
+		} break;
+		case GLP_glPolygonOffset: {
+			glPolygonOffset(r.float_value(0), r.float_value(1));
+		} break;
+		case GLP_glCopyTexImage1D: {
+			glCopyTexImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)), GLint(r.value(6)));
+		} break;
+		case GLP_glCopyTexImage2D: {
+			glCopyTexImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)), GLsizei(r.value(6)), GLint(r.value(7)));
+		} break;
+		case GLP_glCopyTexSubImage1D: {
+			glCopyTexSubImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)));
+		} break;
+		case GLP_glCopyTexSubImage2D: {
+			glCopyTexSubImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLint(r.value(5)), GLsizei(r.value(6)), GLsizei(r.value(7)));
+		} break;
+		case GLP_glTexSubImage1D: {
+			glTexSubImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLsizei(r.value(3)), GLenum(r.value(4)), GLenum(r.value(5)), (const void *)r.pointer(6));
+		} break;
+		case GLP_glTexSubImage2D: {
+			glTexSubImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLsizei(r.value(4)), GLsizei(r.value(5)), GLenum(r.value(6)), GLenum(r.value(7)), (const void *)r.pointer(8));
+		} break;
+		case GLP_glBindTexture: {
+			glBindTexture(GLenum(r.value(0)), GLuint(r.name(GLReplay::Texture, 1)));
+		} break;
+		case GLP_glDeleteTextures: {
+			glDeleteTextures(GLsizei(r.value(0)), r.names(GLReplay::Texture, 1));
+		} break;
+		case GLP_glGenTextures: {
+			glGenTextures(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Texture, 1);
+		} break;
+		case GLP_glIsTexture: {
+			glIsTexture(GLuint(r.name(GLReplay::Texture, 0)));
+		} break;
+		case GLP_glDrawRangeElements: {
+			glDrawRangeElements(GLenum(r.value(0)), GLuint(r.value(1)), GLuint(r.value(2)), GLsizei(r.value(3)), GLenum(r.value(4)), (const void *)r.pointer(5));
+		} break;
+		case GLP_glTexImage3D: {
+			glTexImage3D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLsizei(r.value(5)), GLint(r.value(6)), GLenum(r.value(7)), GLenum(r.value(8)), (const void *)r.pointer(9));
+		} break;
+		case GLP_glTexSubImage3D: {
+			glTexSubImage3D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)), GLsizei(r.value(6)), GLsizei(r.value(7)), GLenum(r.value(8)), GLenum(r.value(9)), (const void *)r.pointer(10));
+		} break;
+		case GLP_glCopyTexSubImage3D: {
+			glCopyTexSubImage3D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLint(r.value(5)), GLint(r.value(6)), GLsizei(r.value(7)), GLsizei(r.value(8)));
+		} break;
+		case GLP_glActiveTexture: {
+			glActiveTexture(GLenum(r.value(0)));
+		} break;
+		case GLP_glSampleCoverage: {
+			glSampleCoverage(r.float_value(0), GLboolean(r.value(1)));
+		} break;
+		case GLP_glCompressedTexImage3D: {
+			glCompressedTexImage3D(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLsizei(r.value(5)), GLint(r.value(6)), GLsizei(r.value(7)), (const void *)r.pointer(8));
+		} break;
+		case GLP_glCompressedTexImage2D: {
+			glCompressedTexImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLint(r.value(5)), GLsizei(r.value(6)), (const void *)r.pointer(7));
+		} break;
+		case GLP_glCompressedTexImage1D: {
+			glCompressedTexImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)), (const void *)r.pointer(6));
+		} break;
+		case GLP_glCompressedTexSubImage3D: {
+			glCompressedTexSubImage3D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLsizei(r.value(5)), GLsizei(r.value(6)), GLsizei(r.value(7)), GLenum(r.value(8)), GLsizei(r.value(9)), (const void *)r.pointer(10));
+		} break;
+		case GLP_glCompressedTexSubImage2D: {
+			glCompressedTexSubImage2D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLsizei(r.value(4)), GLsizei(r.value(5)), GLenum(r.value(6)), GLsizei(r.value(7)), (const void *)r.pointer(8));
+		} break;
+		case GLP_glCompressedTexSubImage1D: {
+			glCompressedTexSubImage1D(GLenum(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLsizei(r.value(3)), GLenum(r.value(4)), GLsizei(r.value(5)), (const void *)r.pointer(6));
+		} break;
+		case GLP_glGetCompressedTexImage: {
+			glGetCompressedTexImage(GLenum(r.value(0)), GLint(r.value(1)), (void *)r.output(2));
+		} break;
+		case GLP_glBlendFuncSeparate: {
+			glBlendFuncSeparate(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLenum(r.value(3)));
+		} break;
+		case GLP_glMultiDrawArrays: {
+			glMultiDrawArrays(GLenum(r.value(0)), (const GLint *)r.pointer(1), (const GLsizei *)r.pointer(2), GLsizei(r.value(3)));
+		} break;
+		case GLP_glMultiDrawElements: {
+			glMultiDrawElements(GLenum(r.value(0)), (const GLsizei *)r.pointer(1), GLenum(r.value(2)), (const void *const*)r.pointer(3), GLsizei(r.value(4)));
+		} break;
+		case GLP_glPointParameterf: {
+			glPointParameterf(GLenum(r.value(0)), r.float_value(1));
+		} break;
+		case GLP_glPointParameterfv: {
+			glPointParameterfv(GLenum(r.value(0)), (const GLfloat *)r.pointer(1));
+		} break;
+		case GLP_glPointParameteri: {
+			glPointParameteri(GLenum(r.value(0)), GLint(r.value(1)));
+		} break;
+		case GLP_glPointParameteriv: {
+			glPointParameteriv(GLenum(r.value(0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glBlendColor: {
+			glBlendColor(r.float_value(0), r.float_value(1), r.float_value(2), r.float_value(3));
+		} break;
+		case GLP_glBlendEquation: {
+			glBlendEquation(GLenum(r.value(0)));
+		} break;
+		case GLP_glGenQueries: {
+			glGenQueries(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Query, 1);
+		} break;
+		case GLP_glDeleteQueries: {
+			glDeleteQueries(GLsizei(r.value(0)), r.names(GLReplay::Query, 1));
+		} break;
+		case GLP_glIsQuery: {
+			glIsQuery(GLuint(r.name(GLReplay::Query, 0)));
+		} break;
+		case GLP_glBeginQuery: {
+			glBeginQuery(GLenum(r.value(0)), GLuint(r.name(GLReplay::Query, 1)));
+		} break;
+		case GLP_glEndQuery: {
+			glEndQuery(GLenum(r.value(0)));
+		} break;
+		case GLP_glGetQueryiv: {
+			glGetQueryiv(GLenum(r.value(0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetQueryObjectiv: {
+			glGetQueryObjectiv(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetQueryObjectuiv: {
+			glGetQueryObjectuiv(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)), (GLuint *)r.output(2));
+		} break;
+		case GLP_glBindBuffer: {
+			glBindBuffer(GLenum(r.value(0)), GLuint(r.name(GLReplay::Buffer, 1)));
+		} break;
+		case GLP_glDeleteBuffers: {
+			glDeleteBuffers(GLsizei(r.value(0)), r.names(GLReplay::Buffer, 1));
+		} break;
+		case GLP_glGenBuffers: {
+			glGenBuffers(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Buffer, 1);
+		} break;
+		case GLP_glIsBuffer: {
+			glIsBuffer(GLuint(r.name(GLReplay::Buffer, 0)));
+		} break;
+		case GLP_glBufferData: {
+			glBufferData(GLenum(r.value(0)), GLsizeiptr(r.value(1)), (const void *)r.pointer(2), GLenum(r.value(3)));
+		} break;
+		case GLP_glBufferSubData: {
+			glBufferSubData(GLenum(r.value(0)), GLintptr(r.value(1)), GLsizeiptr(r.value(2)), (const void *)r.pointer(3));
+		} break;
+		case GLP_glGetBufferSubData: {
+			glGetBufferSubData(GLenum(r.value(0)), GLintptr(r.value(1)), GLsizeiptr(r.value(2)), (void *)r.output(3));
+		} break;
+		case GLP_glMapBuffer: {
+			glMapBuffer(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glUnmapBuffer: {
+			glUnmapBuffer(GLenum(r.value(0)));
+		} break;
+		case GLP_glGetBufferParameteriv: {
+			glGetBufferParameteriv(GLenum(r.value(0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetBufferPointerv: {
+			glGetBufferPointerv(GLenum(r.value(0)), GLenum(r.value(1)), (void **)r.output(2));
+		} break;
+		case GLP_glBlendEquationSeparate: {
+			glBlendEquationSeparate(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glDrawBuffers: {
+			glDrawBuffers(GLsizei(r.value(0)), (const GLenum *)r.pointer(1));
+		} break;
+		case GLP_glStencilOpSeparate: {
+			glStencilOpSeparate(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLenum(r.value(3)));
+		} break;
+		case GLP_glStencilFuncSeparate: {
+			glStencilFuncSeparate(GLenum(r.value(0)), GLenum(r.value(1)), GLint(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glStencilMaskSeparate: {
+			glStencilMaskSeparate(GLenum(r.value(0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glAttachShader: {
+			glAttachShader(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.name(GLReplay::Shader, 1)));
+		} break;
+		case GLP_glBindAttribLocation: {
+			glBindAttribLocation(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.name(GLReplay::Attrib, 1)), (const GLchar *)r.pointer(2));
+		} break;
+		case GLP_glCompileShader: {
+			glCompileShader(GLuint(r.name(GLReplay::Shader, 0)));
+		} break;
+		case GLP_glCreateProgram: {
+			r.returned(GLReplay::Program, gl_record_value(glCreateProgram()));
+		} break;
+		case GLP_glCreateShader: {
+			r.returned(GLReplay::Shader, gl_record_value(glCreateShader(GLenum(r.value(0)))));
+		} break;
+		case GLP_glDeleteProgram: {
+			glDeleteProgram(GLuint(r.name(GLReplay::Program, 0)));
+		} break;
+		case GLP_glDeleteShader: {
+			glDeleteShader(GLuint(r.name(GLReplay::Shader, 0)));
+		} break;
+		case GLP_glDetachShader: {
+			glDetachShader(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.name(GLReplay::Shader, 1)));
+		} break;
+		case GLP_glDisableVertexAttribArray: {
+			glDisableVertexAttribArray(GLuint(r.name(GLReplay::Attrib, 0)));
+		} break;
+		case GLP_glEnableVertexAttribArray: {
+			glEnableVertexAttribArray(GLuint(r.name(GLReplay::Attrib, 0)));
+		} break;
+		case GLP_glGetActiveAttrib: {
+			glGetActiveAttrib(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLint *)r.output(4), (GLenum *)r.output(5), (GLchar *)r.output(6));
+		} break;
+		case GLP_glGetActiveUniform: {
+			glGetActiveUniform(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLint *)r.output(4), (GLenum *)r.output(5), (GLchar *)r.output(6));
+		} break;
+		case GLP_glGetAttachedShaders: {
+			glGetAttachedShaders(GLuint(r.name(GLReplay::Program, 0)), GLsizei(r.value(1)), (GLsizei *)r.output(2), (GLuint *)r.output(3));
+		} break;
+		case GLP_glGetAttribLocation: {
+			r.returned(GLReplay::Attrib, gl_record_value(glGetAttribLocation(GLuint(r.name(GLReplay::Program, 0)), (const GLchar *)r.pointer(1))));
+		} break;
+		case GLP_glGetProgramiv: {
+			glGetProgramiv(GLuint(r.name(GLReplay::Program, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetProgramInfoLog: {
+			glGetProgramInfoLog(GLuint(r.name(GLReplay::Program, 0)), GLsizei(r.value(1)), (GLsizei *)r.output(2), (GLchar *)r.output(3));
+		} break;
+		case GLP_glGetShaderiv: {
+			glGetShaderiv(GLuint(r.name(GLReplay::Shader, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetShaderInfoLog: {
+			glGetShaderInfoLog(GLuint(r.name(GLReplay::Shader, 0)), GLsizei(r.value(1)), (GLsizei *)r.output(2), (GLchar *)r.output(3));
+		} break;
+		case GLP_glGetShaderSource: {
+			glGetShaderSource(GLuint(r.name(GLReplay::Shader, 0)), GLsizei(r.value(1)), (GLsizei *)r.output(2), (GLchar *)r.output(3));
+		} break;
+		case GLP_glGetUniformLocation: {
+			r.returned(GLReplay::Uniform, gl_record_value(glGetUniformLocation(GLuint(r.name(GLReplay::Program, 0)), (const GLchar *)r.pointer(1))));
+		} break;
+		case GLP_glGetUniformfv: {
+			glGetUniformfv(GLuint(r.name(GLReplay::Program, 0)), GLint(r.name(GLReplay::Uniform, 1)), (GLfloat *)r.output(2));
+		} break;
+		case GLP_glGetUniformiv: {
+			glGetUniformiv(GLuint(r.name(GLReplay::Program, 0)), GLint(r.name(GLReplay::Uniform, 1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetVertexAttribdv: {
+			glGetVertexAttribdv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (GLdouble *)r.output(2));
+		} break;
+		case GLP_glGetVertexAttribfv: {
+			glGetVertexAttribfv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (GLfloat *)r.output(2));
+		} break;
+		case GLP_glGetVertexAttribiv: {
+			glGetVertexAttribiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetVertexAttribPointerv: {
+			glGetVertexAttribPointerv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (void **)r.output(2));
+		} break;
+		case GLP_glIsProgram: {
+			glIsProgram(GLuint(r.name(GLReplay::Program, 0)));
+		} break;
+		case GLP_glIsShader: {
+			glIsShader(GLuint(r.name(GLReplay::Shader, 0)));
+		} break;
+		case GLP_glLinkProgram: {
+			glLinkProgram(GLuint(r.name(GLReplay::Program, 0)));
+		} break;
+		case GLP_glShaderSource: {
+			GLchar const *source = r.shader_source(2);
+			glShaderSource(GLuint(r.name(GLReplay::Shader, 0)), 1, &source, nullptr);
+		} break;
+		case GLP_glUseProgram: {
+			glUseProgram(GLuint(r.name(GLReplay::Program, 0)));
+			r.recorded_program = r.value(0);
+		} break;
+		case GLP_glUniform1f: {
+			glUniform1f(GLint(r.name(GLReplay::Uniform, 0)), r.float_value(1));
+		} break;
+		case GLP_glUniform2f: {
+			glUniform2f(GLint(r.name(GLReplay::Uniform, 0)), r.float_value(1), r.float_value(2));
+		} break;
+		case GLP_glUniform3f: {
+			glUniform3f(GLint(r.name(GLReplay::Uniform, 0)), r.float_value(1), r.float_value(2), r.float_value(3));
+		} break;
+		case GLP_glUniform4f: {
+			glUniform4f(GLint(r.name(GLReplay::Uniform, 0)), r.float_value(1), r.float_value(2), r.float_value(3), r.float_value(4));
+		} break;
+		case GLP_glUniform1i: {
+			glUniform1i(GLint(r.name(GLReplay::Uniform, 0)), GLint(r.value(1)));
+		} break;
+		case GLP_glUniform2i: {
+			glUniform2i(GLint(r.name(GLReplay::Uniform, 0)), GLint(r.value(1)), GLint(r.value(2)));
+		} break;
+		case GLP_glUniform3i: {
+			glUniform3i(GLint(r.name(GLReplay::Uniform, 0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)));
+		} break;
+		case GLP_glUniform4i: {
+			glUniform4i(GLint(r.name(GLReplay::Uniform, 0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)));
+		} break;
+		case GLP_glUniform1fv: {
+			glUniform1fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glUniform2fv: {
+			glUniform2fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glUniform3fv: {
+			glUniform3fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glUniform4fv: {
+			glUniform4fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glUniform1iv: {
+			glUniform1iv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glUniform2iv: {
+			glUniform2iv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glUniform3iv: {
+			glUniform3iv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glUniform4iv: {
+			glUniform4iv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glUniformMatrix2fv: {
+			glUniformMatrix2fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix3fv: {
+			glUniformMatrix3fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix4fv: {
+			glUniformMatrix4fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glValidateProgram: {
+			glValidateProgram(GLuint(r.name(GLReplay::Program, 0)));
+		} break;
+		case GLP_glVertexAttrib1d: {
+			glVertexAttrib1d(GLuint(r.name(GLReplay::Attrib, 0)), r.double_value(1));
+		} break;
+		case GLP_glVertexAttrib1dv: {
+			glVertexAttrib1dv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLdouble *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib1f: {
+			glVertexAttrib1f(GLuint(r.name(GLReplay::Attrib, 0)), r.float_value(1));
+		} break;
+		case GLP_glVertexAttrib1fv: {
+			glVertexAttrib1fv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLfloat *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib1s: {
+			glVertexAttrib1s(GLuint(r.name(GLReplay::Attrib, 0)), GLshort(r.value(1)));
+		} break;
+		case GLP_glVertexAttrib1sv: {
+			glVertexAttrib1sv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib2d: {
+			glVertexAttrib2d(GLuint(r.name(GLReplay::Attrib, 0)), r.double_value(1), r.double_value(2));
+		} break;
+		case GLP_glVertexAttrib2dv: {
+			glVertexAttrib2dv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLdouble *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib2f: {
+			glVertexAttrib2f(GLuint(r.name(GLReplay::Attrib, 0)), r.float_value(1), r.float_value(2));
+		} break;
+		case GLP_glVertexAttrib2fv: {
+			glVertexAttrib2fv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLfloat *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib2s: {
+			glVertexAttrib2s(GLuint(r.name(GLReplay::Attrib, 0)), GLshort(r.value(1)), GLshort(r.value(2)));
+		} break;
+		case GLP_glVertexAttrib2sv: {
+			glVertexAttrib2sv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib3d: {
+			glVertexAttrib3d(GLuint(r.name(GLReplay::Attrib, 0)), r.double_value(1), r.double_value(2), r.double_value(3));
+		} break;
+		case GLP_glVertexAttrib3dv: {
+			glVertexAttrib3dv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLdouble *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib3f: {
+			glVertexAttrib3f(GLuint(r.name(GLReplay::Attrib, 0)), r.float_value(1), r.float_value(2), r.float_value(3));
+		} break;
+		case GLP_glVertexAttrib3fv: {
+			glVertexAttrib3fv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLfloat *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib3s: {
+			glVertexAttrib3s(GLuint(r.name(GLReplay::Attrib, 0)), GLshort(r.value(1)), GLshort(r.value(2)), GLshort(r.value(3)));
+		} break;
+		case GLP_glVertexAttrib3sv: {
+			glVertexAttrib3sv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Nbv: {
+			glVertexAttrib4Nbv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLbyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Niv: {
+			glVertexAttrib4Niv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Nsv: {
+			glVertexAttrib4Nsv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Nub: {
+			glVertexAttrib4Nub(GLuint(r.name(GLReplay::Attrib, 0)), GLubyte(r.value(1)), GLubyte(r.value(2)), GLubyte(r.value(3)), GLubyte(r.value(4)));
+		} break;
+		case GLP_glVertexAttrib4Nubv: {
+			glVertexAttrib4Nubv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLubyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Nuiv: {
+			glVertexAttrib4Nuiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4Nusv: {
+			glVertexAttrib4Nusv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLushort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4bv: {
+			glVertexAttrib4bv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLbyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4d: {
+			glVertexAttrib4d(GLuint(r.name(GLReplay::Attrib, 0)), r.double_value(1), r.double_value(2), r.double_value(3), r.double_value(4));
+		} break;
+		case GLP_glVertexAttrib4dv: {
+			glVertexAttrib4dv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLdouble *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4f: {
+			glVertexAttrib4f(GLuint(r.name(GLReplay::Attrib, 0)), r.float_value(1), r.float_value(2), r.float_value(3), r.float_value(4));
+		} break;
+		case GLP_glVertexAttrib4fv: {
+			glVertexAttrib4fv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLfloat *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4iv: {
+			glVertexAttrib4iv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4s: {
+			glVertexAttrib4s(GLuint(r.name(GLReplay::Attrib, 0)), GLshort(r.value(1)), GLshort(r.value(2)), GLshort(r.value(3)), GLshort(r.value(4)));
+		} break;
+		case GLP_glVertexAttrib4sv: {
+			glVertexAttrib4sv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4ubv: {
+			glVertexAttrib4ubv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLubyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4uiv: {
+			glVertexAttrib4uiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttrib4usv: {
+			glVertexAttrib4usv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLushort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribPointer: {
+			glVertexAttribPointer(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)), GLenum(r.value(2)), GLboolean(r.value(3)), GLsizei(r.value(4)), (const void *)r.pointer(5));
+		} break;
+		case GLP_glUniformMatrix2x3fv: {
+			glUniformMatrix2x3fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix3x2fv: {
+			glUniformMatrix3x2fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix2x4fv: {
+			glUniformMatrix2x4fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix4x2fv: {
+			glUniformMatrix4x2fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix3x4fv: {
+			glUniformMatrix3x4fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glUniformMatrix4x3fv: {
+			glUniformMatrix4x3fv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), GLboolean(r.value(2)), (const GLfloat *)r.pointer(3));
+		} break;
+		case GLP_glColorMaski: {
+			glColorMaski(GLuint(r.value(0)), GLboolean(r.value(1)), GLboolean(r.value(2)), GLboolean(r.value(3)), GLboolean(r.value(4)));
+		} break;
+		case GLP_glGetBooleani_v: {
+			glGetBooleani_v(GLenum(r.value(0)), GLuint(r.value(1)), (GLboolean *)r.output(2));
+		} break;
+		case GLP_glGetIntegeri_v: {
+			glGetIntegeri_v(GLenum(r.value(0)), GLuint(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glEnablei: {
+			glEnablei(GLenum(r.value(0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glDisablei: {
+			glDisablei(GLenum(r.value(0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glIsEnabledi: {
+			glIsEnabledi(GLenum(r.value(0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glBeginTransformFeedback: {
+			glBeginTransformFeedback(GLenum(r.value(0)));
+		} break;
+		case GLP_glEndTransformFeedback: {
+			glEndTransformFeedback();
+		} break;
+		case GLP_glBindBufferRange: {
+			glBindBufferRange(GLenum(r.value(0)), GLuint(r.value(1)), GLuint(r.name(GLReplay::Buffer, 2)), GLintptr(r.value(3)), GLsizeiptr(r.value(4)));
+		} break;
+		case GLP_glBindBufferBase: {
+			glBindBufferBase(GLenum(r.value(0)), GLuint(r.value(1)), GLuint(r.name(GLReplay::Buffer, 2)));
+		} break;
+		case GLP_glTransformFeedbackVaryings: {
+			glTransformFeedbackVaryings(GLuint(r.name(GLReplay::Program, 0)), GLsizei(r.value(1)), (const GLchar *const*)r.pointer(2), GLenum(r.value(3)));
+		} break;
+		case GLP_glGetTransformFeedbackVarying: {
+			glGetTransformFeedbackVarying(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLsizei *)r.output(4), (GLenum *)r.output(5), (GLchar *)r.output(6));
+		} break;
+		case GLP_glClampColor: {
+			glClampColor(GLenum(r.value(0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glBeginConditionalRender: {
+			glBeginConditionalRender(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glEndConditionalRender: {
+			glEndConditionalRender();
+		} break;
+		case GLP_glVertexAttribIPointer: {
+			glVertexAttribIPointer(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), (const void *)r.pointer(4));
+		} break;
+		case GLP_glGetVertexAttribIiv: {
+			glGetVertexAttribIiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetVertexAttribIuiv: {
+			glGetVertexAttribIuiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), (GLuint *)r.output(2));
+		} break;
+		case GLP_glVertexAttribI1i: {
+			glVertexAttribI1i(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)));
+		} break;
+		case GLP_glVertexAttribI2i: {
+			glVertexAttribI2i(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)), GLint(r.value(2)));
+		} break;
+		case GLP_glVertexAttribI3i: {
+			glVertexAttribI3i(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribI4i: {
+			glVertexAttribI4i(GLuint(r.name(GLReplay::Attrib, 0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)));
+		} break;
+		case GLP_glVertexAttribI1ui: {
+			glVertexAttribI1ui(GLuint(r.name(GLReplay::Attrib, 0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glVertexAttribI2ui: {
+			glVertexAttribI2ui(GLuint(r.name(GLReplay::Attrib, 0)), GLuint(r.value(1)), GLuint(r.value(2)));
+		} break;
+		case GLP_glVertexAttribI3ui: {
+			glVertexAttribI3ui(GLuint(r.name(GLReplay::Attrib, 0)), GLuint(r.value(1)), GLuint(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribI4ui: {
+			glVertexAttribI4ui(GLuint(r.name(GLReplay::Attrib, 0)), GLuint(r.value(1)), GLuint(r.value(2)), GLuint(r.value(3)), GLuint(r.value(4)));
+		} break;
+		case GLP_glVertexAttribI1iv: {
+			glVertexAttribI1iv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI2iv: {
+			glVertexAttribI2iv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI3iv: {
+			glVertexAttribI3iv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4iv: {
+			glVertexAttribI4iv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI1uiv: {
+			glVertexAttribI1uiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI2uiv: {
+			glVertexAttribI2uiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI3uiv: {
+			glVertexAttribI3uiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4uiv: {
+			glVertexAttribI4uiv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLuint *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4bv: {
+			glVertexAttribI4bv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLbyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4sv: {
+			glVertexAttribI4sv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLshort *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4ubv: {
+			glVertexAttribI4ubv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLubyte *)r.pointer(1));
+		} break;
+		case GLP_glVertexAttribI4usv: {
+			glVertexAttribI4usv(GLuint(r.name(GLReplay::Attrib, 0)), (const GLushort *)r.pointer(1));
+		} break;
+		case GLP_glGetUniformuiv: {
+			glGetUniformuiv(GLuint(r.name(GLReplay::Program, 0)), GLint(r.name(GLReplay::Uniform, 1)), (GLuint *)r.output(2));
+		} break;
+		case GLP_glBindFragDataLocation: {
+			glBindFragDataLocation(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), (const GLchar *)r.pointer(2));
+		} break;
+		case GLP_glGetFragDataLocation: {
+			glGetFragDataLocation(GLuint(r.name(GLReplay::Program, 0)), (const GLchar *)r.pointer(1));
+		} break;
+		case GLP_glUniform1ui: {
+			glUniform1ui(GLint(r.name(GLReplay::Uniform, 0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glUniform2ui: {
+			glUniform2ui(GLint(r.name(GLReplay::Uniform, 0)), GLuint(r.value(1)), GLuint(r.value(2)));
+		} break;
+		case GLP_glUniform3ui: {
+			glUniform3ui(GLint(r.name(GLReplay::Uniform, 0)), GLuint(r.value(1)), GLuint(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glUniform4ui: {
+			glUniform4ui(GLint(r.name(GLReplay::Uniform, 0)), GLuint(r.value(1)), GLuint(r.value(2)), GLuint(r.value(3)), GLuint(r.value(4)));
+		} break;
+		case GLP_glUniform1uiv: {
+			glUniform1uiv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glUniform2uiv: {
+			glUniform2uiv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glUniform3uiv: {
+			glUniform3uiv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glUniform4uiv: {
+			glUniform4uiv(GLint(r.name(GLReplay::Uniform, 0)), GLsizei(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glTexParameterIiv: {
+			glTexParameterIiv(GLenum(r.value(0)), GLenum(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glTexParameterIuiv: {
+			glTexParameterIuiv(GLenum(r.value(0)), GLenum(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glGetTexParameterIiv: {
+			glGetTexParameterIiv(GLenum(r.value(0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetTexParameterIuiv: {
+			glGetTexParameterIuiv(GLenum(r.value(0)), GLenum(r.value(1)), (GLuint *)r.output(2));
+		} break;
+		case GLP_glClearBufferiv: {
+			glClearBufferiv(GLenum(r.value(0)), GLint(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glClearBufferuiv: {
+			glClearBufferuiv(GLenum(r.value(0)), GLint(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glClearBufferfv: {
+			glClearBufferfv(GLenum(r.value(0)), GLint(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glClearBufferfi: {
+			glClearBufferfi(GLenum(r.value(0)), GLint(r.value(1)), r.float_value(2), GLint(r.value(3)));
+		} break;
+		case GLP_glGetStringi: {
+			glGetStringi(GLenum(r.value(0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glIsRenderbuffer: {
+			glIsRenderbuffer(GLuint(r.name(GLReplay::Renderbuffer, 0)));
+		} break;
+		case GLP_glBindRenderbuffer: {
+			glBindRenderbuffer(GLenum(r.value(0)), GLuint(r.name(GLReplay::Renderbuffer, 1)));
+		} break;
+		case GLP_glDeleteRenderbuffers: {
+			glDeleteRenderbuffers(GLsizei(r.value(0)), r.names(GLReplay::Renderbuffer, 1));
+		} break;
+		case GLP_glGenRenderbuffers: {
+			glGenRenderbuffers(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Renderbuffer, 1);
+		} break;
+		case GLP_glRenderbufferStorage: {
+			glRenderbufferStorage(GLenum(r.value(0)), GLenum(r.value(1)), GLsizei(r.value(2)), GLsizei(r.value(3)));
+		} break;
+		case GLP_glGetRenderbufferParameteriv: {
+			glGetRenderbufferParameteriv(GLenum(r.value(0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glIsFramebuffer: {
+			glIsFramebuffer(GLuint(r.name(GLReplay::Framebuffer, 0)));
+		} break;
+		case GLP_glBindFramebuffer: {
+			glBindFramebuffer(GLenum(r.value(0)), GLuint(r.name(GLReplay::Framebuffer, 1)));
+		} break;
+		case GLP_glDeleteFramebuffers: {
+			glDeleteFramebuffers(GLsizei(r.value(0)), r.names(GLReplay::Framebuffer, 1));
+		} break;
+		case GLP_glGenFramebuffers: {
+			glGenFramebuffers(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Framebuffer, 1);
+		} break;
+		case GLP_glCheckFramebufferStatus: {
+			glCheckFramebufferStatus(GLenum(r.value(0)));
+		} break;
+		case GLP_glFramebufferTexture1D: {
+			glFramebufferTexture1D(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLuint(r.name(GLReplay::Texture, 3)), GLint(r.value(4)));
+		} break;
+		case GLP_glFramebufferTexture2D: {
+			glFramebufferTexture2D(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLuint(r.name(GLReplay::Texture, 3)), GLint(r.value(4)));
+		} break;
+		case GLP_glFramebufferTexture3D: {
+			glFramebufferTexture3D(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLuint(r.name(GLReplay::Texture, 3)), GLint(r.value(4)), GLint(r.value(5)));
+		} break;
+		case GLP_glFramebufferRenderbuffer: {
+			glFramebufferRenderbuffer(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), GLuint(r.name(GLReplay::Renderbuffer, 3)));
+		} break;
+		case GLP_glGetFramebufferAttachmentParameteriv: {
+			glGetFramebufferAttachmentParameteriv(GLenum(r.value(0)), GLenum(r.value(1)), GLenum(r.value(2)), (GLint *)r.output(3));
+		} break;
+		case GLP_glGenerateMipmap: {
+			glGenerateMipmap(GLenum(r.value(0)));
+		} break;
+		case GLP_glBlitFramebuffer: {
+			glBlitFramebuffer(GLint(r.value(0)), GLint(r.value(1)), GLint(r.value(2)), GLint(r.value(3)), GLint(r.value(4)), GLint(r.value(5)), GLint(r.value(6)), GLint(r.value(7)), GLbitfield(r.value(8)), GLenum(r.value(9)));
+		} break;
+		case GLP_glRenderbufferStorageMultisample: {
+			glRenderbufferStorageMultisample(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)));
+		} break;
+		case GLP_glFramebufferTextureLayer: {
+			glFramebufferTextureLayer(GLenum(r.value(0)), GLenum(r.value(1)), GLuint(r.name(GLReplay::Texture, 2)), GLint(r.value(3)), GLint(r.value(4)));
+		} break;
+		case GLP_glMapBufferRange: {
+			glMapBufferRange(GLenum(r.value(0)), GLintptr(r.value(1)), GLsizeiptr(r.value(2)), GLbitfield(r.value(3)));
+		} break;
+		case GLP_glFlushMappedBufferRange: {
+			glFlushMappedBufferRange(GLenum(r.value(0)), GLintptr(r.value(1)), GLsizeiptr(r.value(2)));
+		} break;
+		case GLP_glBindVertexArray: {
+			glBindVertexArray(GLuint(r.name(GLReplay::VertexArray, 0)));
+		} break;
+		case GLP_glDeleteVertexArrays: {
+			glDeleteVertexArrays(GLsizei(r.value(0)), r.names(GLReplay::VertexArray, 1));
+		} break;
+		case GLP_glGenVertexArrays: {
+			glGenVertexArrays(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::VertexArray, 1);
+		} break;
+		case GLP_glIsVertexArray: {
+			glIsVertexArray(GLuint(r.name(GLReplay::VertexArray, 0)));
+		} break;
+		case GLP_glDrawArraysInstanced: {
+			glDrawArraysInstanced(GLenum(r.value(0)), GLint(r.value(1)), GLsizei(r.value(2)), GLsizei(r.value(3)));
+		} break;
+		case GLP_glDrawElementsInstanced: {
+			glDrawElementsInstanced(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), (const void *)r.pointer(3), GLsizei(r.value(4)));
+		} break;
+		case GLP_glTexBuffer: {
+			glTexBuffer(GLenum(r.value(0)), GLenum(r.value(1)), GLuint(r.name(GLReplay::Buffer, 2)));
+		} break;
+		case GLP_glPrimitiveRestartIndex: {
+			glPrimitiveRestartIndex(GLuint(r.value(0)));
+		} break;
+		case GLP_glCopyBufferSubData: {
+			glCopyBufferSubData(GLenum(r.value(0)), GLenum(r.value(1)), GLintptr(r.value(2)), GLintptr(r.value(3)), GLsizeiptr(r.value(4)));
+		} break;
+		case GLP_glGetUniformIndices: {
+			glGetUniformIndices(GLuint(r.name(GLReplay::Program, 0)), GLsizei(r.value(1)), (const GLchar *const*)r.pointer(2), (GLuint *)r.output(3));
+		} break;
+		case GLP_glGetActiveUniformsiv: {
+			glGetActiveUniformsiv(GLuint(r.name(GLReplay::Program, 0)), GLsizei(r.value(1)), (const GLuint *)r.pointer(2), GLenum(r.value(3)), (GLint *)r.output(4));
+		} break;
+		case GLP_glGetActiveUniformName: {
+			glGetActiveUniformName(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLchar *)r.output(4));
+		} break;
+		case GLP_glGetUniformBlockIndex: {
+			glGetUniformBlockIndex(GLuint(r.name(GLReplay::Program, 0)), (const GLchar *)r.pointer(1));
+		} break;
+		case GLP_glGetActiveUniformBlockiv: {
+			glGetActiveUniformBlockiv(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLenum(r.value(2)), (GLint *)r.output(3));
+		} break;
+		case GLP_glGetActiveUniformBlockName: {
+			glGetActiveUniformBlockName(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLchar *)r.output(4));
+		} break;
+		case GLP_glUniformBlockBinding: {
+			glUniformBlockBinding(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLuint(r.value(2)));
+		} break;
+		case GLP_glDrawElementsBaseVertex: {
+			glDrawElementsBaseVertex(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), (const void *)r.pointer(3), GLint(r.value(4)));
+		} break;
+		case GLP_glDrawRangeElementsBaseVertex: {
+			glDrawRangeElementsBaseVertex(GLenum(r.value(0)), GLuint(r.value(1)), GLuint(r.value(2)), GLsizei(r.value(3)), GLenum(r.value(4)), (const void *)r.pointer(5), GLint(r.value(6)));
+		} break;
+		case GLP_glDrawElementsInstancedBaseVertex: {
+			glDrawElementsInstancedBaseVertex(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), (const void *)r.pointer(3), GLsizei(r.value(4)), GLint(r.value(5)));
+		} break;
+		case GLP_glMultiDrawElementsBaseVertex: {
+			glMultiDrawElementsBaseVertex(GLenum(r.value(0)), (const GLsizei *)r.pointer(1), GLenum(r.value(2)), (const void *const*)r.pointer(3), GLsizei(r.value(4)), (const GLint *)r.pointer(5));
+		} break;
+		case GLP_glProvokingVertex: {
+			glProvokingVertex(GLenum(r.value(0)));
+		} break;
+		case GLP_glFenceSync: {
+			r.returned(GLReplay::Sync, gl_record_value(glFenceSync(GLenum(r.value(0)), GLbitfield(r.value(1)))));
+		} break;
+		case GLP_glIsSync: {
+			glIsSync(GLsync(r.name(GLReplay::Sync, 0)));
+		} break;
+		case GLP_glDeleteSync: {
+			glDeleteSync(GLsync(r.name(GLReplay::Sync, 0)));
+		} break;
+		case GLP_glClientWaitSync: {
+			glClientWaitSync(GLsync(r.name(GLReplay::Sync, 0)), GLbitfield(r.value(1)), GLuint64(r.value(2)));
+		} break;
+		case GLP_glWaitSync: {
+			glWaitSync(GLsync(r.name(GLReplay::Sync, 0)), GLbitfield(r.value(1)), GLuint64(r.value(2)));
+		} break;
+		case GLP_glGetInteger64v: {
+			glGetInteger64v(GLenum(r.value(0)), (GLint64 *)r.output(1));
+		} break;
+		case GLP_glGetSynciv: {
+			glGetSynciv(GLsync(r.name(GLReplay::Sync, 0)), GLenum(r.value(1)), GLsizei(r.value(2)), (GLsizei *)r.output(3), (GLint *)r.output(4));
+		} break;
+		case GLP_glGetInteger64i_v: {
+			glGetInteger64i_v(GLenum(r.value(0)), GLuint(r.value(1)), (GLint64 *)r.output(2));
+		} break;
+		case GLP_glGetBufferParameteri64v: {
+			glGetBufferParameteri64v(GLenum(r.value(0)), GLenum(r.value(1)), (GLint64 *)r.output(2));
+		} break;
+		case GLP_glFramebufferTexture: {
+			glFramebufferTexture(GLenum(r.value(0)), GLenum(r.value(1)), GLuint(r.name(GLReplay::Texture, 2)), GLint(r.value(3)));
+		} break;
+		case GLP_glTexImage2DMultisample: {
+			glTexImage2DMultisample(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLboolean(r.value(5)));
+		} break;
+		case GLP_glTexImage3DMultisample: {
+			glTexImage3DMultisample(GLenum(r.value(0)), GLsizei(r.value(1)), GLenum(r.value(2)), GLsizei(r.value(3)), GLsizei(r.value(4)), GLsizei(r.value(5)), GLboolean(r.value(6)));
+		} break;
+		case GLP_glGetMultisamplefv: {
+			glGetMultisamplefv(GLenum(r.value(0)), GLuint(r.value(1)), (GLfloat *)r.output(2));
+		} break;
+		case GLP_glSampleMaski: {
+			glSampleMaski(GLuint(r.value(0)), GLbitfield(r.value(1)));
+		} break;
+		case GLP_glBindFragDataLocationIndexed: {
+			glBindFragDataLocationIndexed(GLuint(r.name(GLReplay::Program, 0)), GLuint(r.value(1)), GLuint(r.value(2)), (const GLchar *)r.pointer(3));
+		} break;
+		case GLP_glGetFragDataIndex: {
+			glGetFragDataIndex(GLuint(r.name(GLReplay::Program, 0)), (const GLchar *)r.pointer(1));
+		} break;
+		case GLP_glGenSamplers: {
+			glGenSamplers(GLsizei(r.value(0)), (GLuint *)r.output(1));
+			r.generated(GLReplay::Sampler, 1);
+		} break;
+		case GLP_glDeleteSamplers: {
+			glDeleteSamplers(GLsizei(r.value(0)), r.names(GLReplay::Sampler, 1));
+		} break;
+		case GLP_glIsSampler: {
+			glIsSampler(GLuint(r.name(GLReplay::Sampler, 0)));
+		} break;
+		case GLP_glBindSampler: {
+			glBindSampler(GLuint(r.value(0)), GLuint(r.name(GLReplay::Sampler, 1)));
+		} break;
+		case GLP_glSamplerParameteri: {
+			glSamplerParameteri(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), GLint(r.value(2)));
+		} break;
+		case GLP_glSamplerParameteriv: {
+			glSamplerParameteriv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glSamplerParameterf: {
+			glSamplerParameterf(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), r.float_value(2));
+		} break;
+		case GLP_glSamplerParameterfv: {
+			glSamplerParameterfv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (const GLfloat *)r.pointer(2));
+		} break;
+		case GLP_glSamplerParameterIiv: {
+			glSamplerParameterIiv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (const GLint *)r.pointer(2));
+		} break;
+		case GLP_glSamplerParameterIuiv: {
+			glSamplerParameterIuiv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (const GLuint *)r.pointer(2));
+		} break;
+		case GLP_glGetSamplerParameteriv: {
+			glGetSamplerParameteriv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetSamplerParameterIiv: {
+			glGetSamplerParameterIiv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (GLint *)r.output(2));
+		} break;
+		case GLP_glGetSamplerParameterfv: {
+			glGetSamplerParameterfv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (GLfloat *)r.output(2));
+		} break;
+		case GLP_glGetSamplerParameterIuiv: {
+			glGetSamplerParameterIuiv(GLuint(r.name(GLReplay::Sampler, 0)), GLenum(r.value(1)), (GLuint *)r.output(2));
+		} break;
+		case GLP_glQueryCounter: {
+			glQueryCounter(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)));
+		} break;
+		case GLP_glGetQueryObjecti64v: {
+			glGetQueryObjecti64v(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)), (GLint64 *)r.output(2));
+		} break;
+		case GLP_glGetQueryObjectui64v: {
+			glGetQueryObjectui64v(GLuint(r.name(GLReplay::Query, 0)), GLenum(r.value(1)), (GLuint64 *)r.output(2));
+		} break;
+		case GLP_glVertexAttribDivisor: {
+			glVertexAttribDivisor(GLuint(r.name(GLReplay::Attrib, 0)), GLuint(r.value(1)));
+		} break;
+		case GLP_glVertexAttribP1ui: {
+			glVertexAttribP1ui(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribP1uiv: {
+			glVertexAttribP1uiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), (const GLuint *)r.pointer(3));
+		} break;
+		case GLP_glVertexAttribP2ui: {
+			glVertexAttribP2ui(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribP2uiv: {
+			glVertexAttribP2uiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), (const GLuint *)r.pointer(3));
+		} break;
+		case GLP_glVertexAttribP3ui: {
+			glVertexAttribP3ui(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribP3uiv: {
+			glVertexAttribP3uiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), (const GLuint *)r.pointer(3));
+		} break;
+		case GLP_glVertexAttribP4ui: {
+			glVertexAttribP4ui(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), GLuint(r.value(3)));
+		} break;
+		case GLP_glVertexAttribP4uiv: {
+			glVertexAttribP4uiv(GLuint(r.name(GLReplay::Attrib, 0)), GLenum(r.value(1)), GLboolean(r.value(2)), (const GLuint *)r.pointer(3));
+		} break;
+		default:
+			r.unknown_call();
+	}
+}
@@ -0,0 +1,318 @@
+#include "GLResources.hpp"
+
+#include "gl_errors.hpp"
+#include "GLStateCache.hpp"
+#include "GLRecord.hpp"
+#include "load_save_png.hpp"
+
+#include <glm/glm.hpp>
+
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+GLResourceStats gl_resource_stats;
+
+GLBuffer::GLBuffer() {
+	glGenBuffers(1, &buffer);
+}
+GLBuffer::~GLBuffer() {
+	//deleting a bound object resets the binding behind gl_state's back:
+	gl_state.invalidate();
+	glDeleteBuffers(1, &buffer);
+	buffer = 0;
+}
+
+GLTexture::GLTexture() {
+	glGenTextures(1, &texture);
+}
+GLTexture::~GLTexture() {
+	//deleting a bound object resets the binding behind gl_state's back:
+	gl_state.invalidate();
+	glDeleteTextures(1, &texture);
+	texture = 0;
+}
+
+GLVertexArray::GLVertexArray() {
+	glGenVertexArrays(1, &array);
+}
+GLVertexArray::~GLVertexArray() {
+	//deleting a bound object resets the binding behind gl_state's back:
+	gl_state.invalidate();
+	glDeleteVertexArrays(1, &array);
+	array = 0;
+}
+
+static std::unordered_map< std::string, std::weak_ptr< void const > > &registry() {
+	//function-local so it is constructed before (and destroyed after) any static users:
+	static std::unordered_map< std::string, std::weak_ptr< void const > > registry;
+	return registry;
+}
+
+std::shared_ptr< void const > find_shared_void(std::string const &key) {
+	auto f = registry().find(key);
+	if (f == registry().end()) return nullptr;
+	std::shared_ptr< void const > existing = f->second.lock();
+	if (existing) gl_resource_stats.shared += 1;
+	return existing;
+}
+
+std::shared_ptr< void const > acquire_shared_void(std::string const &key, std::function< std::shared_ptr< void const >() > const &make) {
+	if (std::shared_ptr< void const > existing = find_shared_void(key)) {
+		return existing;
+	}
+
+	std::shared_ptr< void const > made = make();
+	//creation code binds things directly, so gl_state may be out of date:
+	gl_state.invalidate();
+	//hand out a reference that removes the registry entry when the last copy goes, so keys don't pile up
+	// (e.g. for files no longer used, or vertex arrays keyed by GL names that may be reused):
+	std::shared_ptr< void const > handle(made.get(), [key, made](void const *) mutable {
+		auto f = registry().find(key);
+		if (f != registry().end() && f->second.expired()) registry().erase(f);
+		made.reset();
+	});
+	registry()[key] = handle;
+	gl_resource_stats.created += 1;
+	return handle;
+}
+
+std::shared_ptr< ColorTextureProgram const > acquire_color_texture_program() {
+	return acquire_shared< ColorTextureProgram >("color_texture_program", []() {
+		return new ColorTextureProgram();
+	});
+}
+
+std::shared_ptr< GLTexture const > acquire_white_tex() {
+	return acquire_shared< GLTexture >("white_tex", []() {
+		GLTexture *ret = new GLTexture();
+
+		//bind that texture object as a GL_TEXTURE_2D-type texture:
+		glBindTexture(GL_TEXTURE_2D, ret->texture);
+
+		//upload a 1x1 image of solid white to the texture:
+		glm::uvec2 size = glm::uvec2(1,1);
+		std::vector< glm::u8vec4 > data(size.x*size.y, glm::u8vec4(0xff, 0xff, 0xff, 0xff));
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+
+		//set filtering and wrapping parameters:
+		//(it's a bit silly to mipmap a 1x1 texture, but I'm doing it because you may want to use this code to load different sizes of texture)
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		//since texture uses a mipmap and we haven't uploaded one, instruct opengl to make one for us:
+		glGenerateMipmap(GL_TEXTURE_2D);
+
+		//Okay, texture uploaded, can unbind it:
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
+
+		return ret;
+	});
+}
+
+//a texture with 'size' pixels of 'data' (with filtering set up for scaled-down sprites):
+static GLTexture *make_mipmapped_texture(glm::uvec2 const &size, glm::u8vec4 const *data) {
+	GLTexture *ret = new GLTexture();
+	glBindTexture(GL_TEXTURE_2D, ret->texture);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glGenerateMipmap(GL_TEXTURE_2D);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
+
+	return ret;
+}
+
+std::shared_ptr< GLTexture const > acquire_png_tex(std::string const &filename) {
+	return acquire_shared< GLTexture >("png_tex:" + filename, [&filename]() {
+		//the GL recorder can't see writes through mapped buffers (see GLRecord.hpp), so upload from client memory while it's running:
+		if (gl_recording()) {
+			glm::uvec2 size = glm::uvec2(0);
+			std::vector< glm::u8vec4 > data;
+			load_png(filename, &size, &data, LowerLeftOrigin);
+			return make_mipmapped_texture(size, data.data());
+		}
+
+		//decode into a pixel unpack buffer, mapped as soon as the size is known:
+		GLBuffer unpack;
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack.buffer);
+		glm::uvec2 size = glm::uvec2(0);
+		bool mapped = false;
+		try {
+			load_png(filename, [&](glm::uvec2 const &size_, size_t *) -> void * {
+				size = size_;
+				GLsizeiptr length = GLsizeiptr(size.x) * size.y * 4;
+				glBufferData(GL_PIXEL_UNPACK_BUFFER, length, nullptr, GL_STREAM_DRAW);
+				void *at = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, length, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+				mapped = (at != nullptr);
+				return at;
+			}, LowerLeftOrigin);
+		} catch (std::exception const &e) {
+			if (mapped) glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			throw std::runtime_error("Failed to load texture from '" + filename + "': " + e.what());
+		}
+		if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) != GL_TRUE) {
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			throw std::runtime_error("Texture data for '" + filename + "' was lost while decoding.");
+		}
+
+		//(with an unpack buffer bound, the data pointer is an offset into it)
+		GLTexture *ret = make_mipmapped_texture(size, nullptr);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		return ret;
+	});
+}
+
+std::vector< std::shared_ptr< GLTexture const > > acquire_png_texs(std::vector< std::string > const &filenames) {
+	//textures already in the registry don't need their files decoded at all:
+	std::vector< std::shared_ptr< GLTexture const > > textures(filenames.size());
+	std::vector< std::string > missing;
+	std::unordered_map< std::string, size_t > missing_index; //filename -> index in 'missing'
+	for (size_t i = 0; i < filenames.size(); ++i) {
+		textures[i] = find_shared< GLTexture >("png_tex:" + filenames[i]);
+		if (!textures[i] && missing_index.emplace(filenames[i], missing.size()).second) {
+			missing.emplace_back(filenames[i]);
+		}
+	}
+	if (missing.empty()) return textures;
+
+	std::unique_ptr< PNGBatch > batch = load_png_batch(missing, LowerLeftOrigin);
+
+	for (size_t i = 0; i < filenames.size(); ++i) {
+		if (textures[i]) continue;
+		size_t m = missing_index[filenames[i]];
+		//(a repeated filename finds the texture made for its first occurrence)
+		textures[i] = acquire_shared< GLTexture >("png_tex:" + filenames[i], [&batch, m]() {
+			LoadedPNG loaded = batch->results[m].get();
+			return make_mipmapped_texture(loaded.size, loaded.data.data());
+		});
+	}
+	return textures;
+}
+
+std::shared_ptr< GLTexture const > acquire_pack_tex(AssetPack const &pack, std::string const &name) {
+	return acquire_shared< GLTexture >("pack_tex:" + pack.filename + ":" + name, [&pack, &name]() {
+		AssetPack::Entry const *entry = pack.find(name);
+		if (!entry || entry->type != AssetPack::Texture) {
+			throw std::runtime_error("Asset pack '" + pack.filename + "' has no texture named '" + name + "'.");
+		}
+		glm::uvec2 size = glm::uvec2(entry->width, entry->height);
+
+		if (entry->compression == AssetPack::Uncompressed) {
+			//(rows are stored bottom-first and tightly packed, just as glTexImage2D wants them)
+			return make_mipmapped_texture(size, reinterpret_cast< glm::u8vec4 const * >(pack.stored(*entry)));
+		}
+
+		//(as in acquire_png_tex, decompress into client memory while the GL recorder is running)
+		if (gl_recording()) {
+			std::vector< glm::u8vec4 > data(size_t(entry->size / 4));
+			pack.read(*entry, data.data());
+			return make_mipmapped_texture(size, data.data());
+		}
+
+		GLBuffer unpack;
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack.buffer);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, GLsizeiptr(entry->size), nullptr, GL_STREAM_DRAW);
+		void *at = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(entry->size), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if (!at) {
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			throw std::runtime_error("Failed to map an unpack buffer for '" + name + "' from '" + pack.filename + "'.");
+		}
+		try {
+			pack.read(*entry, at);
+		} catch (...) {
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			throw;
+		}
+		if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) != GL_TRUE) {
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			throw std::runtime_error("Texture data for '" + name + "' from '" + pack.filename + "' was lost while decompressing.");
+		}
+
+		GLTexture *ret = make_mipmapped_texture(size, nullptr);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		return ret;
+	});
+}
+
+std::shared_ptr< GLBuffer const > acquire_vertex_buffer(std::string const &name) {
+	return acquire_shared< GLBuffer >("vertex_buffer:" + name, []() {
+		//for now, buffer will be un-filled.
+		return new GLBuffer();
+	});
+}
+
+std::shared_ptr< GLVertexArray const > acquire_PosColTex_vao(
+	std::shared_ptr< GLBuffer const > const &buffer,
+	std::shared_ptr< ColorTextureProgram const > const &program) {
+
+	std::string key = "PosColTex:" + std::to_string(buffer->buffer) + ":" + std::to_string(program->program);
+	return acquire_shared< GLVertexArray >(key, [&buffer, &program]() {
+		GLVertexArray *ret = new GLVertexArray();
+		ret->buffer = buffer;
+		ret->program = program;
+
+		//set ret->array as the current vertex array object:
+		glBindVertexArray(ret->array);
+
+		//set buffer as the source of glVertexAttribPointer() commands:
+		glBindBuffer(GL_ARRAY_BUFFER, buffer->buffer);
+
+		//vertices are (vec3 Position, u8vec4 Color, vec2 TexCoord), packed:
+		constexpr GLsizei stride = 4*3 + 1*4 + 4*2;
+
+		glVertexAttribPointer(
+			program->Position_vec4, //attribute
+			3, //size
+			GL_FLOAT, //type
+			GL_FALSE, //normalized
+			stride, //stride
+			(GLbyte *)0 + 0 //offset
+		);
+		glEnableVertexAttribArray(program->Position_vec4);
+		//[Note that it is okay to bind a vec3 input to a vec4 attribute -- the w component will be filled with 1.0 automatically]
+
+		glVertexAttribPointer(
+			program->Color_vec4, //attribute
+			4, //size
+			GL_UNSIGNED_BYTE, //type
+			GL_TRUE, //normalized
+			stride, //stride
+			(GLbyte *)0 + 4*3 //offset
+		);
+		glEnableVertexAttribArray(program->Color_vec4);
+
+		glVertexAttribPointer(
+			program->TexCoord_vec2, //attribute
+			2, //size
+			GL_FLOAT, //type
+			GL_FALSE, //normalized
+			stride, //stride
+			(GLbyte *)0 + 4*3 + 4*1 //offset
+		);
+		glEnableVertexAttribArray(program->TexCoord_vec2);
+
+		//done referring to buffer, so unbind it:
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		//done setting up vertex array object, so unbind it:
+		glBindVertexArray(0);
+
+		GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
+
+		return ret;
+	});
+}
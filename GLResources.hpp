@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * Process-wide registry of OpenGL objects that can be shared between modes.
+ *
+ * Objects are looked up by a descriptor string. The first acquire of a
+ * descriptor creates the object; later acquires return the same object.
+ * The registry only holds weak references, so an object is freed (and its
+ * entry removed) when the last mode holding it is destroyed.
+ *
+ * Since Mode::set_current() constructs the new mode before releasing the old
+ * one, switching between modes that use the same resources does no shader
+ * compiles or texture uploads.
+ *
+ */
+
+#include "GL.hpp"
+#include "ColorTextureProgram.hpp"
+#include "AssetPack.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+//Owning wrappers around single GL object names:
+struct GLBuffer {
+	GLBuffer();
+	~GLBuffer();
+	GLBuffer(GLBuffer const &) = delete;
+	GLBuffer &operator=(GLBuffer const &) = delete;
+
+	GLuint buffer = 0;
+};
+
+struct GLTexture {
+	GLTexture();
+	~GLTexture();
+	GLTexture(GLTexture const &) = delete;
+	GLTexture &operator=(GLTexture const &) = delete;
+
+	GLuint texture = 0;
+};
+
+struct GLVertexArray {
+	GLVertexArray();
+	~GLVertexArray();
+	GLVertexArray(GLVertexArray const &) = delete;
+	GLVertexArray &operator=(GLVertexArray const &) = delete;
+
+	GLuint array = 0;
+
+	//objects referenced by the vertex array's state (kept alive as long as it is):
+	std::shared_ptr< void const > buffer;
+	std::shared_ptr< void const > program;
+};
+
+//Look up 'key' in the registry, calling 'make' to create the object if it isn't there:
+std::shared_ptr< void const > acquire_shared_void(std::string const &key, std::function< std::shared_ptr< void const >() > const &make);
+
+template< typename T >
+std::shared_ptr< T const > acquire_shared(std::string const &key, std::function< T *() > const &make) {
+	//type name is part of the key, so the same descriptor can't alias different types:
+	return std::static_pointer_cast< T const >(acquire_shared_void(
+		std::string(typeid(T).name()) + ":" + key,
+		[&make]() -> std::shared_ptr< void const > {
+			return std::shared_ptr< T const >(make());
+		}
+	));
+}
+
+//Look up 'key' in the registry without creating anything; nullptr if it isn't there:
+std::shared_ptr< void const > find_shared_void(std::string const &key);
+
+template< typename T >
+std::shared_ptr< T const > find_shared(std::string const &key) {
+	return std::static_pointer_cast< T const >(find_shared_void(std::string(typeid(T).name()) + ":" + key));
+}
+
+//Counts of registry activity (useful for checking that mode switches don't re-create anything):
+struct GLResourceStats {
+	uint32_t created = 0; //acquires that had to make a new object
+	uint32_t shared = 0; //acquires that returned an existing object
+};
+extern GLResourceStats gl_resource_stats;
+
+//----- resources used by the built-in modes -----
+
+//The ColorTextureProgram shader:
+std::shared_ptr< ColorTextureProgram const > acquire_color_texture_program();
+
+//A 1x1 solid white texture:
+std::shared_ptr< GLTexture const > acquire_white_tex();
+
+//A (mipmapped) texture loaded from a PNG file; throws on error:
+// (the PNG is decoded straight into a mapped pixel unpack buffer, and the texture is uploaded from there)
+std::shared_ptr< GLTexture const > acquire_png_tex(std::string const &filename);
+
+//Textures for many PNG files at once (e.g. at startup); throws on error:
+// files whose textures aren't already in the registry are decoded in parallel (see load_png_batch), and each is uploaded as soon as it (and the ones before it) are ready.
+std::vector< std::shared_ptr< GLTexture const > > acquire_png_texs(std::vector< std::string > const &filenames);
+
+//A (mipmapped) texture from an asset pack's pre-decoded texture entry; throws on error:
+// uncompressed entries are uploaded straight from the pack's mapping, LZ4 ones are decompressed into a mapped pixel unpack buffer first.
+std::shared_ptr< GLTexture const > acquire_pack_tex(AssetPack const &pack, std::string const &name);
+
+//A buffer for streaming vertex data, shared by everything that asks for the same 'name':
+std::shared_ptr< GLBuffer const > acquire_vertex_buffer(std::string const &name);
+
+//A vertex array object mapping 'buffer' to 'program's attributes,
+// for vertices packed as (vec3 Position, u8vec4 Color, vec2 TexCoord):
+std::shared_ptr< GLVertexArray const > acquire_PosColTex_vao(
+	std::shared_ptr< GLBuffer const > const &buffer,
+	std::shared_ptr< ColorTextureProgram const > const &program
+);
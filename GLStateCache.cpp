@@ -0,0 +1,124 @@
+#include "GLStateCache.hpp"
+
+GLStateCache gl_state;
+
+//map GL capability enums to slots in GLStateCache::caps (CapCount if not tracked):
+static GLStateCache::Cap cap_index(GLenum cap) {
+	switch (cap) {
+		case GL_BLEND: return GLStateCache::Blend;
+		case GL_DEPTH_TEST: return GLStateCache::DepthTest;
+		case GL_CULL_FACE: return GLStateCache::CullFace;
+		case GL_SCISSOR_TEST: return GLStateCache::ScissorTest;
+		case GL_STENCIL_TEST: return GLStateCache::StencilTest;
+		default: return GLStateCache::CapCount;
+	}
+}
+
+GLStateCache::GLStateCache() {
+	invalidate();
+}
+
+void GLStateCache::invalidate() {
+	for (auto &c : caps) {
+		c = Maybe;
+	}
+	blend_sfactor = blend_dfactor = Unknown;
+	program = Unknown;
+	vertex_array = Unknown;
+	array_buffer = pixel_pack_buffer = pixel_unpack_buffer = Unknown;
+	active_unit = Unknown;
+	for (auto &t : texture_2d) {
+		t = Unknown;
+	}
+}
+
+bool GLStateCache::update(GLuint *shadow, GLuint value) {
+	if (*shadow == value) {
+		frame.elided += 1;
+		return false;
+	} else {
+		*shadow = value;
+		frame.issued += 1;
+		return true;
+	}
+}
+
+void GLStateCache::enable(GLenum cap) {
+	Cap idx = cap_index(cap);
+	if (idx == CapCount) {
+		pass_through();
+		glEnable(cap);
+	} else if (caps[idx] == On) {
+		frame.elided += 1;
+	} else {
+		caps[idx] = On;
+		frame.issued += 1;
+		glEnable(cap);
+	}
+}
+
+void GLStateCache::disable(GLenum cap) {
+	Cap idx = cap_index(cap);
+	if (idx == CapCount) {
+		pass_through();
+		glDisable(cap);
+	} else if (caps[idx] == Off) {
+		frame.elided += 1;
+	} else {
+		caps[idx] = Off;
+		frame.issued += 1;
+		glDisable(cap);
+	}
+}
+
+void GLStateCache::blend_func(GLenum sfactor, GLenum dfactor) {
+	if (blend_sfactor == sfactor && blend_dfactor == dfactor) {
+		frame.elided += 1;
+	} else {
+		blend_sfactor = sfactor;
+		blend_dfactor = dfactor;
+		frame.issued += 1;
+		glBlendFunc(sfactor, dfactor);
+	}
+}
+
+void GLStateCache::use_program(GLuint program_) {
+	if (update(&program, program_)) glUseProgram(program_);
+}
+
+void GLStateCache::bind_vertex_array(GLuint array_) {
+	if (update(&vertex_array, array_)) glBindVertexArray(array_);
+}
+
+void GLStateCache::bind_buffer(GLenum target, GLuint buffer) {
+	GLuint *shadow = nullptr;
+	if (target == GL_ARRAY_BUFFER) shadow = &array_buffer;
+	else if (target == GL_PIXEL_PACK_BUFFER) shadow = &pixel_pack_buffer;
+	else if (target == GL_PIXEL_UNPACK_BUFFER) shadow = &pixel_unpack_buffer;
+
+	if (!shadow) {
+		pass_through();
+		glBindBuffer(target, buffer);
+	} else if (update(shadow, buffer)) {
+		glBindBuffer(target, buffer);
+	}
+}
+
+void GLStateCache::active_texture(GLenum unit) {
+	if (update(&active_unit, unit)) glActiveTexture(unit);
+}
+
+void GLStateCache::bind_texture(GLenum target, GLuint texture) {
+	//only GL_TEXTURE_2D on a known, low-numbered unit is tracked:
+	if (target == GL_TEXTURE_2D && active_unit != Unknown && active_unit - GL_TEXTURE0 < MaxUnits) {
+		if (update(&texture_2d[active_unit - GL_TEXTURE0], texture)) glBindTexture(target, texture);
+	} else {
+		pass_through();
+		glBindTexture(target, texture);
+	}
+}
+
+void GLStateCache::end_frame() {
+	last_frame = frame;
+	frame = Counts();
+}
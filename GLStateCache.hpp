@@ -0,0 +1,77 @@
+#pragma once
+
+/*
+ * GLStateCache shadows a small amount of OpenGL binding/enable state
+ *  and skips calls that wouldn't change anything.
+ *
+ * Code that changes tracked state with direct gl* calls must call
+ *  gl_state.invalidate() afterward, so the shadow copy doesn't go stale.
+ *  (GLResources does this whenever it creates or deletes an object, and
+ *   Mode::set_current does it on every mode switch.)
+ *
+ */
+
+#include "GL.hpp"
+
+#include <cstdint>
+
+struct GLStateCache {
+	GLStateCache();
+
+	//glEnable / glDisable (tracked for GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST):
+	void enable(GLenum cap);
+	void disable(GLenum cap);
+
+	void blend_func(GLenum sfactor, GLenum dfactor);
+	void use_program(GLuint program);
+	void bind_vertex_array(GLuint array);
+
+	//glBindBuffer (tracked for GL_ARRAY_BUFFER, GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER):
+	// (GL_ELEMENT_ARRAY_BUFFER is part of vertex array state, so it is always passed through)
+	void bind_buffer(GLenum target, GLuint buffer);
+
+	void active_texture(GLenum unit);
+	//glBindTexture on the active unit (tracked for GL_TEXTURE_2D on the first MaxUnits units):
+	void bind_texture(GLenum target, GLuint texture);
+
+	//forget all shadowed state (next call of each kind will always be issued):
+	void invalidate();
+
+	//call counts (tracked functions only):
+	struct Counts {
+		uint32_t issued = 0; //calls passed through to GL
+		uint32_t elided = 0; //calls skipped as redundant
+	};
+	Counts frame; //counts so far this frame
+	Counts last_frame; //counts for the previous frame
+	//move 'frame' to 'last_frame' and start counting again:
+	void end_frame();
+
+	//----- shadowed state -----
+	//(Unknown is used for values that must be re-issued)
+	static constexpr GLuint Unknown = -1U;
+	static constexpr uint32_t MaxUnits = 8;
+
+	enum Cap : uint32_t { Blend, DepthTest, CullFace, ScissorTest, StencilTest, CapCount };
+	enum Tristate : uint8_t { Off, On, Maybe };
+	Tristate caps[CapCount];
+
+	GLenum blend_sfactor = Unknown;
+	GLenum blend_dfactor = Unknown;
+	GLuint program = Unknown;
+	GLuint vertex_array = Unknown;
+	GLuint array_buffer = Unknown;
+	GLuint pixel_pack_buffer = Unknown;
+	GLuint pixel_unpack_buffer = Unknown;
+	GLenum active_unit = Unknown;
+	GLuint texture_2d[MaxUnits];
+
+private:
+	//returns true (and counts an issued call) if 'shadow' needs to change to 'value'; otherwise counts an elided call:
+	bool update(GLuint *shadow, GLuint value);
+	//for calls that aren't tracked:
+	void pass_through() { frame.issued += 1; }
+};
+
+//There is only one GL context, so there is only one cache:
+extern GLStateCache gl_state;
@@ -0,0 +1,119 @@
+#include "GLTimer.hpp"
+
+#include "gl_errors.hpp"
+
+#include <algorithm>
+
+GLTimer::GLTimer(uint32_t latency) : sets(std::max(2u, latency)) {
+	for (QuerySet &set : sets) {
+		glGenQueries(FrameTiming::GPUPassCount, set.elapsed);
+		glGenQueries(1, &set.start);
+		glGenQueries(1, &set.finish);
+	}
+	GL_ERRORS();
+}
+
+GLTimer::~GLTimer() {
+	for (QuerySet &set : sets) {
+		glDeleteQueries(FrameTiming::GPUPassCount, set.elapsed);
+		glDeleteQueries(1, &set.start);
+		glDeleteQueries(1, &set.finish);
+	}
+}
+
+void GLTimer::poll(FrameTiming *timing) {
+	auto available = [](GLuint query) {
+		GLuint ready = GL_FALSE;
+		glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &ready);
+		return ready != GL_FALSE;
+	};
+	auto result_ms = [](GLuint query) {
+		GLuint64 ns = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+		return float(ns / 1.0e6);
+	};
+
+	//read sets oldest first, stopping at the first that isn't finished (later ones won't be either):
+	while (true) {
+		QuerySet *oldest = nullptr;
+		for (QuerySet &set : sets) {
+			if (set.pending && (!oldest || set.frame < oldest->frame)) oldest = &set;
+		}
+		if (!oldest) break;
+
+		//(the finishing timestamp was issued last, but check everything rather than rely on queries finishing in order)
+		bool ready = available(oldest->finish) && available(oldest->start);
+		for (uint32_t p = 0; p < FrameTiming::GPUPassCount; ++p) {
+			if (oldest->used[p]) ready = ready && available(oldest->elapsed[p]);
+		}
+		if (!ready) break;
+
+		float ms[FrameTiming::GPUPassCount] = { };
+		for (uint32_t p = 0; p < FrameTiming::GPUPassCount; ++p) {
+			if (oldest->used[p]) ms[p] = result_ms(oldest->elapsed[p]);
+		}
+		GLuint64 start = 0, finish = 0;
+		glGetQueryObjectui64v(oldest->start, GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(oldest->finish, GL_QUERY_RESULT, &finish);
+		float total_ms = float((finish > start ? finish - start : 0) / 1.0e6);
+
+		//every pass happens between the timestamps, so a longer pass means a bad result
+		// (e.g. llvmpipe gives the very first elapsed query a start time of zero):
+		bool plausible = true;
+		for (uint32_t p = 0; p < FrameTiming::GPUPassCount; ++p) {
+			if (ms[p] > total_ms + 1.0f) plausible = false;
+		}
+
+		if (plausible) {
+			if (timing) timing->set_gpu(oldest->frame, ms, total_ms);
+			timed += 1;
+		} else {
+			discarded += 1;
+		}
+		oldest->pending = false;
+	}
+	GL_ERRORS();
+}
+
+void GLTimer::begin_frame(uint64_t frame) {
+	current = nullptr;
+	active = -1;
+	for (QuerySet &set : sets) {
+		if (!set.pending) {
+			current = &set;
+			break;
+		}
+	}
+	if (!current) {
+		skipped += 1;
+		return;
+	}
+	current->frame = frame;
+	current->pending = true;
+	for (uint32_t p = 0; p < FrameTiming::GPUPassCount; ++p) {
+		current->used[p] = false;
+	}
+	glQueryCounter(current->start, GL_TIMESTAMP);
+}
+
+void GLTimer::end_frame() {
+	if (!current) return;
+	if (active >= 0) end(FrameTiming::GPUPass(active));
+	glQueryCounter(current->finish, GL_TIMESTAMP);
+	current = nullptr;
+}
+
+void GLTimer::begin(FrameTiming::GPUPass pass) {
+	if (!current || active >= 0) return;
+	//(a pass that runs more than once a frame only keeps its first run)
+	if (current->used[pass]) return;
+	glBeginQuery(GL_TIME_ELAPSED, current->elapsed[pass]);
+	current->used[pass] = true;
+	active = int32_t(pass);
+}
+
+void GLTimer::end(FrameTiming::GPUPass pass) {
+	if (!current || active != int32_t(pass)) return;
+	glEndQuery(GL_TIME_ELAPSED);
+	active = -1;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+ * GLTimer measures how long the GPU spends on each pass of a frame (see
+ *  FrameTiming::GPUPass) with GL_TIME_ELAPSED queries, and on the whole frame
+ *  with a pair of GL_TIMESTAMP queries, without ever waiting for results:
+ *  each frame's queries go into one of 'latency' sets (triple-buffered by
+ *  default), and results are only read once the GPU says they're available,
+ *  a frame or two later. If every set is still in flight, the frame just
+ *  isn't timed.
+ *
+ * Results are handed to FrameTiming::set_gpu, so they show up in the same
+ *  report as the CPU phases.
+ *
+ * Elapsed-time queries can't nest, so passes must not overlap.
+ *
+ * Renderers that defer rasterization until a flush (e.g. Mesa's llvmpipe)
+ *  report passes as taking almost no time, since the queries only see
+ *  commands being queued; the numbers mean more on real GPUs.
+ *
+ */
+
+#include "GL.hpp"
+#include "FrameTiming.hpp"
+
+#include <vector>
+
+struct GLTimer {
+	//needs a current GL context (3.3 core has timer queries); 'latency' is how many frames of queries can be in flight:
+	GLTimer(uint32_t latency = 3);
+	~GLTimer();
+	GLTimer(GLTimer const &) = delete;
+	GLTimer &operator=(GLTimer const &) = delete;
+
+	//hand any finished results to 'timing' (call once per frame, before begin_frame):
+	void poll(FrameTiming *timing);
+
+	//bracket the frame's GL work ('frame' is FrameTiming::frames, i.e. the number of the frame being drawn):
+	void begin_frame(uint64_t frame);
+	void end_frame();
+
+	//bracket one pass (does nothing outside begin_frame/end_frame, or if this frame isn't being timed):
+	void begin(FrameTiming::GPUPass pass);
+	void end(FrameTiming::GPUPass pass);
+
+	uint64_t timed = 0; //frames whose results came back
+	uint64_t skipped = 0; //frames not timed because every query set was still in flight
+	uint64_t discarded = 0; //frames whose results were impossible (a pass longer than the whole frame)
+
+private:
+	struct QuerySet {
+		GLuint elapsed[FrameTiming::GPUPassCount] = { };
+		bool used[FrameTiming::GPUPassCount] = { };
+		GLuint start = 0, finish = 0; //(timestamps)
+		uint64_t frame = 0;
+		bool pending = false; //(issued, results not read yet)
+	};
+	std::vector< QuerySet > sets;
+	QuerySet *current = nullptr; //(set being issued this frame, if any)
+	int32_t active = -1; //(pass whose elapsed query is running, if any)
+};
+
+//GLTimerScope brackets a pass for the rest of the enclosing block (does nothing if 'timer' is null):
+struct GLTimerScope {
+	GLTimerScope(GLTimer *timer_, FrameTiming::GPUPass pass_) : timer(timer_), pass(pass_) {
+		if (timer) timer->begin(pass);
+	}
+	~GLTimerScope() {
+		if (timer) timer->end(pass);
+	}
+	GLTimerScope(GLTimerScope const &) = delete;
+	GLTimerScope &operator=(GLTimerScope const &) = delete;
+	GLTimer *timer;
+	FrameTiming::GPUPass pass;
+};
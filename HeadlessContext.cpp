@@ -0,0 +1,277 @@
+#include "HeadlessContext.hpp"
+
+#include "gl_errors.hpp"
+
+#include <initializer_list>
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+
+#include <dlfcn.h>
+
+//EGL's headers aren't installed alongside libGL's everywhere, so the bits used are declared here (from EGL/egl.h and EGL/eglext.h):
+typedef int32_t EGLint;
+typedef unsigned int EGLBoolean;
+typedef unsigned int EGLenum;
+typedef void *EGLDisplay;
+typedef void *EGLConfig;
+typedef void *EGLSurface;
+typedef void *EGLContext;
+static EGLDisplay const EGL_NO_DISPLAY = nullptr;
+static EGLSurface const EGL_NO_SURFACE = nullptr;
+static EGLContext const EGL_NO_CONTEXT = nullptr;
+static void *const EGL_DEFAULT_DISPLAY = nullptr;
+static constexpr EGLint EGL_TRUE = 1;
+static constexpr EGLint EGL_DONT_CARE = -1;
+static constexpr EGLint EGL_NONE = 0x3038;
+static constexpr EGLint EGL_SURFACE_TYPE = 0x3033;
+static constexpr EGLint EGL_EXTENSIONS = 0x3055;
+static constexpr EGLint EGL_RENDERABLE_TYPE = 0x3040;
+static constexpr EGLint EGL_OPENGL_BIT = 0x0008;
+static constexpr EGLenum EGL_OPENGL_API = 0x30A2;
+static constexpr EGLint EGL_CONTEXT_MAJOR_VERSION_KHR = 0x3098;
+static constexpr EGLint EGL_CONTEXT_MINOR_VERSION_KHR = 0x30FB;
+static constexpr EGLint EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR = 0x30FD;
+static constexpr EGLint EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR = 0x0001;
+static constexpr EGLint EGL_CONTEXT_OPENGL_DEBUG = 0x31B0;
+static constexpr EGLenum EGL_PLATFORM_SURFACELESS_MESA = 0x31DD;
+
+//The handful of EGL functions used below (looked up at runtime):
+static struct {
+	char const *(*QueryString)(EGLDisplay dpy, EGLint name) = nullptr;
+	void *(*GetProcAddress)(char const *procname) = nullptr;
+	EGLDisplay (*GetDisplay)(void *display_id) = nullptr;
+	EGLBoolean (*Initialize)(EGLDisplay dpy, EGLint *major, EGLint *minor) = nullptr;
+	EGLBoolean (*Terminate)(EGLDisplay dpy) = nullptr;
+	EGLBoolean (*BindAPI)(EGLenum api) = nullptr;
+	EGLBoolean (*ChooseConfig)(EGLDisplay dpy, EGLint const *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config) = nullptr;
+	EGLContext (*CreateContext)(EGLDisplay dpy, EGLConfig config, EGLContext share_context, EGLint const *attrib_list) = nullptr;
+	EGLBoolean (*DestroyContext)(EGLDisplay dpy, EGLContext ctx) = nullptr;
+	EGLBoolean (*MakeCurrent)(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx) = nullptr;
+} egl;
+typedef EGLDisplay (*PFNEGLGETPLATFORMDISPLAYEXTPROC)(EGLenum platform, void *native_display, EGLint const *attrib_list);
+
+//OSMesa has no header in most distributions' default packages, so the bits used are declared here (from GL/osmesa.h):
+typedef void *OSMesaContext;
+static constexpr int OSMESA_FORMAT = 0x22;
+static constexpr int OSMESA_DEPTH_BITS = 0x30;
+static constexpr int OSMESA_STENCIL_BITS = 0x31;
+static constexpr int OSMESA_PROFILE = 0x33;
+static constexpr int OSMESA_CORE_PROFILE = 0x34;
+static constexpr int OSMESA_CONTEXT_MAJOR_VERSION = 0x36;
+static constexpr int OSMESA_CONTEXT_MINOR_VERSION = 0x37;
+
+static struct {
+	OSMesaContext (*CreateContextAttribs)(int const *attribList, OSMesaContext sharelist) = nullptr;
+	GLboolean (*MakeCurrent)(OSMesaContext ctx, void *buffer, GLenum type, GLsizei width, GLsizei height) = nullptr;
+	void (*DestroyContext)(OSMesaContext ctx) = nullptr;
+} osmesa;
+
+//open the first of 'filenames' that exists (libraries stay open for the life of the program):
+static void *open_library(std::initializer_list< char const * > filenames) {
+	for (char const *filename : filenames) {
+		if (void *handle = dlopen(filename, RTLD_LAZY | RTLD_LOCAL)) return handle;
+	}
+	return nullptr;
+}
+
+template< typename T >
+static void load(void *library, T *fn, char const *name) {
+	*fn = reinterpret_cast< T >(dlsym(library, name));
+	if (!*fn) throw std::runtime_error(std::string("Headless: missing ") + name + ".");
+}
+
+static bool has_extension(char const *extensions, std::string const &name) {
+	if (!extensions) return false;
+	std::string list = std::string(" ") + extensions + " ";
+	return list.find(" " + name + " ") != std::string::npos;
+}
+
+HeadlessContext::HeadlessContext(glm::uvec2 const &size_, GLLoaderBackend backend_) : size(size_), backend(backend_) {
+	if (backend == GLLoaderAuto) backend = GLLoaderEGL;
+
+	if (backend == GLLoaderEGL) {
+		static void *library = open_library({ "libEGL.so.1", "libEGL.so" });
+		if (!library) throw std::runtime_error("Headless: couldn't load libEGL.");
+		load(library, &egl.QueryString, "eglQueryString");
+		load(library, &egl.GetProcAddress, "eglGetProcAddress");
+		load(library, &egl.GetDisplay, "eglGetDisplay");
+		load(library, &egl.Initialize, "eglInitialize");
+		load(library, &egl.Terminate, "eglTerminate");
+		load(library, &egl.BindAPI, "eglBindAPI");
+		load(library, &egl.ChooseConfig, "eglChooseConfig");
+		load(library, &egl.CreateContext, "eglCreateContext");
+		load(library, &egl.DestroyContext, "eglDestroyContext");
+		load(library, &egl.MakeCurrent, "eglMakeCurrent");
+
+		//prefer Mesa's surfaceless platform, which needs no display server (or GPU) at all:
+		EGLDisplay egl_display = EGL_NO_DISPLAY;
+		char const *client_extensions = egl.QueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		if (has_extension(client_extensions, "EGL_MESA_platform_surfaceless")) {
+			auto GetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)egl.GetProcAddress("eglGetPlatformDisplayEXT");
+			if (GetPlatformDisplayEXT) {
+				egl_display = GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			}
+		}
+		if (egl_display == EGL_NO_DISPLAY) {
+			egl_display = egl.GetDisplay(EGL_DEFAULT_DISPLAY);
+		}
+		if (egl_display == EGL_NO_DISPLAY || !egl.Initialize(egl_display, nullptr, nullptr)) {
+			throw std::runtime_error("Headless: failed to initialize an EGL display.");
+		}
+		display = egl_display;
+
+		char const *extensions = egl.QueryString(egl_display, EGL_EXTENSIONS);
+		if (!has_extension(extensions, "EGL_KHR_surfaceless_context")) {
+			egl.Terminate(egl_display);
+			throw std::runtime_error("Headless: EGL display doesn't support EGL_KHR_surfaceless_context.");
+		}
+
+		EGLint const config_attribs[] = {
+			EGL_SURFACE_TYPE, EGL_DONT_CARE,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_NONE
+		};
+		EGLConfig config;
+		EGLint configs = 0;
+		if (!egl.BindAPI(EGL_OPENGL_API) || !egl.ChooseConfig(egl_display, config_attribs, &config, 1, &configs) || configs == 0) {
+			egl.Terminate(egl_display);
+			throw std::runtime_error("Headless: no EGL config supports desktop OpenGL.");
+		}
+
+		//same version, profile, and debug flag as the windowed context:
+		EGLint const context_attribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+			EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+			EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+			EGL_NONE
+		};
+		EGLContext egl_context = egl.CreateContext(egl_display, config, EGL_NO_CONTEXT, context_attribs);
+		if (egl_context == EGL_NO_CONTEXT) {
+			//(EGL_CONTEXT_OPENGL_DEBUG is new in EGL 1.5, so try again without it)
+			EGLint const plain_attribs[] = {
+				EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+				EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+				EGL_NONE
+			};
+			egl_context = egl.CreateContext(egl_display, config, EGL_NO_CONTEXT, plain_attribs);
+		}
+		if (egl_context == EGL_NO_CONTEXT || !egl.MakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl_context)) {
+			if (egl_context != EGL_NO_CONTEXT) egl.DestroyContext(egl_display, egl_context);
+			egl.Terminate(egl_display);
+			throw std::runtime_error("Headless: failed to create an OpenGL 3.3 core context.");
+		}
+		context = egl_context;
+	} else if (backend == GLLoaderOSMesa) {
+		static void *library = open_library({ "libOSMesa.so.8", "libOSMesa.so.6", "libOSMesa.so" });
+		if (!library) throw std::runtime_error("Headless: couldn't load libOSMesa.");
+		load(library, &osmesa.CreateContextAttribs, "OSMesaCreateContextAttribs");
+		load(library, &osmesa.MakeCurrent, "OSMesaMakeCurrent");
+		load(library, &osmesa.DestroyContext, "OSMesaDestroyContext");
+
+		int const attribs[] = {
+			OSMESA_FORMAT, GL_RGBA,
+			OSMESA_DEPTH_BITS, 24,
+			OSMESA_STENCIL_BITS, 8,
+			OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+			OSMESA_CONTEXT_MAJOR_VERSION, 3,
+			OSMESA_CONTEXT_MINOR_VERSION, 3,
+			0
+		};
+		OSMesaContext osmesa_context = osmesa.CreateContextAttribs(attribs, nullptr);
+		osmesa_buffer.resize(size.x * size.y);
+		if (!osmesa_context || !osmesa.MakeCurrent(osmesa_context, osmesa_buffer.data(), GL_UNSIGNED_BYTE, size.x, size.y)) {
+			if (osmesa_context) osmesa.DestroyContext(osmesa_context);
+			throw std::runtime_error("Headless: failed to create an OpenGL 3.3 core OSMesa context.");
+		}
+		context = osmesa_context;
+	} else {
+		throw std::runtime_error("Headless: contexts can only be created with EGL or OSMesa.");
+	}
+
+	//from here on the destructor won't run if something throws, so clean up here:
+	try {
+		init_GL(backend);
+		make_framebuffer();
+	} catch (...) {
+		destroy();
+		throw;
+	}
+}
+
+void HeadlessContext::make_framebuffer() {
+	//with no surface, there is no default framebuffer, so make one (after init_GL, which loads the entry points):
+	glGenRenderbuffers(1, &color_renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, color_renderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+
+	glGenRenderbuffers(1, &depth_stencil_renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil_renderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, size.x, size.y);
+
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_renderbuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_stencil_renderbuffer);
+
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("Headless: framebuffer is incomplete (status " + std::to_string(status) + ").");
+	}
+
+	//framebuffer stays bound, so everything drawn ends up in it:
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	glViewport(0, 0, size.x, size.y);
+
+	GL_ERRORS();
+}
+
+HeadlessContext::~HeadlessContext() {
+	destroy();
+}
+
+void HeadlessContext::destroy() {
+	if (context) {
+		//(names are only made once init_GL has succeeded)
+		if (framebuffer) glDeleteFramebuffers(1, &framebuffer);
+		if (depth_stencil_renderbuffer) glDeleteRenderbuffers(1, &depth_stencil_renderbuffer);
+		if (color_renderbuffer) glDeleteRenderbuffers(1, &color_renderbuffer);
+		framebuffer = depth_stencil_renderbuffer = color_renderbuffer = 0;
+
+		if (backend == GLLoaderEGL) {
+			egl.MakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			egl.DestroyContext(display, context);
+		} else {
+			osmesa.DestroyContext(context);
+		}
+		context = nullptr;
+	}
+	if (display) {
+		egl.Terminate(display);
+		display = nullptr;
+	}
+}
+
+#else //__linux__
+
+HeadlessContext::HeadlessContext(glm::uvec2 const &size_, GLLoaderBackend backend_) : size(size_), backend(backend_) {
+	throw std::runtime_error("Headless rendering is only supported on Linux (via EGL or OSMesa).");
+}
+
+HeadlessContext::~HeadlessContext() {
+}
+
+#endif //__linux__
+
+void HeadlessContext::read_pixels(std::vector< glm::u8vec4 > *data) const {
+	data->resize(size.x * size.y);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, data->data());
+}
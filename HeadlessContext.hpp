@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+ * HeadlessContext creates an OpenGL 3.3 core context with no window
+ *  (EGL on a surfaceless display, e.g. Mesa's llvmpipe on a machine with no
+ *  display or GPU; or OSMesa) and a framebuffer object to draw into, so frames
+ *  can be rendered and read back into memory.
+ *
+ * The EGL or OSMesa library is loaded at runtime, and init_GL() is called
+ *  with the matching loader backend.
+ *
+ * Currently only available on Linux; the constructor throws elsewhere, or if
+ *  no suitable display/context can be created.
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+struct HeadlessContext {
+	//'backend' may be GLLoaderEGL or GLLoaderOSMesa (GLLoaderAuto means EGL):
+	HeadlessContext(glm::uvec2 const &size, GLLoaderBackend backend = GLLoaderAuto);
+	~HeadlessContext();
+	HeadlessContext(HeadlessContext const &) = delete;
+	HeadlessContext &operator=(HeadlessContext const &) = delete;
+
+	glm::uvec2 size;
+
+	//the framebuffer (RGBA8 color, 24-bit depth + 8-bit stencil) bound for drawing after construction:
+	GLuint framebuffer = 0;
+	GLuint color_renderbuffer = 0;
+	GLuint depth_stencil_renderbuffer = 0;
+
+	//read the framebuffer's color into 'data' (resized to size.x * size.y, lower-left origin):
+	void read_pixels(std::vector< glm::u8vec4 > *data) const;
+
+private:
+	GLLoaderBackend backend;
+	//(EGL/OSMesa handles, kept opaque so their headers don't leak into every file)
+	void *display = nullptr;
+	void *context = nullptr;
+	std::vector< glm::u8vec4 > osmesa_buffer; //(OSMesa always needs somewhere to draw, even if nothing ends up there)
+	void make_framebuffer();
+	void destroy(); //(also used if the constructor fails after creating the context)
+};
@@ -0,0 +1,187 @@
+#include "HitchDetector.hpp"
+
+#include "Mode.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+HitchDetector::HitchDetector(float budget_ms_, std::string const &directory_) : budget_ms(budget_ms_), directory(directory_) {
+	allocations.fill(0);
+	last_counts = allocation_counts();
+
+	worker = std::thread([this]() {
+		trace_thread_name("hitch dump writer");
+		std::unique_lock< std::mutex > lock(mutex);
+		while (true) {
+			cv.wait(lock, [this]() { return quit || !jobs.empty(); });
+			if (jobs.empty()) return; //(quit, and nothing left to do)
+			std::unique_ptr< Job > job = std::move(jobs.front());
+			jobs.pop_front();
+			writing = true;
+			lock.unlock();
+			write(*job);
+			lock.lock();
+			writing = false;
+			cv.notify_all();
+		}
+	});
+}
+
+HitchDetector::~HitchDetector() {
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	cv.notify_all();
+	worker.join();
+}
+
+void HitchDetector::check(FrameTiming const &timing, Mode const *mode) {
+	if (timing.frames == checked) return;
+	checked = timing.frames;
+
+	//the allocations since the last check belong (nearly all) to the frame that just finished:
+	AllocationCounts counts = allocation_counts();
+	allocations[(timing.frames - 1) % FrameTiming::Capacity] = uint32_t(counts.allocations - last_counts.allocations);
+	last_counts = counts;
+
+	if (timing.frames <= warmup_frames) return;
+	if (timing.recent(0).total_ms <= budget_ms) return;
+
+	hitches += 1;
+	auto now = FrameTiming::Clock::now();
+	if (dumped && std::chrono::duration< float >(now - last_dump).count() < cooldown) return;
+
+	//copy what the dump needs (the worker formats and writes it):
+	std::unique_ptr< Job > job(new Job());
+	job->frame = timing.frames - 1;
+	job->time = std::time(nullptr);
+	job->hitches = hitches;
+	job->dumps = dumps_started;
+	job->timing = timing;
+	job->allocations = allocations;
+	job->counts = allocation_counts();
+	if (mode) {
+		std::ostringstream state;
+		mode->describe(state);
+		job->mode_state = state.str();
+		job->has_mode = true;
+	}
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		jobs.emplace_back(std::move(job));
+	}
+	cv.notify_all();
+	dumps_started += 1;
+
+	last_dump = now;
+	dumped = true;
+}
+
+void HitchDetector::write(Job const &job) {
+	uint64_t frame = job.frame;
+	FrameTiming const &timing = job.timing;
+	FrameTiming::Frame const &hitch = timing.recent(0);
+
+	//local date and time, for the filename and the header:
+	std::tm local;
+#ifdef _WIN32
+	localtime_s(&local, &job.time);
+#else
+	localtime_r(&job.time, &local);
+#endif
+	char stamp[32];
+	std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+	char when[32];
+	std::strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", &local);
+
+	std::string filename = directory + "/hitch-" + stamp + "-frame" + std::to_string(frame) + ".txt";
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) {
+		std::unique_lock< std::mutex > lock(mutex);
+		if (!warned) {
+			std::cerr << "WARNING: failed to open '" << filename << "' to write a hitch dump (further failures won't be reported)." << std::endl;
+			warned = true;
+		}
+		return;
+	}
+
+	char line[160];
+	out << "Hitch: frame " << frame << " took " << hitch.total_ms << " ms (budget " << budget_ms << " ms), at " << when << ".\n";
+	out << "(" << (job.hitches - 1) << " earlier hitches, " << job.dumps << " earlier dumps this run.)\n\n";
+
+	//frames back to 'history_ms' before the hitch, oldest first:
+	uint32_t count = 0;
+	float history = 0.0f;
+	while (count < timing.frames_kept() && history < history_ms) {
+		history += timing.recent(count).total_ms;
+		count += 1;
+	}
+	out << "Last " << count << " frames (ms), oldest first:\n";
+	std::snprintf(line, sizeof(line), "  %10s", "frame");
+	out << line;
+	for (uint32_t p = 0; p < FrameTiming::PhaseCount; ++p) {
+		std::snprintf(line, sizeof(line), " %8s", FrameTiming::phase_name(FrameTiming::Phase(p)));
+		out << line;
+	}
+	std::snprintf(line, sizeof(line), " %8s %7s %8s\n", "total", "allocs", "input");
+	out << line;
+	for (uint32_t back = count; back > 0; --back) {
+		FrameTiming::Frame const &f = timing.recent(back - 1);
+		uint64_t number = frame - (back - 1);
+		std::snprintf(line, sizeof(line), "  %10llu", (unsigned long long)number);
+		out << line;
+		for (uint32_t p = 0; p < FrameTiming::PhaseCount; ++p) {
+			std::snprintf(line, sizeof(line), " %8.3f", f.ms[p]);
+			out << line;
+		}
+		//(input column: longest input-to-present latency of the inputs presented that frame)
+		if (f.inputs != 0) {
+			std::snprintf(line, sizeof(line), " %8.3f %7u %8.3f%s\n", f.total_ms, job.allocations[number % FrameTiming::Capacity], f.input_ms,
+				(f.total_ms > budget_ms ? "  <- over budget" : ""));
+		} else {
+			std::snprintf(line, sizeof(line), " %8.3f %7u %8s%s\n", f.total_ms, job.allocations[number % FrameTiming::Capacity], "-",
+				(f.total_ms > budget_ms ? "  <- over budget" : ""));
+		}
+		out << line;
+	}
+	out << "\n";
+	timing.report(out);
+	out << "\n";
+
+	AllocationCounts const &counts = job.counts;
+	out << "Allocations: " << counts.allocations << " so far (" << counts.bytes << " bytes), "
+	    << (counts.allocations - counts.frees) << " still live.\n";
+	if (counts.allocations == 0) {
+		out << "(allocation_counts.cpp isn't linked in, so allocations aren't being counted)\n";
+	}
+	out << "\n";
+
+	out << "Mode state:\n";
+	if (job.has_mode) {
+		out << job.mode_state;
+	} else {
+		out << "(no mode)\n";
+	}
+
+	if (!out) {
+		std::cerr << "WARNING: error writing hitch dump '" << filename << "'." << std::endl;
+		return;
+	}
+	std::unique_lock< std::mutex > lock(mutex);
+	dumps += 1;
+	std::cout << "Hitch: frame " << frame << " took " << hitch.total_ms << " ms; wrote '" << filename << "'." << std::endl;
+}
+
+void HitchDetector::report(std::ostream &out) const {
+	std::unique_lock< std::mutex > lock(mutex);
+	cv.wait(lock, [this]() { return jobs.empty() && !writing; });
+	out << "Hitches: " << hitches << " frames over " << budget_ms << " ms (after the first " << warmup_frames << "), "
+	    << dumps << " dumps written to '" << directory << "'." << std::endl;
+}
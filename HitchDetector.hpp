@@ -0,0 +1,93 @@
+#pragma once
+
+/*
+ * HitchDetector watches the frame times FrameTiming records and, when a
+ *  frame takes longer than its budget (by default two refresh intervals),
+ *  writes a diagnostic dump to a timestamped file:
+ *   - the hitch (which frame, how long, when),
+ *   - the last few seconds of per-phase frame times, with each frame's
+ *     allocation count (see allocation_counts.hpp),
+ *   - allocation totals, and
+ *   - the current mode's state (see Mode::describe).
+ *
+ * The frame that notices a hitch only copies what the dump needs (the ring
+ *  of frame times, the allocation counts, and the mode's description); the
+ *  file is formatted and written on a worker thread, so writing it doesn't
+ *  lengthen the frames that follow.
+ *
+ * Hitches tend to come in clusters, so after a dump the detector waits
+ *  'cooldown' seconds before the next one (hitches in between are still counted).
+ *
+ */
+
+#include "FrameTiming.hpp"
+#include "allocation_counts.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+struct Mode;
+
+struct HitchDetector {
+	//dumps go to files named <directory>/hitch-<date>-<time>-frame<number>.txt:
+	HitchDetector(float budget_ms, std::string const &directory);
+	//(waits for dumps still being written)
+	~HitchDetector();
+	HitchDetector(HitchDetector const &) = delete;
+	HitchDetector &operator=(HitchDetector const &) = delete;
+
+	//call once per frame, right after timing.begin_frame() (so the frame that just finished is in the ring):
+	// 'mode' (if not null) is asked to describe its state in any dump.
+	void check(FrameTiming const &timing, Mode const *mode);
+
+	//print hitches seen and dumps written (waiting for any still being written):
+	void report(std::ostream &out) const;
+
+	float budget_ms;
+	std::string directory;
+	float cooldown = 5.0f; //seconds between dumps
+	float history_ms = 3000.0f; //how much frame time history each dump includes
+	uint32_t warmup_frames = 3; //(the first frames include startup work, so aren't checked)
+
+	uint64_t hitches = 0; //frames over budget so far
+	uint64_t dumps_started = 0; //dumps handed to the worker so far (see report() for how many were written)
+
+private:
+	//allocations during each frame in timing's ring (indexed the same way):
+	std::array< uint32_t, FrameTiming::Capacity > allocations;
+	AllocationCounts last_counts;
+	uint64_t checked = 0; //timing.frames as of the last check
+	FrameTiming::Clock::time_point last_dump;
+	bool dumped = false;
+
+	//everything a dump needs, copied on the frame that noticed the hitch:
+	struct Job {
+		uint64_t frame = 0;
+		std::time_t time = 0; //(when the hitch was noticed)
+		uint64_t hitches = 0; //(including this one)
+		uint64_t dumps = 0; //(earlier ones)
+		FrameTiming timing;
+		std::array< uint32_t, FrameTiming::Capacity > allocations;
+		AllocationCounts counts;
+		std::string mode_state; //(empty if there was no mode)
+		bool has_mode = false;
+	};
+	void write(Job const &job);
+
+	//worker thread state:
+	mutable std::mutex mutex;
+	mutable std::condition_variable cv;
+	std::deque< std::unique_ptr< Job > > jobs;
+	bool writing = false; //(worker has a job out of 'jobs')
+	bool quit = false;
+	uint64_t dumps = 0; //dumps written so far
+	bool warned = false; //(about a dump that couldn't be written)
+	std::thread worker;
+};
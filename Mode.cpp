@@ -1,8 +1,20 @@
 #include "Mode.hpp"
 
+#include "GLStateCache.hpp"
+
 std::shared_ptr< Mode > Mode::current;
+bool Mode::gl_enabled = true;
+thread_local SoftwareRasterizer *Mode::software_rasterizer = nullptr;
+FrameTiming const *Mode::frame_timing = nullptr;
+GLTimer *Mode::gl_timer = nullptr;
+bool Mode::late_latch = false;
+bool Mode::late_latched = false;
 
 void Mode::set_current(std::shared_ptr< Mode > const &new_current) {
+	//NOTE: new_current is constructed before the old mode is released here,
+	// so GL objects they both acquire from GLResources are reused rather than re-created.
 	current = new_current;
+	//modes may leave arbitrary GL state behind, so don't trust the cache across a switch:
+	gl_state.invalidate();
 	//NOTE: may wish to, e.g., trigger resize events on new current mode.
 }
@@ -3,8 +3,13 @@
 #include <SDL.h>
 #include <glm/glm.hpp>
 
+#include <iosfwd>
 #include <memory>
 
+struct SoftwareRasterizer;
+struct FrameTiming;
+struct GLTimer;
+
 struct Mode : std::enable_shared_from_this< Mode > {
 	virtual ~Mode() { }
 
@@ -20,9 +25,35 @@ struct Mode : std::enable_shared_from_this< Mode > {
 	//draw is called after update:
 	virtual void draw(glm::uvec2 const &drawable_size) = 0;
 
+	//describe writes a readable summary of the mode's state (for diagnostics, e.g. hitch dumps; see HitchDetector.hpp):
+	virtual void describe(std::ostream &out) const { }
+
 	//Mode::current is the Mode to which events are dispatched.
 	// use 'set_current' to change the current Mode (e.g., to switch to a menu)
 	static std::shared_ptr< Mode > current;
 	static void set_current(std::shared_ptr< Mode > const &);
+
+	//Mode::gl_enabled is false when there is no GL context (e.g. on the null platform; see Platform.hpp):
+	// modes should skip acquiring GL resources and issuing GL commands, but still do the CPU side of drawing.
+	static bool gl_enabled;
+
+	//Mode::software_rasterizer, if set, is where modes should also send the triangles they draw (see SoftwareRasterizer.hpp):
+	// (it is per-thread, so several threads can each draw their own mode into their own rasterizer)
+	static thread_local SoftwareRasterizer *software_rasterizer;
+
+	//Mode::frame_timing, if set, has the main loop's recent frame times (see FrameTiming.hpp):
+	// modes may draw them on top of everything else when frame_timing->overlay is set.
+	static FrameTiming const *frame_timing;
+
+	//Mode::gl_timer, if set, times GPU passes (see GLTimer.hpp); modes bracket their clears, uploads, and draws with it:
+	static GLTimer *gl_timer;
+
+	//Mode::late_latch is set when there is a real mouse to read (see --late-latch in main.cpp):
+	// modes may then re-read it in draw() and draw what it controls where it is now, rather than where the last
+	// handled event put it. This only changes what is drawn; the simulation still follows the events.
+	static bool late_latch;
+	//...and a mode that did re-read it sets Mode::late_latched during draw() (the main loop clears it first),
+	// so the main loop can count the motion it drew as presented by this frame:
+	static bool late_latched;
 };
 
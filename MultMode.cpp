@@ -3,10 +3,28 @@
 //for the GL_ERRORS() macro:
 #include "gl_errors.hpp"
 
+//for redundant state change elimination:
+#include "GLStateCache.hpp"
+
+//for drawing without GL:
+#include "SoftwareRasterizer.hpp"
+
+//for the frame time overlay:
+#include "FrameTiming.hpp"
+
+//for trace spans:
+#include "Trace.hpp"
+
+//for timing GPU passes:
+#include "GLTimer.hpp"
+
 //for glm::value_ptr() :
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <ostream>
 #include <random>
+#include <string>
 
 #define HEX_TO_U8VEC4( HX ) (glm::u8vec4( (HX >> 24) & 0xff, (HX >> 16) & 0xff, (HX >> 8) & 0xff, (HX) & 0xff ))
 
@@ -23,105 +41,93 @@ MultMode::MultMode()
     proj_trail.clear();
     collision_trail.clear();
 
-	//----- allocate OpenGL resources -----
-	{ //vertex buffer:
-		glGenBuffers(1, &vertex_buffer);
-		//for now, buffer will be un-filled.
-
-		GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
-	}
-
-	{ //vertex array mapping buffer for color_texture_program:
-		//ask OpenGL to fill vertex_buffer_for_color_texture_program with the name of an unused vertex array object:
-		glGenVertexArrays(1, &vertex_buffer_for_color_texture_program);
-
-		//set vertex_buffer_for_color_texture_program as the current vertex array object:
-		glBindVertexArray(vertex_buffer_for_color_texture_program);
-
-		//set vertex_buffer as the source of glVertexAttribPointer() commands:
-		glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
-
-		//set up the vertex array object to describe arrays of MultMode::Vertex:
-		glVertexAttribPointer(
-			color_texture_program.Position_vec4, //attribute
-			3, //size
-			GL_FLOAT, //type
-			GL_FALSE, //normalized
-			sizeof(Vertex), //stride
-			(GLbyte *)0 + 0 //offset
-		);
-		glEnableVertexAttribArray(color_texture_program.Position_vec4);
-		//[Note that it is okay to bind a vec3 input to a vec4 attribute -- the w component will be filled with 1.0 automatically]
-
-		glVertexAttribPointer(
-			color_texture_program.Color_vec4, //attribute
-			4, //size
-			GL_UNSIGNED_BYTE, //type
-			GL_TRUE, //normalized
-			sizeof(Vertex), //stride
-			(GLbyte *)0 + 4*3 //offset
-		);
-		glEnableVertexAttribArray(color_texture_program.Color_vec4);
-
-		glVertexAttribPointer(
-			color_texture_program.TexCoord_vec2, //attribute
-			2, //size
-			GL_FLOAT, //type
-			GL_FALSE, //normalized
-			sizeof(Vertex), //stride
-			(GLbyte *)0 + 4*3 + 4*1 //offset
-		);
-		glEnableVertexAttribArray(color_texture_program.TexCoord_vec2);
-
-		//done referring to vertex_buffer, so unbind it:
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-		//done setting up vertex array object, so unbind it:
-		glBindVertexArray(0);
-
-		GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
+	//----- acquire (possibly shared) OpenGL resources -----
+	if (Mode::gl_enabled) {
+		color_texture_program = acquire_color_texture_program();
+		vertex_buffer = acquire_vertex_buffer("PosColTex");
+		vertex_buffer_for_color_texture_program = acquire_PosColTex_vao(vertex_buffer, color_texture_program);
+		white_tex = acquire_white_tex();
 	}
+}
 
-	{ //solid white texture:
-		//ask OpenGL to fill white_tex with the name of an unused texture object:
-		glGenTextures(1, &white_tex);
-
-		//bind that texture object as a GL_TEXTURE_2D-type texture:
-		glBindTexture(GL_TEXTURE_2D, white_tex);
-
-		//upload a 1x1 image of solid white to the texture:
-		glm::uvec2 size = glm::uvec2(1,1);
-		std::vector< glm::u8vec4 > data(size.x*size.y, glm::u8vec4(0xff, 0xff, 0xff, 0xff));
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-
-		//set filtering and wrapping parameters:
-		//(it's a bit silly to mipmap a 1x1 texture, but I'm doing it because you may want to use this code to load different sizes of texture)
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-		//since texture uses a mipmap and we haven't uploaded one, instruct opengl to make one for us:
-		glGenerateMipmap(GL_TEXTURE_2D);
-
-		//Okay, texture uploaded, can unbind it:
-		glBindTexture(GL_TEXTURE_2D, 0);
+MultMode::~MultMode() {
+	//(OpenGL resources are released along with the last reference to them)
 
-		GL_ERRORS(); //PARANOIA: print out any OpenGL errors that may have happened
+	for (Paddle *paddle : paddles) {
+		if (paddle != &starting_paddle) delete paddle;
 	}
+	for (PowerUp *powerup : powerup_on_court) {
+		delete powerup;
+	}
+	delete inventory;
+	delete active_powerup;
 }
 
-MultMode::~MultMode() {
+std::shared_ptr< MultMode > MultMode::snapshot() const {
+	//copy everything, then point the copy at copies of the paddles and powerups:
+	std::shared_ptr< MultMode > copy(new MultMode(*this));
+
+	for (Paddle *&paddle : copy->paddles) {
+		if (paddle == &starting_paddle) paddle = &copy->starting_paddle;
+		else paddle = new Paddle(*paddle);
+	}
+	if (selected_paddle) {
+		copy->selected_paddle = (selected_paddle == &right_paddle ? &copy->right_paddle : copy->paddles.at(selected_paddle->index));
+	}
+	for (PowerUp *&powerup : copy->powerup_on_court) {
+		powerup = new PowerUp(*powerup);
+	}
+	if (inventory) copy->inventory = new PowerUp(*inventory);
+	if (active_powerup) copy->active_powerup = new PowerUp(*active_powerup);
 
-	//----- free OpenGL resources -----
-	glDeleteBuffers(1, &vertex_buffer);
-	vertex_buffer = 0;
+	return copy;
+}
 
-	glDeleteVertexArrays(1, &vertex_buffer_for_color_texture_program);
-	vertex_buffer_for_color_texture_program = 0;
+void MultMode::describe(std::ostream &out) const {
+	auto vec = [](glm::vec2 const &v) {
+		return "(" + std::to_string(v.x) + ", " + std::to_string(v.y) + ")";
+	};
+	auto powerup_name = [](PowerUps type) {
+		switch (type) {
+			case Projection: return "projection";
+			case Spray: return "spray";
+			case Freeze: return "freeze";
+			case Shrink: return "shrink";
+		}
+		return "?";
+	};
+	auto state_name = [](PaddleState state) {
+		switch (state) {
+			case Ready: return "ready";
+			case Active: return "active";
+			case Regen: return "regen";
+		}
+		return "?";
+	};
 
-	glDeleteTextures(1, &white_tex);
-	white_tex = 0;
+	out << "score: " << left_score << " (player) to " << right_score << " (ai)\n";
+	out << "ball: at " << vec(ball) << ", velocity " << vec(ball_velocity) << "\n";
+	out << "paddles: " << paddles.size() << "\n";
+	for (Paddle const *paddle : paddles) {
+		out << "  " << paddle->index << ": at " << vec(paddle->position) << ", radius " << vec(paddle->radius)
+		    << ", " << state_name(paddle->state) << " (active " << paddle->active_timer << " s, regen " << paddle->regen_timer << " s)"
+		    << (paddle == selected_paddle ? ", selected" : "")
+		    << (paddle == selected_paddle && latched ? ", last drawn (late-latched) at " + vec(latched_position) : "") << "\n";
+	}
+	out << "ai paddle: at " << vec(right_paddle.position) << ", radius " << vec(right_paddle.radius)
+	    << ", offset " << ai_offset << " (next update in " << ai_offset_update << " s)\n";
+	out << "powerups on court: " << powerup_on_court.size() << " (next spawn in " << (powerup_spawn_time - powerup_spawn_timer) << " s)\n";
+	for (PowerUp const *powerup : powerup_on_court) {
+		out << "  " << powerup_name(powerup->type) << " at " << vec(powerup->position) << "\n";
+	}
+	out << "inventory: " << (inventory ? powerup_name(inventory->type) : "none") << "\n";
+	if (active_powerup) {
+		out << "active powerup: " << powerup_name(active_powerup->type) << " (" << active_powerup->active_timer << " s), "
+		    << active_powerup->spray.size() << " spray balls\n";
+	} else {
+		out << "active powerup: none\n";
+	}
+	out << "trails: " << ball_trail.size() << " ball, " << proj_trail.size() << " projection, " << collision_trail.size() << " collision points\n";
 }
 
 bool MultMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size) {
@@ -212,12 +218,27 @@ bool MultMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size)
 	return false;
 }
 
-void MultMode::update(float elapsed) {
+float MultMode::clamp_selected_y(float y) const {
+    int i = selected_paddle->index;
+    //clamp against paddles:
+    if (i != 0) {
+        y = std::min(y, paddles[i-1]->position.y - 2*paddles[i]->radius.y);
+    }
+    if (size_t(i) + 1 != paddles.size()) {
+        y = std::max(y, paddles[i+1]->position.y + 2*paddles[i]->radius.y);
+    }
+    //clamp to court:
+    y = std::max(y, -court_radius.y + selected_paddle->radius.y);
+    y = std::min(y,  court_radius.y - selected_paddle->radius.y);
+    return y;
+}
 
-	static std::mt19937 mt; //mersenne twister pseudo-random number generator
+void MultMode::update(float elapsed) {
+	TRACE_SCOPE("MultMode::update");
 
 	//----- paddle update -----
 
+	TRACE_BEGIN("ai");
     if (active_powerup == nullptr || active_powerup->type != Freeze) {
         { //right player ai:
             ai_offset_update -= elapsed;
@@ -234,16 +255,12 @@ void MultMode::update(float elapsed) {
         }
     }
 
-    //clamp paddles against paddles:
-    if (selected_paddle != nullptr) {
-        int i = selected_paddle->index;
-        if (i != 0) {
-            paddles[i]->position.y = std::min(paddles[i]->position.y, paddles[i-1]->position.y - 2*paddles[i]->radius.y);
-        }
+	TRACE_END("ai");
 
-        if (i != paddles.size()-1) {
-            paddles[i]->position.y = std::max(paddles[i]->position.y, paddles[i+1]->position.y + 2*paddles[i]->radius.y);
-        }
+	TRACE_BEGIN("paddle clamp");
+    //clamp selected paddle against paddles (and court):
+    if (selected_paddle != nullptr) {
+        selected_paddle->position.y = clamp_selected_y(selected_paddle->position.y);
     }
 
 	//clamp paddles to court:
@@ -253,10 +270,10 @@ void MultMode::update(float elapsed) {
     };
 
     clamp_paddle(right_paddle);
-    if (selected_paddle != nullptr) {
-        clamp_paddle(*selected_paddle);
-    }
 
+	TRACE_END("paddle clamp");
+
+	TRACE_BEGIN("timers");
     //update timer state of paddles:
     for (Paddle *paddle : paddles) {
         if (paddle->state_changed) {
@@ -290,15 +307,18 @@ void MultMode::update(float elapsed) {
         }
     }
 
+	TRACE_END("timers");
+
+	TRACE_BEGIN("powerups");
     //update timer of powerups
     if (powerup_on_court.size() < 3) {
         powerup_spawn_timer += elapsed;
         if (powerup_spawn_timer >= powerup_spawn_time) {
             powerup_spawn_timer = 0.0f;
             //randomly spawn a powerup
-            float x = (-court_radius.x + powerup_radius.x) + static_cast <float> (rand()) /( static_cast <float> (RAND_MAX/(2*(court_radius.x - powerup_radius.x))));
-            float y = (-court_radius.y + powerup_radius.y) + static_cast <float> (rand()) /( static_cast <float> (RAND_MAX/(2*(court_radius.y - powerup_radius.y))));
-            PowerUps rand_powerup = (PowerUps)(rand() % 4 + 1);
+            float x = (-court_radius.x + powerup_radius.x) + static_cast <float> (mt()) /( static_cast <float> (mt.max()/(2*(court_radius.x - powerup_radius.x))));
+            float y = (-court_radius.y + powerup_radius.y) + static_cast <float> (mt()) /( static_cast <float> (mt.max()/(2*(court_radius.y - powerup_radius.y))));
+            PowerUps rand_powerup = (PowerUps)(mt() % 4 + 1);
             PowerUp *new_powerup = new PowerUp(glm::vec2(x, y), rand_powerup);
             powerup_on_court.push_back(new_powerup);
         }
@@ -344,8 +364,11 @@ void MultMode::update(float elapsed) {
         }
     }
 
+	TRACE_END("powerups");
+
 	//----- ball update -----
 
+	TRACE_BEGIN("ball");
 	//speed of ball doubles every four points:
 	float speed_multiplier = 4.0f * std::pow(2.0f, (left_score + right_score) / 4.0f);
 
@@ -354,8 +377,11 @@ void MultMode::update(float elapsed) {
 
 	ball += elapsed * speed_multiplier * ball_velocity;
 
+	TRACE_END("ball");
+
     //---- spray update -----
 
+	TRACE_BEGIN("spray");
     if (active_powerup != nullptr && active_powerup->type == Spray) {
         for (glm::vec4 &b : active_powerup->spray) {
             b[0] += elapsed * speed_multiplier * b[2];
@@ -363,8 +389,11 @@ void MultMode::update(float elapsed) {
         }
     }
 
+	TRACE_END("spray");
+
 	//---- collision handling ----
 
+	TRACE_BEGIN("collisions");
 	//paddles:
 	auto paddle_vs_ball = [this](Paddle const &paddle) {
 		//compute area of overlap:
@@ -533,8 +562,11 @@ void MultMode::update(float elapsed) {
         collision_trail.push_back(ball);
     }
 
+	TRACE_END("collisions");
+
 	//----- gradient trails -----
 
+	TRACE_BEGIN("trails");
 	//age up all locations in ball trail:
 	for (auto &t : ball_trail) {
 		t.z += elapsed;
@@ -560,10 +592,12 @@ void MultMode::update(float elapsed) {
             proj_trail.erase(proj_trail.begin());
         }
     }
-
+	TRACE_END("trails");
 }
 
 void MultMode::draw(glm::uvec2 const &drawable_size) {
+	TRACE_SCOPE("MultMode::draw");
+
 	//some nice colors from the course web page:
 	const glm::u8vec4 bg_color = HEX_TO_U8VEC4(0x193b59ff);
 	const glm::u8vec4 fg_color = HEX_TO_U8VEC4(0xf2d2b6ff);
@@ -579,8 +613,35 @@ void MultMode::draw(glm::uvec2 const &drawable_size) {
 	const float shadow_offset = 0.07f;
 	const float padding = 0.14f; //padding between outside of walls and edge of window
 
+	//---- late latch ----
+
+	//re-read the mouse (see Mode::late_latch) and draw the selected paddle there, rather than where
+	// the events handled at the start of the frame put it; the events that moved it are handled next frame:
+	latched = false;
+	if (Mode::late_latch && selected_paddle != nullptr) {
+		TRACE_SCOPE("late latch");
+		SDL_PumpEvents(); //(SDL's mouse state only changes as events are pumped)
+		SDL_Window *window = SDL_GetMouseFocus();
+		int w = 0, h = 0;
+		if (window) SDL_GetWindowSize(window, &w, &h);
+		if (w > 0 && h > 0) {
+			int x = 0, y = 0;
+			SDL_GetMouseState(&x, &y);
+			//(as in handle_event, using the last frame's clip_to_court)
+			glm::vec2 clip_mouse = glm::vec2(
+				(x + 0.5f) / w * 2.0f - 1.0f,
+				(y + 0.5f) / h *-2.0f + 1.0f
+			);
+			latched_position = glm::vec2(selected_paddle->position.x, clamp_selected_y((clip_to_court * glm::vec3(clip_mouse, 1.0f)).y));
+			latched = true;
+			Mode::late_latched = true;
+		}
+	}
+
 	//---- compute vertices to draw ----
 
+	TRACE_BEGIN("vertex build");
+
 	//vertices will be accumulated into this list and then uploaded+drawn at the end of this function:
 	std::vector< Vertex > vertices;
 
@@ -744,33 +805,34 @@ void MultMode::draw(glm::uvec2 const &drawable_size) {
 
 	//paddles:
     for (Paddle *paddle : paddles) {
+        glm::vec2 paddle_position = (latched && paddle == selected_paddle ? latched_position : paddle->position);
         switch (paddle->state) {
             case Ready: {
-                draw_rectangle(paddle->position, paddle->radius, HEX_TO_U8VEC4(0xf2d2b6ff));
+                draw_rectangle(paddle_position, paddle->radius, HEX_TO_U8VEC4(0xf2d2b6ff));
                 break;
             }
             case Active: {
                 //red - time spent active
                 glm::vec2 time_spent_rad = glm::vec2(paddle->radius.x/2, paddle->radius.y * (paddle->active_timer/active_time));
-                glm::vec2 time_spent_pos = glm::vec2(paddle->position.x - 0.35f, paddle->position.y + paddle->radius.y - time_spent_rad.y);
+                glm::vec2 time_spent_pos = glm::vec2(paddle_position.x - 0.35f, paddle_position.y + paddle->radius.y - time_spent_rad.y);
                 draw_rectangle(time_spent_pos, time_spent_rad, HEX_TO_U8VEC4(0xff0000ff));
                 //green - time left active
                 glm::vec2 time_left_rad = glm::vec2(paddle->radius.x/2, paddle->radius.y * (1.0f - paddle->active_timer/active_time));
-                glm::vec2 time_left_pos = glm::vec2(paddle->position.x - 0.35f, paddle->position.y - paddle->radius.y + time_left_rad.y);
+                glm::vec2 time_left_pos = glm::vec2(paddle_position.x - 0.35f, paddle_position.y - paddle->radius.y + time_left_rad.y);
                 draw_rectangle(time_left_pos, time_left_rad, HEX_TO_U8VEC4(0x00ff00ff));
 
                 //draw paddle
-                draw_rectangle(paddle->position, paddle->radius, HEX_TO_U8VEC4(0x90ee90ff));
+                draw_rectangle(paddle_position, paddle->radius, HEX_TO_U8VEC4(0x90ee90ff));
                 break;
             }
             case Regen: {
                 //green - time spent in cool down
                 glm::vec2 time_spent_rad = glm::vec2(paddle->radius.x, paddle->radius.y * (paddle->regen_timer/regen_time));
-                glm::vec2 time_spent_pos = glm::vec2(paddle->position.x, paddle->position.y + paddle->radius.y - time_spent_rad.y);
+                glm::vec2 time_spent_pos = glm::vec2(paddle_position.x, paddle_position.y + paddle->radius.y - time_spent_rad.y);
                 draw_rectangle(time_spent_pos, time_spent_rad, HEX_TO_U8VEC4(0xf2d2b6ff));
                 //red - time left in cool down
                 glm::vec2 time_left_rad = glm::vec2(paddle->radius.x, paddle->radius.y * (1.0f - paddle->regen_timer/regen_time));
-                glm::vec2 time_left_pos = glm::vec2(paddle->position.x, paddle->position.y - paddle->radius.y + time_left_rad.y);
+                glm::vec2 time_left_pos = glm::vec2(paddle_position.x, paddle_position.y - paddle->radius.y + time_left_rad.y);
                 draw_rectangle(time_left_pos, time_left_rad, HEX_TO_U8VEC4(0xff0000ff));
                 break;
             }
@@ -798,6 +860,50 @@ void MultMode::draw(glm::uvec2 const &drawable_size) {
         draw_powerup(inventory->type, top_left_corner, inventory->radius);
     }
 
+	//frame time overlay (see FrameTiming.hpp): one bar per recent frame along the bottom of the court, newest at the right:
+	if (Mode::frame_timing && Mode::frame_timing->overlay) {
+		FrameTiming const &timing = *Mode::frame_timing;
+		const glm::u8vec4 phase_colors[FrameTiming::PhaseCount] = {
+			HEX_TO_U8VEC4(0x3895d3ff), //events
+			HEX_TO_U8VEC4(0x90ee90ff), //update
+			HEX_TO_U8VEC4(0xf2ad94ff), //draw
+			HEX_TO_U8VEC4(0xb53737ff), //present
+		};
+		const glm::u8vec4 other_color = HEX_TO_U8VEC4(0x888888ff); //(untimed part of the frame)
+		constexpr uint32_t Bars = 120;
+		const float ms_height = 0.1f; //court units per millisecond
+		const float bar_radius = court_radius.x / Bars;
+		const float base = -court_radius.y;
+		const float top = court_radius.y;
+
+		//backdrop up to 33 ms, with lines at 16.7 ms (60 frames/second) and 33.3 ms (30 frames/second):
+		float backdrop = 0.5f * (1000.0f / 30.0f) * ms_height;
+		draw_rectangle(glm::vec2(0.0f, base + backdrop), glm::vec2(court_radius.x, backdrop), HEX_TO_U8VEC4(0x00000066));
+		for (float ms : { 1000.0f / 60.0f, 1000.0f / 30.0f }) {
+			draw_rectangle(glm::vec2(0.0f, base + ms * ms_height), glm::vec2(court_radius.x, 0.01f), HEX_TO_U8VEC4(0xffffff88));
+		}
+
+		uint32_t bars = std::min(Bars, timing.frames_kept());
+		for (uint32_t back = 0; back < bars; ++back) {
+			FrameTiming::Frame const &frame = timing.recent(back);
+			float x = court_radius.x - (2 * back + 1) * bar_radius;
+			float y = base;
+			//stack the phases, then whatever is left of the frame, clipped at the top of the court:
+			auto segment = [&](float ms, glm::u8vec4 const &color) {
+				float h = std::min(std::max(ms, 0.0f) * ms_height, top - y);
+				if (h <= 0.0f) return;
+				draw_rectangle(glm::vec2(x, y + 0.5f * h), glm::vec2(0.8f * bar_radius, 0.5f * h), color);
+				y += h;
+			};
+			float timed_ms = 0.0f;
+			for (uint32_t p = 0; p < FrameTiming::PhaseCount; ++p) {
+				segment(frame.ms[p], phase_colors[p]);
+				timed_ms += frame.ms[p];
+			}
+			segment(frame.total_ms - timed_ms, other_color);
+		}
+	}
+
 	//------ compute court-to-window transform ------
 
 	//compute area that should be visible:
@@ -839,48 +945,72 @@ void MultMode::draw(glm::uvec2 const &drawable_size) {
 		glm::vec2(center.x, center.y)
 	);
 
+	TRACE_END("vertex build");
+
+	//---- drawing on the CPU ----
+
+	if (Mode::software_rasterizer) {
+		TRACE_SCOPE("software draw");
+		Mode::software_rasterizer->clear(bg_color);
+		Mode::software_rasterizer->draw_triangles(vertices, court_to_clip);
+	}
+
+	//(with no GL, the vertices and transforms above are all there is to do)
+	if (!Mode::gl_enabled) return;
+
 	//---- actual drawing ----
 
+	//label GL commands (and any debug messages they cause) with this location:
+	GL_DEBUG_GROUP("MultMode::draw");
+
+	//(each GPU pass is timed when Mode::gl_timer is set)
+
 	//clear the color buffer:
 	glClearColor(bg_color.r / 255.0f, bg_color.g / 255.0f, bg_color.b / 255.0f, bg_color.a / 255.0f);
-	glClear(GL_COLOR_BUFFER_BIT);
+	{
+		GLTimerScope gpu_pass(Mode::gl_timer, FrameTiming::GPUClear);
+		glClear(GL_COLOR_BUFFER_BIT);
+	}
+
+	//(state changes go through gl_state, which skips the ones that are already in effect from last frame)
 
 	//use alpha blending:
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	gl_state.enable(GL_BLEND);
+	gl_state.blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	//don't use the depth test:
-	glDisable(GL_DEPTH_TEST);
+	gl_state.disable(GL_DEPTH_TEST);
 
 	//upload vertices to vertex_buffer:
-	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer); //set vertex_buffer as current
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(vertices[0]), vertices.data(), GL_STREAM_DRAW); //upload vertices array
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	TRACE_BEGIN("upload");
+	gl_state.bind_buffer(GL_ARRAY_BUFFER, vertex_buffer->buffer); //set vertex_buffer as current
+	{
+		GLTimerScope gpu_pass(Mode::gl_timer, FrameTiming::GPUUpload);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(vertices[0]), vertices.data(), GL_STREAM_DRAW); //upload vertices array
+	}
+	TRACE_END("upload");
 
 	//set color_texture_program as current program:
-	glUseProgram(color_texture_program.program);
+	gl_state.use_program(color_texture_program->program);
 
 	//upload OBJECT_TO_CLIP to the proper uniform location:
-	glUniformMatrix4fv(color_texture_program.OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(court_to_clip));
+	glUniformMatrix4fv(color_texture_program->OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(court_to_clip));
 
 	//use the mapping vertex_buffer_for_color_texture_program to fetch vertex data:
-	glBindVertexArray(vertex_buffer_for_color_texture_program);
+	gl_state.bind_vertex_array(vertex_buffer_for_color_texture_program->array);
 
 	//bind the solid white texture to location zero so things will be drawn just with their colors:
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, white_tex);
+	gl_state.active_texture(GL_TEXTURE0);
+	gl_state.bind_texture(GL_TEXTURE_2D, white_tex->texture);
 
 	//run the OpenGL pipeline:
-	glDrawArrays(GL_TRIANGLES, 0, GLsizei(vertices.size()));
-
-	//unbind the solid white texture:
-	glBindTexture(GL_TEXTURE_2D, 0);
-
-	//reset vertex array to none:
-	glBindVertexArray(0);
+	TRACE_BEGIN("draw call");
+	{
+		GLTimerScope gpu_pass(Mode::gl_timer, FrameTiming::GPUDraw);
+		glDrawArrays(GL_TRIANGLES, 0, GLsizei(vertices.size()));
+	}
+	TRACE_END("draw call");
 
-	//reset current program to none:
-	glUseProgram(0);
-	
+	//(bindings are left in place rather than reset to zero, so next frame's binds can be skipped)
 
 	GL_ERRORS(); //PARANOIA: print errors just in case we did something wrong.
 
@@ -1,4 +1,5 @@
 #include "ColorTextureProgram.hpp"
+#include "GLResources.hpp"
 
 #include "Mode.hpp"
 #include "GL.hpp"
@@ -7,6 +8,8 @@
 
 #include <vector>
 #include <deque>
+#include <memory>
+#include <random>
 
 enum PaddleState {Ready, Active, Regen};
 enum PowerUps {Projection = 1, Spray, Freeze, Shrink};
@@ -23,6 +26,10 @@ struct MultMode : Mode {
 	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) override;
 	virtual void update(float elapsed) override;
 	virtual void draw(glm::uvec2 const &drawable_size) override;
+	virtual void describe(std::ostream &out) const override;
+
+	//an independent copy of the whole game state (e.g. to re-simulate from; see replay_render_main.cpp):
+	std::shared_ptr< MultMode > snapshot() const;
 
 	//----- game state -----
 
@@ -68,6 +75,9 @@ struct MultMode : Mode {
 	float ai_offset = 0.0f;
 	float ai_offset_update = 0.0f;
 
+	//all randomness (ai and powerup spawns) comes from here, so the game replays exactly from the same inputs:
+	std::mt19937 mt; //mersenne twister pseudo-random number generator
+
     //----- powerups -----
 
     float powerup_spawn_timer = 0.0f;
@@ -118,21 +128,35 @@ struct MultMode : Mode {
 	};
 	static_assert(sizeof(Vertex) == 4*3 + 1*4 + 4*2, "MultMode::Vertex should be packed");
 
+	//(these are shared with other modes through the GLResources registry)
+
 	//Shader program that draws transformed, vertices tinted with vertex colors:
-	ColorTextureProgram color_texture_program;
+	std::shared_ptr< ColorTextureProgram const > color_texture_program;
 
 	//Buffer used to hold vertex data during drawing:
-	GLuint vertex_buffer = 0;
+	std::shared_ptr< GLBuffer const > vertex_buffer;
 
 	//Vertex Array Object that maps buffer locations to color_texture_program attribute locations:
-	GLuint vertex_buffer_for_color_texture_program = 0;
+	std::shared_ptr< GLVertexArray const > vertex_buffer_for_color_texture_program;
 
 	//Solid white texture:
-	GLuint white_tex = 0;
+	std::shared_ptr< GLTexture const > white_tex;
 
 	//matrix that maps from clip coordinates to court-space coordinates:
 	glm::mat3x2 clip_to_court = glm::mat3x2(1.0f);
 	// computed in draw() as the inverse of OBJECT_TO_CLIP
 	// (stored here so that the mouse handling code can use it to position the paddle)
 
+	//where the selected paddle was last drawn, if draw() late-latched the mouse (see Mode::late_latch):
+	// (update() doesn't use this; the motion events read early are handled next frame as usual)
+	glm::vec2 latched_position = glm::vec2(0.0f);
+	bool latched = false;
+
+private:
+	//selected paddle's y clamped against its neighbors and the court (as update() does):
+	float clamp_selected_y(float y) const;
+
+	//(paddles and powerups are owned through raw pointers, so copies are made with snapshot())
+	MultMode(MultMode const &) = default;
+	MultMode &operator=(MultMode const &) = delete;
 };
@@ -0,0 +1,311 @@
+#include "Platform.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+//------------ SDLPlatform ------------
+
+SDLPlatform::SDLPlatform(glm::uvec2 const &headless_size, GLLoaderBackend gl_loader) {
+	if (headless_size != glm::uvec2(0)) {
+		//no window; draw into a framebuffer on a surfaceless context instead:
+		SDL_Init(0);
+		try {
+			//(also calls init_GL)
+			headless_context.reset(new HeadlessContext(headless_size, gl_loader));
+		} catch (std::exception const &e) {
+			throw std::runtime_error(std::string("Error creating headless OpenGL context: ") + e.what());
+		}
+	} else {
+		//Initialize SDL library:
+		SDL_Init(SDL_INIT_VIDEO);
+
+		//Ask for an OpenGL context version 3.3, core profile, enable debug:
+		SDL_GL_ResetAttributes();
+		SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+		SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+		//create window:
+		window = SDL_CreateWindow(
+			"mult", //TODO: remember to set a title for your game!
+			SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+			640, 480, //TODO: modify window size if you'd like
+			SDL_WINDOW_OPENGL
+			| SDL_WINDOW_RESIZABLE //uncomment to allow resizing
+			| SDL_WINDOW_ALLOW_HIGHDPI //uncomment for full resolution on high-DPI screens
+		);
+
+		if (!window) {
+			throw std::runtime_error(std::string("Error creating SDL window: ") + SDL_GetError());
+		}
+
+		//prevent exceedingly tiny windows when resizing:
+		SDL_SetWindowMinimumSize(window, 100, 100);
+
+		//Create OpenGL context:
+		context = SDL_GL_CreateContext(window);
+
+		if (!context) {
+			std::string error = SDL_GetError();
+			SDL_DestroyWindow(window);
+			window = nullptr;
+			throw std::runtime_error("Error creating OpenGL context: " + error);
+		}
+
+		//On windows and linux, load OpenGL entrypoints: (does nothing on other platforms)
+		try {
+			init_GL(gl_loader);
+		} catch (std::exception const &e) {
+			SDL_GL_DeleteContext(context);
+			SDL_DestroyWindow(window);
+			context = 0;
+			window = nullptr;
+			throw std::runtime_error(std::string("Error loading OpenGL: ") + e.what());
+		}
+
+		//Set VSYNC + Late Swap (prevents crazy FPS):
+		if (SDL_GL_SetSwapInterval(-1) != 0) {
+			std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
+			if (SDL_GL_SetSwapInterval(1) != 0) {
+				std::cerr << "NOTE: couldn't set vsync (" << SDL_GetError() << ")." << std::endl;
+			}
+		}
+
+		//Hide mouse cursor (note: showing can be useful for debugging):
+		//SDL_ShowCursor(SDL_DISABLE);
+	}
+}
+
+SDLPlatform::~SDLPlatform() {
+	headless_context.reset();
+
+	if (context) {
+		SDL_GL_DeleteContext(context);
+		context = 0;
+	}
+
+	if (window) {
+		SDL_DestroyWindow(window);
+		window = nullptr;
+	}
+}
+
+bool SDLPlatform::poll_event(SDL_Event *evt) {
+	//(headless runs have no window to get events from)
+	if (!window) return false;
+	return SDL_PollEvent(evt) == 1;
+}
+
+void SDLPlatform::resize() {
+	if (headless_context) {
+		window_size = drawable_size = headless_context->size;
+	} else {
+		int w,h;
+		SDL_GetWindowSize(window, &w, &h);
+		window_size = glm::uvec2(w, h);
+		SDL_GL_GetDrawableSize(window, &w, &h);
+		drawable_size = glm::uvec2(w, h);
+		//(the window may have moved to another display)
+		SDL_DisplayMode mode;
+		int display = SDL_GetWindowDisplayIndex(window);
+		if (display >= 0 && SDL_GetCurrentDisplayMode(display, &mode) == 0 && mode.refresh_rate > 0) {
+			refresh_rate = float(mode.refresh_rate);
+		} else {
+			refresh_rate = 0.0f;
+		}
+	}
+	glViewport(0, 0, drawable_size.x, drawable_size.y);
+}
+
+float SDLPlatform::elapsed() {
+	//headless frames are rendered as fast as possible, so use a fixed step (this also keeps runs repeatable):
+	if (headless_context) return 1.0f / 60.0f;
+
+	auto current_time = std::chrono::high_resolution_clock::now();
+	if (first_elapsed) {
+		first_elapsed = false;
+		previous_time = current_time;
+	}
+	float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
+	previous_time = current_time;
+
+	//if frames are taking a very long time to process,
+	//lag to avoid spiral of death:
+	return std::min(0.1f, elapsed);
+}
+
+void SDLPlatform::present() {
+	if (headless_context) {
+		//read the frame back (this is also what waits for it to finish):
+		headless_context->read_pixels(&headless_frame);
+	} else {
+		//Wait until the recently-drawn frame is shown before doing it all again:
+		SDL_GL_SwapWindow(window);
+	}
+}
+
+//------------ NullPlatform ------------
+
+/* Scripts are text files with one event per line:
+ *   <time> motion <x> <y>
+ *   <time> down <x> <y> [<button>]
+ *   <time> up <x> <y> [<button>]
+ *   <time> key <name>        (press and release)
+ *   <time> keydown <name>
+ *   <time> keyup <name>
+ *   <time> quit
+ * where <time> is in (virtual) seconds, positions are in window pixels, and
+ *  key names are as understood by SDL_GetKeyFromName (e.g. 'Space', 'F').
+ * Blank lines and lines starting with '#' are ignored.
+ */
+
+static SDL_Event mouse_event(Uint32 type, int x, int y, Uint8 button) {
+	SDL_Event evt;
+	std::memset(&evt, 0, sizeof(evt));
+	evt.type = type;
+	if (type == SDL_MOUSEMOTION) {
+		evt.motion.x = x;
+		evt.motion.y = y;
+	} else {
+		evt.button.button = button;
+		evt.button.state = (type == SDL_MOUSEBUTTONDOWN ? SDL_PRESSED : SDL_RELEASED);
+		evt.button.clicks = 1;
+		evt.button.x = x;
+		evt.button.y = y;
+	}
+	return evt;
+}
+
+static SDL_Event key_event(Uint32 type, SDL_Keycode key) {
+	SDL_Event evt;
+	std::memset(&evt, 0, sizeof(evt));
+	evt.type = type;
+	evt.key.state = (type == SDL_KEYDOWN ? SDL_PRESSED : SDL_RELEASED);
+	evt.key.keysym.sym = key;
+	evt.key.keysym.scancode = SDL_GetScancodeFromKey(key);
+	return evt;
+}
+
+NullPlatform::NullPlatform(glm::uvec2 const &size, std::string const &script, uint32_t seed) : mt(seed) {
+	has_gl = false;
+	window_size = drawable_size = size;
+	mouse = glm::ivec2(size / 2u);
+
+	if (script == "") return;
+
+	std::ifstream in(script);
+	if (!in) {
+		throw std::runtime_error("Failed to open event script '" + script + "'.");
+	}
+	scripted = true;
+
+	std::string line;
+	uint32_t line_number = 0;
+	while (std::getline(in, line)) {
+		line_number += 1;
+		std::istringstream str(line);
+		auto bad = [&](std::string const &why) {
+			return std::runtime_error(script + ":" + std::to_string(line_number) + ": " + why);
+		};
+		std::string first;
+		if (!(str >> first) || first[0] == '#') continue; //blank or comment
+		double when;
+		std::string what;
+		{
+			std::istringstream first_str(first);
+			if (!(first_str >> when)) throw bad("expecting a time, got '" + first + "'.");
+		}
+		if (!(str >> what)) throw bad("expecting an event after the time.");
+		if (!script_events.empty() && when < script_events.back().first) {
+			throw bad("events must be in order of time.");
+		}
+		if (what == "motion" || what == "down" || what == "up") {
+			int x, y;
+			if (!(str >> x >> y)) throw bad("expecting '" + what + " <x> <y>'.");
+			int button = SDL_BUTTON_LEFT;
+			str >> button;
+			Uint32 type = (what == "motion" ? SDL_MOUSEMOTION : what == "down" ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP);
+			script_events.emplace_back(when, mouse_event(type, x, y, Uint8(button)));
+		} else if (what == "key" || what == "keydown" || what == "keyup") {
+			std::string name;
+			if (!(str >> name)) throw bad("expecting '" + what + " <name>'.");
+			SDL_Keycode key = SDL_GetKeyFromName(name.c_str());
+			if (key == SDLK_UNKNOWN) throw bad("unknown key '" + name + "'.");
+			if (what != "keyup") script_events.emplace_back(when, key_event(SDL_KEYDOWN, key));
+			if (what != "keydown") script_events.emplace_back(when, key_event(SDL_KEYUP, key));
+		} else if (what == "quit") {
+			SDL_Event evt;
+			std::memset(&evt, 0, sizeof(evt));
+			evt.type = SDL_QUIT;
+			script_events.emplace_back(when, evt);
+		} else {
+			throw bad("unknown event '" + what + "'.");
+		}
+	}
+}
+
+void NullPlatform::generate() {
+	//a mouse that wanders up and down the window, with the occasional click (mostly over the left side, where the player's paddles are) and key press:
+	std::uniform_int_distribution< int > wander(-8, 8);
+	std::uniform_real_distribution< float > chance(0.0f, 1.0f);
+
+	glm::ivec2 max = glm::ivec2(window_size) - glm::ivec2(1);
+	mouse.x = std::max(0, std::min(max.x, mouse.x + wander(mt)));
+	mouse.y = std::max(0, std::min(max.y, mouse.y + 4 * wander(mt)));
+
+	if (chance(mt) < 1.0f / 60.0f) {
+		mouse.x = std::uniform_int_distribution< int >(0, max.x / 4)(mt);
+		pending.emplace_back(mouse_event(SDL_MOUSEBUTTONDOWN, mouse.x, mouse.y, SDL_BUTTON_LEFT));
+		pending.emplace_back(mouse_event(SDL_MOUSEBUTTONUP, mouse.x, mouse.y, SDL_BUTTON_LEFT));
+	}
+	pending.emplace_back(mouse_event(SDL_MOUSEMOTION, mouse.x, mouse.y, 0));
+
+	if (chance(mt) < 1.0f / 90.0f) {
+		pending.emplace_back(key_event(SDL_KEYDOWN, SDLK_SPACE));
+		pending.emplace_back(key_event(SDL_KEYUP, SDLK_SPACE));
+	}
+	if (chance(mt) < 1.0f / 300.0f) {
+		pending.emplace_back(key_event(SDL_KEYDOWN, SDLK_f));
+		pending.emplace_back(key_event(SDL_KEYUP, SDLK_f));
+	}
+}
+
+bool NullPlatform::poll_event(SDL_Event *evt) {
+	if (scripted) {
+		if (script_events.empty() || script_events.front().first > time) return false;
+		*evt = script_events.front().second;
+		script_events.pop_front();
+	} else {
+		if (!generated) {
+			generated = true;
+			generate();
+		}
+		if (pending.empty()) return false;
+		*evt = pending.front();
+		pending.pop_front();
+	}
+	events += 1;
+	return true;
+}
+
+float NullPlatform::elapsed() {
+	return step;
+}
+
+void NullPlatform::present() {
+	//nothing to show; just move the clock along:
+	time += step;
+	generated = false;
+}
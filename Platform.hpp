@@ -0,0 +1,100 @@
+#pragma once
+
+/*
+ * A Platform is where the main loop gets its events, its clock, and somewhere
+ *  to draw to.
+ *
+ * SDLPlatform opens a window with an OpenGL 3.3 core context (or, if given a
+ *  size, a HeadlessContext with no window at all) and runs on the real clock.
+ *
+ * NullPlatform has no display and no GL: it feeds the mode events from a
+ *  script (or synthetic ones, if there is no script) and runs on a virtual
+ *  clock, while modes still update and build their vertices (see
+ *  Mode::gl_enabled). This makes it possible to run (and time) the whole loop
+ *  on a machine with nothing but a CPU.
+ *
+ */
+
+#include "GL.hpp"
+#include "HeadlessContext.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Platform {
+	virtual ~Platform() { }
+
+	//false if nothing should issue GL commands:
+	bool has_gl = true;
+
+	//size of window (layout pixels) and drawable (physical pixels):
+	glm::uvec2 window_size = glm::uvec2(0);
+	glm::uvec2 drawable_size = glm::uvec2(0);
+	//refresh rate (frames/second) of the display the window is on, or 0 if unknown (e.g. when headless):
+	float refresh_rate = 0.0f;
+
+	//fetch the next pending event, returning false if there are none (like SDL_PollEvent):
+	virtual bool poll_event(SDL_Event *evt) = 0;
+
+	//re-read window_size and drawable_size (and set the viewport) after a resize:
+	virtual void resize() { }
+
+	//seconds to advance the game by this frame:
+	virtual float elapsed() = 0;
+
+	//show (or read back) the frame that was just drawn:
+	virtual void present() = 0;
+};
+
+struct SDLPlatform : Platform {
+	//opens a window, unless 'headless_size' is nonzero; throws std::runtime_error on failure:
+	SDLPlatform(glm::uvec2 const &headless_size, GLLoaderBackend gl_loader);
+	virtual ~SDLPlatform();
+
+	virtual bool poll_event(SDL_Event *evt) override;
+	virtual void resize() override;
+	virtual float elapsed() override;
+	virtual void present() override;
+
+	SDL_Window *window = nullptr;
+	SDL_GLContext context = 0;
+	std::unique_ptr< HeadlessContext > headless_context;
+	std::vector< glm::u8vec4 > headless_frame; //last frame read back, when headless
+
+private:
+	std::chrono::high_resolution_clock::time_point previous_time;
+	bool first_elapsed = true;
+};
+
+struct NullPlatform : Platform {
+	//'script' may be empty, in which case events are made up (from a generator seeded with 'seed'):
+	// throws std::runtime_error if the script can't be read.
+	NullPlatform(glm::uvec2 const &size, std::string const &script, uint32_t seed = 0);
+
+	virtual bool poll_event(SDL_Event *evt) override;
+	virtual float elapsed() override;
+	virtual void present() override;
+
+	float step = 1.0f / 60.0f; //virtual time per frame
+	double time = 0.0; //virtual time of the current frame
+	uint64_t events = 0; //events handed out so far
+
+private:
+	//scripted events, as (time, event), in order:
+	std::deque< std::pair< double, SDL_Event > > script_events;
+	bool scripted = false;
+
+	//synthetic events for the current frame:
+	std::deque< SDL_Event > pending;
+	bool generated = false; //(pending already holds this frame's events)
+	std::mt19937 mt;
+	glm::ivec2 mouse = glm::ivec2(0);
+	void generate();
+};
@@ -1,4 +1,5 @@
 #include "ColorTextureProgram.hpp"
+#include "GLResources.hpp"
 
 #include "Mode.hpp"
 #include "GL.hpp"
@@ -7,6 +8,7 @@
 
 #include <vector>
 #include <deque>
+#include <memory>
 
 /*
  * PongMode is a game mode that implements a single-player game of Pong.
@@ -56,17 +58,19 @@ struct PongMode : Mode {
 	};
 	static_assert(sizeof(Vertex) == 4*3 + 1*4 + 4*2, "PongMode::Vertex should be packed");
 
+	//(these are shared with other modes through the GLResources registry)
+
 	//Shader program that draws transformed, vertices tinted with vertex colors:
-	ColorTextureProgram color_texture_program;
+	std::shared_ptr< ColorTextureProgram const > color_texture_program;
 
 	//Buffer used to hold vertex data during drawing:
-	GLuint vertex_buffer = 0;
+	std::shared_ptr< GLBuffer const > vertex_buffer;
 
 	//Vertex Array Object that maps buffer locations to color_texture_program attribute locations:
-	GLuint vertex_buffer_for_color_texture_program = 0;
+	std::shared_ptr< GLVertexArray const > vertex_buffer_for_color_texture_program;
 
 	//Solid white texture:
-	GLuint white_tex = 0;
+	std::shared_ptr< GLTexture const > white_tex;
 
 	//matrix that maps from clip coordinates to court-space coordinates:
 	glm::mat3x2 clip_to_court = glm::mat3x2(1.0f);
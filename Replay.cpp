@@ -0,0 +1,107 @@
+#include "Replay.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+bool Replay::records(SDL_Event const &evt) {
+	return evt.type == SDL_MOUSEMOTION
+	    || evt.type == SDL_MOUSEBUTTONDOWN
+	    || evt.type == SDL_MOUSEBUTTONUP
+	    || evt.type == SDL_KEYDOWN
+	    || evt.type == SDL_KEYUP;
+}
+
+void Replay::save(std::string const &filename) const {
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) {
+		throw std::runtime_error("Failed to open '" + filename + "' to save a replay.");
+	}
+	//(9 significant digits is enough for floats to read back exactly)
+	out.precision(9);
+
+	glm::uvec2 window_size = glm::uvec2(0);
+	glm::uvec2 drawable_size = glm::uvec2(0);
+	for (Frame const &frame : frames) {
+		if (frame.window_size != window_size || frame.drawable_size != drawable_size) {
+			window_size = frame.window_size;
+			drawable_size = frame.drawable_size;
+			out << "size " << window_size.x << " " << window_size.y << " " << drawable_size.x << " " << drawable_size.y << "\n";
+		}
+		out << "frame " << frame.elapsed << "\n";
+		for (SDL_Event const &evt : frame.events) {
+			if (evt.type == SDL_MOUSEMOTION) {
+				out << "motion " << evt.motion.x << " " << evt.motion.y << "\n";
+			} else if (evt.type == SDL_MOUSEBUTTONDOWN || evt.type == SDL_MOUSEBUTTONUP) {
+				out << (evt.type == SDL_MOUSEBUTTONDOWN ? "down " : "up ") << evt.button.x << " " << evt.button.y << " " << int(evt.button.button) << "\n";
+			} else if (evt.type == SDL_KEYDOWN || evt.type == SDL_KEYUP) {
+				out << (evt.type == SDL_KEYDOWN ? "keydown " : "keyup ") << evt.key.keysym.sym << "\n";
+			}
+		}
+	}
+
+	if (!out) {
+		throw std::runtime_error("Failed to write replay to '" + filename + "'.");
+	}
+}
+
+Replay Replay::load(std::string const &filename) {
+	std::ifstream in(filename, std::ios::binary);
+	if (!in) {
+		throw std::runtime_error("Failed to open replay '" + filename + "'.");
+	}
+
+	Replay replay;
+	glm::uvec2 window_size = glm::uvec2(0);
+	glm::uvec2 drawable_size = glm::uvec2(0);
+
+	std::string line;
+	uint32_t line_number = 0;
+	while (std::getline(in, line)) {
+		line_number += 1;
+		std::istringstream str(line);
+		auto bad = [&](std::string const &why) {
+			return std::runtime_error(filename + ":" + std::to_string(line_number) + ": " + why);
+		};
+		std::string what;
+		if (!(str >> what)) continue; //blank
+
+		SDL_Event evt;
+		std::memset(&evt, 0, sizeof(evt));
+		if (what == "size") {
+			if (!(str >> window_size.x >> window_size.y >> drawable_size.x >> drawable_size.y)) throw bad("expecting 'size <W> <H> <W> <H>'.");
+			continue;
+		} else if (what == "frame") {
+			replay.frames.emplace_back();
+			replay.frames.back().window_size = window_size;
+			replay.frames.back().drawable_size = drawable_size;
+			if (!(str >> replay.frames.back().elapsed)) throw bad("expecting 'frame <elapsed>'.");
+			continue;
+		} else if (what == "motion") {
+			evt.type = SDL_MOUSEMOTION;
+			if (!(str >> evt.motion.x >> evt.motion.y)) throw bad("expecting 'motion <x> <y>'.");
+		} else if (what == "down" || what == "up") {
+			evt.type = (what == "down" ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP);
+			int button = 0;
+			if (!(str >> evt.button.x >> evt.button.y >> button)) throw bad("expecting '" + what + " <x> <y> <button>'.");
+			evt.button.button = Uint8(button);
+			evt.button.state = (what == "down" ? SDL_PRESSED : SDL_RELEASED);
+			evt.button.clicks = 1;
+		} else if (what == "keydown" || what == "keyup") {
+			evt.type = (what == "keydown" ? SDL_KEYDOWN : SDL_KEYUP);
+			if (!(str >> evt.key.keysym.sym)) throw bad("expecting '" + what + " <keycode>'.");
+			evt.key.state = (what == "keydown" ? SDL_PRESSED : SDL_RELEASED);
+			evt.key.keysym.scancode = SDL_GetScancodeFromKey(evt.key.keysym.sym);
+		} else {
+			throw bad("unknown line '" + what + "'.");
+		}
+		if (replay.frames.empty()) throw bad("expecting a 'frame' line before the first event.");
+		replay.frames.back().events.emplace_back(evt);
+	}
+
+	if (!replay.frames.empty() && replay.frames[0].drawable_size == glm::uvec2(0)) {
+		throw std::runtime_error("Replay '" + filename + "' doesn't start with a 'size' line.");
+	}
+	return replay;
+}
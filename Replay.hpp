@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+ * A Replay records what the main loop fed the game, frame by frame: the
+ *  events handled (with the window size they were handled at), the drawable
+ *  size, and the time passed to update().
+ *
+ * MultMode takes all of its randomness from its own generator, so playing a
+ *  replay back into a fresh MultMode reproduces the match exactly; see
+ *  replay_render_main.cpp, which re-renders replays to video.
+ *
+ * Replays are saved as text, one line per frame or event:
+ *   size <window W> <window H> <drawable W> <drawable H>   (when it changes)
+ *   frame <elapsed>
+ *   motion <x> <y>
+ *   down <x> <y> <button>
+ *   up <x> <y> <button>
+ *   keydown <keycode>
+ *   keyup <keycode>
+ * with each frame's events following its 'frame' line.
+ *
+ */
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+struct Replay {
+	struct Frame {
+		glm::uvec2 window_size = glm::uvec2(0);
+		glm::uvec2 drawable_size = glm::uvec2(0);
+		float elapsed = 0.0f;
+		std::vector< SDL_Event > events;
+	};
+	std::vector< Frame > frames;
+
+	//true for the kinds of events replays keep (mouse and keyboard; the rest don't reach modes or don't matter to them):
+	static bool records(SDL_Event const &evt);
+
+	//both throw std::runtime_error on failure:
+	void save(std::string const &filename) const;
+	static Replay load(std::string const &filename);
+};
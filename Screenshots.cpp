@@ -0,0 +1,126 @@
+#include "Screenshots.hpp"
+
+#include "load_save_png.hpp"
+#include "load_save_qoi.hpp"
+#include "image_ops.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static double milliseconds(Clock::duration d) {
+	return std::chrono::duration< double, std::milli >(d).count();
+}
+
+//(two slots, so a screenshot can be read while the last one is still being encoded)
+Screenshots::Screenshots() : readback(2) {
+	worker = std::thread([this]() {
+		trace_thread_name("screenshot worker");
+		std::unique_lock< std::mutex > lock(mutex);
+		while (true) {
+			cv.wait(lock, [this]() { return quit || !jobs.empty(); });
+			if (jobs.empty()) return; //(quit, and nothing left to do)
+			Job job = jobs.front();
+			jobs.pop_front();
+			lock.unlock();
+			save(job);
+			lock.lock();
+		}
+	});
+}
+
+Screenshots::~Screenshots() {
+	//finish any reads in flight:
+	frame(glm::uvec2(0));
+	if (!reading.empty()) {
+		std::vector< GLReadback::Frame > finished;
+		readback.poll(&finished, true);
+		for (GLReadback::Frame const &f : finished) {
+			auto job = std::find_if(reading.begin(), reading.end(), [&](Job const &j) { return j.tag == f.tag; });
+			std::unique_lock< std::mutex > lock(mutex);
+			jobs.emplace_back(*job);
+			jobs.back().frame = f;
+		}
+		reading.clear();
+	}
+
+	//wait for the worker to save everything:
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	cv.notify_one();
+	worker.join();
+	//(readback unmaps its buffers once the worker is done with them)
+}
+
+void Screenshots::request(std::string const &filename) {
+	requested = filename;
+}
+
+void Screenshots::frame(glm::uvec2 const &drawable_size) {
+	auto before = Clock::now();
+
+	if (requested != "" && drawable_size != glm::uvec2(0)) {
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		glReadBuffer(GL_BACK);
+		Job job;
+		job.tag = next_tag++;
+		job.filename = requested;
+		if (readback.read(drawable_size, job.tag)) {
+			std::cout << "Saving screenshot to '" << job.filename << "'." << std::endl;
+			job.render_thread_ms = milliseconds(Clock::now() - before);
+			reading.emplace_back(job);
+		} else {
+			std::cerr << "WARNING: still saving earlier screenshots; skipping '" << job.filename << "'." << std::endl;
+		}
+		requested = "";
+	}
+
+	if (reading.empty() && readback.mapped() == 0) return;
+
+	auto before_poll = Clock::now();
+	std::vector< GLReadback::Frame > finished;
+	readback.poll(&finished);
+	double poll_ms = milliseconds(Clock::now() - before_poll);
+
+	for (GLReadback::Frame const &f : finished) {
+		auto job = std::find_if(reading.begin(), reading.end(), [&](Job const &j) { return j.tag == f.tag; });
+		if (job == reading.end()) continue;
+		job->frame = f;
+		job->render_thread_ms += poll_ms;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			jobs.emplace_back(*job);
+		}
+		cv.notify_one();
+		reading.erase(job);
+	}
+}
+
+void Screenshots::save(Job const &job) {
+	TRACE_SCOPE("Screenshots::save");
+	auto before = Clock::now();
+
+	//copy out of the mapped buffer (so it can be released right away), forcing alpha to opaque:
+	glm::uvec2 size = job.frame.size;
+	std::vector< glm::u8vec4 > data(job.frame.pixels, job.frame.pixels + size.x * size.y);
+	readback.release(job.frame.slot);
+	image_fill_alpha(data.data(), data.size());
+
+	//(both flip the rows, since GL's origin is at the lower left; save_png also encodes stripes in parallel)
+	bool qoi = job.filename.size() >= 4 && job.filename.compare(job.filename.size() - 4, 4, ".qoi") == 0;
+	try {
+		if (qoi) save_qoi(job.filename, size, data.data(), LowerLeftOrigin);
+		else save_png(job.filename, size, data.data(), LowerLeftOrigin, PNGSaveOptions());
+	} catch (std::exception const &e) {
+		std::cerr << "WARNING: " << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Saved screenshot '" << job.filename << "' (" << size.x << "x" << size.y << "): "
+	          << job.render_thread_ms << " ms on the render thread, read back after " << job.frame.polls << " frame(s), "
+	          << milliseconds(Clock::now() - before) << " ms to encode." << std::endl;
+}
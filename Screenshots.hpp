@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+ * Screenshots saves frames to PNG files without stalling the render thread:
+ *  the frame is read into a pixel buffer object (see GLReadback.hpp), mapped
+ *  once the read has finished (usually a frame later), and handed to a worker
+ *  thread that forces alpha to opaque and encodes it (as QOI if the filename
+ *  ends in '.qoi', which is much faster to write; PNG otherwise).
+ *
+ */
+
+#include "GLReadback.hpp"
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Screenshots {
+	Screenshots();
+	//(waits for screenshots in progress to be saved; call with the GL context still current)
+	~Screenshots();
+	Screenshots(Screenshots const &) = delete;
+	Screenshots &operator=(Screenshots const &) = delete;
+
+	//save the next frame drawn to 'filename':
+	void request(std::string const &filename);
+
+	//call every frame after drawing and before presenting, with the default framebuffer's size:
+	void frame(glm::uvec2 const &drawable_size);
+
+private:
+	GLReadback readback;
+
+	std::string requested; //(filename for the next frame, if any)
+
+	struct Job {
+		uint64_t tag = 0;
+		std::string filename;
+		double render_thread_ms = 0.0; //time spent in frame() reading and mapping
+		GLReadback::Frame frame;
+	};
+	std::vector< Job > reading; //(reads in flight)
+	uint64_t next_tag = 0;
+
+	//worker thread state:
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque< Job > jobs;
+	bool quit = false;
+	std::thread worker;
+	void save(Job const &job);
+};
@@ -0,0 +1,366 @@
+#include "SoftwareRasterizer.hpp"
+#include "cpu_features.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+//------------ span blending ------------
+
+//All of these compute, per channel, what GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA blending of 'color' over 'dst' does:
+//   (color * a + dst * (255 - a)) / 255, rounded
+// using (t + 128 + ((t + 128) >> 8)) >> 8 to do the rounded division by 255 (exact for t <= 255 * 255).
+
+static inline uint8_t blend_channel(uint32_t src_times_a, uint32_t dst, uint32_t inv_a) {
+	uint32_t t = src_times_a + dst * inv_a + 128;
+	return uint8_t((t + (t >> 8)) >> 8);
+}
+
+static void blend_span_scalar(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color) {
+	uint32_t a = color.a;
+	uint32_t inv_a = 255 - a;
+	uint32_t s0 = color.r * a, s1 = color.g * a, s2 = color.b * a, s3 = color.a * a;
+	for (uint32_t i = 0; i < count; ++i) {
+		dst[i].r = blend_channel(s0, dst[i].r, inv_a);
+		dst[i].g = blend_channel(s1, dst[i].g, inv_a);
+		dst[i].b = blend_channel(s2, dst[i].b, inv_a);
+		dst[i].a = blend_channel(s3, dst[i].a, inv_a);
+	}
+}
+
+#ifdef CPU_FEATURES_X86
+
+static void blend_span_sse2(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color) {
+	uint32_t a = color.a;
+	__m128i zero = _mm_setzero_si128();
+	//(src * a + 128) in each 16-bit lane, for two pixels:
+	__m128i src = _mm_set_epi16(
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128),
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128)
+	);
+	__m128i inv_a = _mm_set1_epi16(short(255 - a));
+
+	auto blend = [&](__m128i d16) {
+		__m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, inv_a), src);
+		return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+	};
+
+	uint32_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i d = _mm_loadu_si128(reinterpret_cast< __m128i const * >(dst + i));
+		__m128i lo = blend(_mm_unpacklo_epi8(d, zero));
+		__m128i hi = blend(_mm_unpackhi_epi8(d, zero));
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(dst + i), _mm_packus_epi16(lo, hi));
+	}
+	blend_span_scalar(dst + i, count - i, color);
+}
+
+//four pixels (widened to 16 bits per channel):
+TARGET_AVX2
+static inline __m256i blend_avx2(__m128i d8, __m256i const &src, __m256i const &inv_a) {
+	__m256i t = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_cvtepu8_epi16(d8), inv_a), src);
+	return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+TARGET_AVX2
+static void blend_span_avx2(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color) {
+	uint32_t a = color.a;
+	//(src * a + 128) in each 16-bit lane, for four pixels:
+	__m256i src = _mm256_set_epi16(
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128),
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128),
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128),
+		short(color.a * a + 128), short(color.b * a + 128), short(color.g * a + 128), short(color.r * a + 128)
+	);
+	__m256i inv_a = _mm256_set1_epi16(short(255 - a));
+
+	uint32_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i const *d = reinterpret_cast< __m128i const * >(dst + i);
+		__m256i lo = blend_avx2(_mm_loadu_si128(d), src, inv_a); //pixels 0-3
+		__m256i hi = blend_avx2(_mm_loadu_si128(d + 1), src, inv_a); //pixels 4-7
+		//packus works within 128-bit lanes, giving pixels 0,1,4,5,2,3,6,7; put them back in order:
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(dst + i), packed);
+	}
+	blend_span_sse2(dst + i, count - i, color);
+}
+
+TARGET_AVX2
+static void fill_span_avx2(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color) {
+	uint32_t bits;
+	std::memcpy(&bits, &color, sizeof(bits));
+	__m256i c = _mm256_set1_epi32(int(bits));
+	uint32_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(dst + i), c);
+	}
+	for (; i < count; ++i) dst[i] = color;
+}
+
+#endif //CPU_FEATURES_X86
+
+static void fill_span(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color, SoftwareRasterizer::Simd simd) {
+#ifdef CPU_FEATURES_X86
+	if (simd == SoftwareRasterizer::AVX2) {
+		fill_span_avx2(dst, count, color);
+		return;
+	}
+#endif
+	std::fill(dst, dst + count, color);
+}
+
+static void blend_span(glm::u8vec4 *dst, uint32_t count, glm::u8vec4 const &color, SoftwareRasterizer::Simd simd) {
+	if (color.a == 0) return;
+	if (color.a == 255) {
+		fill_span(dst, count, color, simd);
+		return;
+	}
+#ifdef CPU_FEATURES_X86
+	if (simd == SoftwareRasterizer::AVX2) {
+		blend_span_avx2(dst, count, color);
+		return;
+	} else if (simd == SoftwareRasterizer::SSE2) {
+		blend_span_sse2(dst, count, color);
+		return;
+	}
+#endif
+	blend_span_scalar(dst, count, color);
+}
+
+SoftwareRasterizer::Simd SoftwareRasterizer::best_simd() {
+#ifdef CPU_FEATURES_X86
+	return cpu_features().avx2 ? AVX2 : SSE2;
+#else
+	return Scalar;
+#endif
+}
+
+char const *SoftwareRasterizer::simd_name(Simd simd) {
+	if (simd == AVX2) return "AVX2";
+	if (simd == SSE2) return "SSE2";
+	return "scalar";
+}
+
+//------------ SoftwareRasterizer ------------
+
+SoftwareRasterizer::SoftwareRasterizer(glm::uvec2 const &size_, uint32_t threads_) : size(size_), next_tile(0) {
+	pixels.assign(size.x * size.y, glm::u8vec4(0));
+
+	uint32_t const tile_size = TileSize;
+	tiles = (size + glm::uvec2(tile_size - 1)) / tile_size;
+	bins.resize(tiles.x * tiles.y);
+
+	if (threads_ == 0) threads_ = std::max(1u, std::thread::hardware_concurrency());
+	//(no point in more threads than tiles)
+	threads_ = std::min(threads_, tiles.x * tiles.y);
+	for (uint32_t i = 1; i < threads_; ++i) {
+		workers.emplace_back([this]() {
+			uint32_t seen = 0;
+			std::unique_lock< std::mutex > lock(mutex);
+			while (true) {
+				start_cv.wait(lock, [&]() { return quit || generation != seen; });
+				if (quit) return;
+				seen = generation;
+				lock.unlock();
+				run_tiles();
+				lock.lock();
+				busy -= 1;
+				if (busy == 0) done_cv.notify_one();
+			}
+		});
+	}
+}
+
+SoftwareRasterizer::~SoftwareRasterizer() {
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	start_cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+void SoftwareRasterizer::clear(glm::u8vec4 const &color) {
+	clear_color = color;
+	primitives.clear();
+	triangles.clear();
+}
+
+void SoftwareRasterizer::draw_pos_col(std::vector< PosCol > const &vertices, glm::mat4 const &object_to_clip) {
+	//object space -> window pixels (as per glViewport(0, 0, size.x, size.y)):
+	auto to_window = [&](glm::vec3 const &position) {
+		glm::vec4 clip = object_to_clip * glm::vec4(position, 1.0f);
+		return glm::vec2(
+			(clip.x / clip.w * 0.5f + 0.5f) * size.x,
+			(clip.y / clip.w * 0.5f + 0.5f) * size.y
+		);
+	};
+
+	//rectangles stay rectangles under transforms with no rotation or projection:
+	bool axis_aligned =
+		object_to_clip[0][1] == 0.0f && object_to_clip[1][0] == 0.0f
+		&& object_to_clip[0][3] == 0.0f && object_to_clip[1][3] == 0.0f && object_to_clip[2][3] == 0.0f;
+
+	//pixels whose centers are in [min,max) are covered:
+	auto cover = [&](glm::vec2 const &min, glm::vec2 const &max, Primitive *primitive) {
+		primitive->x0 = std::max(0, int32_t(std::ceil(min.x - 0.5f)));
+		primitive->y0 = std::max(0, int32_t(std::ceil(min.y - 0.5f)));
+		primitive->x1 = std::min(int32_t(size.x), int32_t(std::ceil(max.x - 0.5f)));
+		primitive->y1 = std::min(int32_t(size.y), int32_t(std::ceil(max.y - 0.5f)));
+		return primitive->x0 < primitive->x1 && primitive->y0 < primitive->y1;
+	};
+
+	size_t i = 0;
+	while (i + 3 <= vertices.size()) {
+		//the two triangles draw_rectangle() emits: (x0,y0) (x1,y0) (x1,y1), (x0,y0) (x1,y1) (x0,y1)
+		if (axis_aligned && i + 6 <= vertices.size()) {
+			PosCol const *v = &vertices[i];
+			bool rectangle =
+				v[0].Position.y == v[1].Position.y && v[1].Position.x == v[2].Position.x
+				&& v[2].Position.y == v[5].Position.y && v[5].Position.x == v[0].Position.x
+				&& v[3].Position == v[0].Position && v[4].Position == v[2].Position
+				&& v[1].Color == v[0].Color && v[2].Color == v[0].Color && v[3].Color == v[0].Color
+				&& v[4].Color == v[0].Color && v[5].Color == v[0].Color;
+			if (rectangle) {
+				glm::vec2 a = to_window(v[0].Position);
+				glm::vec2 b = to_window(v[2].Position);
+				Primitive primitive;
+				primitive.color = v[0].Color;
+				primitive.triangle = -1;
+				if (cover(glm::min(a, b), glm::max(a, b), &primitive)) {
+					primitives.emplace_back(primitive);
+				}
+				i += 6;
+				continue;
+			}
+		}
+
+		Triangle triangle;
+		for (uint32_t k = 0; k < 3; ++k) {
+			triangle.position[k] = to_window(vertices[i+k].Position);
+			triangle.color[k] = glm::vec4(vertices[i+k].Color);
+		}
+		Primitive primitive;
+		primitive.color = glm::u8vec4(0);
+		primitive.triangle = int32_t(triangles.size());
+		glm::vec2 min = glm::min(triangle.position[0], glm::min(triangle.position[1], triangle.position[2]));
+		glm::vec2 max = glm::max(triangle.position[0], glm::max(triangle.position[1], triangle.position[2]));
+		//(one extra pixel on the far sides, since the edge tests decide coverage)
+		if (cover(min, max + glm::vec2(1.0f), &primitive)) {
+			triangles.emplace_back(triangle);
+			primitives.emplace_back(primitive);
+		}
+		i += 3;
+	}
+}
+
+void SoftwareRasterizer::finish() {
+	//bin primitives into the tiles they overlap:
+	int32_t const tile_size = int32_t(TileSize);
+	for (auto &bin : bins) bin.clear();
+	for (uint32_t p = 0; p < primitives.size(); ++p) {
+		Primitive const &primitive = primitives[p];
+		for (int32_t ty = primitive.y0 / tile_size; ty <= (primitive.y1 - 1) / tile_size; ++ty) {
+			for (int32_t tx = primitive.x0 / tile_size; tx <= (primitive.x1 - 1) / tile_size; ++tx) {
+				bins[ty * tiles.x + tx].emplace_back(p);
+			}
+		}
+	}
+
+	//draw tiles on all threads:
+	next_tile = 0;
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		generation += 1;
+		busy = uint32_t(workers.size());
+	}
+	start_cv.notify_all();
+	run_tiles();
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		done_cv.wait(lock, [this]() { return busy == 0; });
+	}
+}
+
+void SoftwareRasterizer::run_tiles() {
+	uint32_t count = tiles.x * tiles.y;
+	while (true) {
+		uint32_t tile = next_tile.fetch_add(1);
+		if (tile >= count) break;
+		draw_tile(tile);
+	}
+}
+
+void SoftwareRasterizer::draw_tile(uint32_t tile) {
+	int32_t const tile_size = int32_t(TileSize);
+	int32_t tx0 = int32_t(tile % tiles.x) * tile_size;
+	int32_t ty0 = int32_t(tile / tiles.x) * tile_size;
+	int32_t tx1 = std::min(tx0 + tile_size, int32_t(size.x));
+	int32_t ty1 = std::min(ty0 + tile_size, int32_t(size.y));
+
+	for (int32_t y = ty0; y < ty1; ++y) {
+		fill_span(&pixels[y * size.x + tx0], uint32_t(tx1 - tx0), clear_color, simd);
+	}
+
+	for (uint32_t p : bins[tile]) {
+		Primitive const &primitive = primitives[p];
+		int32_t x0 = std::max(primitive.x0, tx0);
+		int32_t y0 = std::max(primitive.y0, ty0);
+		int32_t x1 = std::min(primitive.x1, tx1);
+		int32_t y1 = std::min(primitive.y1, ty1);
+		if (x0 >= x1 || y0 >= y1) continue;
+
+		if (primitive.triangle < 0) {
+			for (int32_t y = y0; y < y1; ++y) {
+				blend_span(&pixels[y * size.x + x0], uint32_t(x1 - x0), primitive.color, simd);
+			}
+			continue;
+		}
+
+		//general triangle: test each pixel center against fixed-point edge functions (8 subpixel bits, as GL
+		// rasterizers use), so results are exact and triangles sharing an edge agree on which pixels are on it:
+		Triangle const &t = triangles[primitive.triangle];
+		int64_t const Sub = 256;
+		int64_t px[3], py[3];
+		for (uint32_t k = 0; k < 3; ++k) {
+			//(clamped so the edge products below can't overflow; nothing is drawn that far off screen)
+			px[k] = int64_t(std::llround(glm::clamp(t.position[k].x, -1048576.0f, 1048576.0f) * float(Sub)));
+			py[k] = int64_t(std::llround(glm::clamp(t.position[k].y, -1048576.0f, 1048576.0f) * float(Sub)));
+		}
+		int64_t area = (px[1] - px[0]) * (py[2] - py[0]) - (py[1] - py[0]) * (px[2] - px[0]);
+		if (area == 0) continue;
+		//(edges are taken counterclockwise, so inside is where all three edge functions are positive)
+		int64_t sign = (area > 0 ? 1 : -1);
+
+		//edge k runs between the other two vertices, and its value over 'area' is vertex k's weight:
+		int64_t row[3], step_x[3], step_y[3], bias[3];
+		for (uint32_t k = 0; k < 3; ++k) {
+			uint32_t a = (k + 1) % 3, b = (k + 2) % 3;
+			int64_t dx = (px[b] - px[a]) * sign;
+			int64_t dy = (py[b] - py[a]) * sign;
+			int64_t cx = x0 * Sub + Sub / 2;
+			int64_t cy = y0 * Sub + Sub / 2;
+			row[k] = dx * (cy - py[a]) - dy * (cx - px[a]);
+			step_x[k] = -dy * Sub;
+			step_y[k] = dx * Sub;
+			//pixel centers exactly on an edge only count for edges going one way (the left and bottom ones), so of
+			// two triangles sharing an edge -- which run along it in opposite directions -- exactly one draws them:
+			bias[k] = (dy < 0 || (dy == 0 && dx > 0) ? 0 : -1);
+		}
+		float inv_area = 1.0f / float(area * sign);
+
+		for (int32_t y = y0; y < y1; ++y) {
+			int64_t e0 = row[0], e1 = row[1], e2 = row[2];
+			for (int32_t x = x0; x < x1; ++x, e0 += step_x[0], e1 += step_x[1], e2 += step_x[2]) {
+				if (((e0 + bias[0]) | (e1 + bias[1]) | (e2 + bias[2])) < 0) continue;
+				glm::vec4 color = (t.color[0] * float(e0) + t.color[1] * float(e1) + t.color[2] * float(e2)) * inv_area;
+				glm::u8vec4 c8 = glm::u8vec4(glm::clamp(color + glm::vec4(0.5f), glm::vec4(0.0f), glm::vec4(255.0f)));
+				blend_span_scalar(&pixels[y * size.x + x], 1, c8);
+			}
+			for (uint32_t k = 0; k < 3; ++k) row[k] += step_y[k];
+		}
+	}
+}
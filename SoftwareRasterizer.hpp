@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+ * SoftwareRasterizer draws the same triangle stream the modes hand to
+ *  ColorTextureProgram (alpha-blended, vertex-colored, white-textured) into an
+ *  RGBA8 framebuffer in memory, with no GL at all.
+ *
+ * Triangles arriving in the pairs that make up an axis-aligned rectangle
+ *  (which is everything the built-in modes draw) are filled as spans; anything
+ *  else falls back to a (slower) per-pixel triangle fill.
+ *
+ * The framebuffer is split into tiles, each drawn by one of a pool of threads;
+ *  spans are blended 8 pixels at a time with AVX2 when the CPU supports it (or
+ *  4 at a time with SSE2, or one at a time elsewhere).
+ *
+ * Usage, each frame:
+ *   clear(color); draw_triangles(...); ...; finish();
+ * after which 'pixels' holds the frame.
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct SoftwareRasterizer {
+	//'threads' includes the calling thread (0 means one per hardware thread):
+	SoftwareRasterizer(glm::uvec2 const &size, uint32_t threads = 0);
+	~SoftwareRasterizer();
+	SoftwareRasterizer(SoftwareRasterizer const &) = delete;
+	SoftwareRasterizer &operator=(SoftwareRasterizer const &) = delete;
+
+	glm::uvec2 size;
+
+	//the framebuffer (size.x * size.y, lower-left origin, like glReadPixels):
+	std::vector< glm::u8vec4 > pixels;
+
+	//span blending routines, from slowest to fastest:
+	enum Simd { Scalar, SSE2, AVX2 };
+	static Simd best_simd(); //fastest one this CPU supports
+	static char const *simd_name(Simd simd);
+	Simd simd = best_simd(); //(may be lowered, e.g. for benchmarking)
+
+	uint32_t threads() const { return uint32_t(workers.size()) + 1; }
+
+	//start a new frame, cleared to 'color' (like glClear):
+	void clear(glm::u8vec4 const &color);
+
+	//queue triangles (three vertices each) transformed by 'object_to_clip':
+	// 'Vertex' needs Position (vec3) and Color (u8vec4) members; texture coordinates are ignored.
+	template< typename Vertex >
+	void draw_triangles(std::vector< Vertex > const &vertices, glm::mat4 const &object_to_clip) {
+		scratch.clear();
+		scratch.reserve(vertices.size());
+		for (auto const &v : vertices) {
+			scratch.emplace_back(PosCol{ v.Position, v.Color });
+		}
+		draw_pos_col(scratch, object_to_clip);
+	}
+
+	//draw everything queued since clear() into 'pixels':
+	void finish();
+
+	//----- internals -----
+
+	struct PosCol {
+		glm::vec3 Position;
+		glm::u8vec4 Color;
+	};
+	void draw_pos_col(std::vector< PosCol > const &vertices, glm::mat4 const &object_to_clip);
+
+	static constexpr uint32_t TileSize = 64;
+
+private:
+	//everything is drawn as a primitive covering pixels [x0,x1) x [y0,y1), in order:
+	struct Primitive {
+		int32_t x0, y0, x1, y1;
+		glm::u8vec4 color; //(rectangles)
+		int32_t triangle; //index into 'triangles', or -1 for a rectangle
+	};
+	struct Triangle {
+		glm::vec2 position[3]; //in pixels
+		glm::vec4 color[3];
+	};
+
+	glm::u8vec4 clear_color = glm::u8vec4(0);
+	std::vector< Primitive > primitives;
+	std::vector< Triangle > triangles;
+	std::vector< PosCol > scratch;
+
+	glm::uvec2 tiles = glm::uvec2(0);
+	std::vector< std::vector< uint32_t > > bins; //primitives overlapping each tile, in order
+
+	void draw_tile(uint32_t tile);
+	void run_tiles();
+
+	//worker threads wait for 'generation' to change, then draw tiles until there are none left:
+	std::vector< std::thread > workers;
+	std::mutex mutex;
+	std::condition_variable start_cv;
+	std::condition_variable done_cv;
+	uint32_t generation = 0;
+	uint32_t busy = 0;
+	bool quit = false;
+	std::atomic< uint32_t > next_tile;
+};
@@ -0,0 +1,202 @@
+#include "Trace.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+std::atomic< bool > trace_enabled(false);
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct TraceEvent {
+	char const *name;
+	Clock::time_point time;
+	char phase;
+};
+
+//each thread's events go into a list of chunks; only the owning thread writes to the last one,
+// publishing each event by bumping 'count' (and each new chunk through 'next'):
+struct TraceChunk {
+	static constexpr uint32_t Size = 4096;
+	std::array< TraceEvent, Size > events;
+	std::atomic< uint32_t > count{0};
+	std::atomic< TraceChunk * > next{nullptr};
+};
+
+struct TraceBuffer {
+	TraceBuffer(uint32_t tid_) : tid(tid_), head(new TraceChunk), tail(head) { }
+	~TraceBuffer() {
+		while (head) {
+			TraceChunk *next = head->next.load();
+			delete head;
+			head = next;
+		}
+	}
+	uint32_t tid;
+	TraceChunk *head; //(oldest chunk not yet freed; only touched by trace_flush)
+	uint32_t read = 0; //(events of 'head' already written)
+	TraceChunk *tail; //(only touched by the owning thread)
+
+	std::string name; //(guarded by trace_mutex)
+	bool name_written = true;
+};
+
+//guards the buffer list and the file:
+static std::mutex trace_mutex;
+//buffers live until exit, since their threads keep pointers to them:
+static std::vector< std::unique_ptr< TraceBuffer > > trace_buffers;
+static thread_local TraceBuffer *trace_buffer = nullptr;
+
+static FILE *trace_file = nullptr;
+static std::string trace_filename;
+static bool trace_started = false;
+static bool trace_first_record = true;
+static Clock::time_point trace_start_time;
+
+//(call with trace_mutex held)
+static TraceBuffer *trace_register_thread() {
+	trace_buffers.emplace_back(new TraceBuffer(uint32_t(trace_buffers.size()) + 1));
+	trace_buffer = trace_buffers.back().get();
+	return trace_buffer;
+}
+
+void trace_event(char phase, char const *name) {
+	TraceBuffer *buffer = trace_buffer;
+	if (!buffer) {
+		std::lock_guard< std::mutex > lock(trace_mutex);
+		buffer = trace_register_thread();
+	}
+
+	TraceChunk *chunk = buffer->tail;
+	uint32_t index = chunk->count.load(std::memory_order_relaxed);
+	if (index == TraceChunk::Size) {
+		TraceChunk *next = new TraceChunk;
+		chunk->next.store(next, std::memory_order_release);
+		buffer->tail = chunk = next;
+		index = 0;
+	}
+	TraceEvent &event = chunk->events[index];
+	event.name = name;
+	event.time = Clock::now();
+	event.phase = phase;
+	chunk->count.store(index + 1, std::memory_order_release);
+}
+
+void trace_thread_name(std::string const &name) {
+	//(so threads that are never traced don't get buffers)
+	if (!trace_enabled.load(std::memory_order_relaxed)) return;
+	std::lock_guard< std::mutex > lock(trace_mutex);
+	TraceBuffer *buffer = trace_buffer ? trace_buffer : trace_register_thread();
+	buffer->name = name;
+	buffer->name_written = false;
+}
+
+//write 'str' as a JSON string (names are short and mostly plain, so just escape what JSON requires):
+static void write_json_string(FILE *file, char const *str) {
+	std::fputc('"', file);
+	for (char const *c = str; *c; ++c) {
+		if (*c == '"' || *c == '\\') {
+			std::fputc('\\', file);
+			std::fputc(*c, file);
+		} else if (uint8_t(*c) < 0x20) {
+			std::fprintf(file, "\\u%04x", unsigned(uint8_t(*c)));
+		} else {
+			std::fputc(*c, file);
+		}
+	}
+	std::fputc('"', file);
+}
+
+//(call with trace_mutex held)
+static void trace_flush_locked() {
+	if (!trace_file) return;
+
+	auto begin_record = [](){
+		std::fputs(trace_first_record ? "\n" : ",\n", trace_file);
+		trace_first_record = false;
+	};
+
+	for (auto const &buffer : trace_buffers) {
+		if (!buffer->name_written) {
+			begin_record();
+			std::fprintf(trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", buffer->tid);
+			write_json_string(trace_file, buffer->name.c_str());
+			std::fputs("}}", trace_file);
+			buffer->name_written = true;
+		}
+
+		while (true) {
+			TraceChunk *chunk = buffer->head;
+			uint32_t count = chunk->count.load(std::memory_order_acquire);
+			for (uint32_t i = buffer->read; i < count; ++i) {
+				TraceEvent const &event = chunk->events[i];
+				begin_record();
+				std::fputs("{\"name\":", trace_file);
+				write_json_string(trace_file, event.name);
+				double us = std::chrono::duration< double, std::micro >(event.time - trace_start_time).count();
+				std::fprintf(trace_file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", event.phase, us, buffer->tid);
+			}
+			buffer->read = count;
+
+			//free a full chunk once its thread has moved on to the next one:
+			if (count < TraceChunk::Size) break;
+			TraceChunk *next = chunk->next.load(std::memory_order_acquire);
+			if (!next) break;
+			delete chunk;
+			buffer->head = next;
+			buffer->read = 0;
+		}
+	}
+
+	std::fflush(trace_file);
+}
+
+void trace_start(std::string const &filename) {
+	std::lock_guard< std::mutex > lock(trace_mutex);
+	if (trace_started) {
+		throw std::runtime_error("Already traced to '" + trace_filename + "' this run.");
+	}
+
+	trace_file = std::fopen(filename.c_str(), "wb");
+	if (!trace_file) {
+		throw std::runtime_error("Failed to open '" + filename + "' to write a trace.");
+	}
+	trace_filename = filename;
+	trace_started = true;
+	std::fputs("{\"traceEvents\":[", trace_file);
+
+	TraceBuffer *buffer = trace_buffer ? trace_buffer : trace_register_thread();
+	if (buffer->name.empty()) {
+		buffer->name = "main";
+		buffer->name_written = false;
+	}
+
+	trace_start_time = Clock::now();
+	trace_enabled.store(true);
+}
+
+void trace_flush() {
+	std::lock_guard< std::mutex > lock(trace_mutex);
+	trace_flush_locked();
+}
+
+void trace_stop() {
+	std::lock_guard< std::mutex > lock(trace_mutex);
+	if (!trace_file) return;
+
+	//(spans still open on other threads just end without their 'E' events)
+	trace_enabled.store(false);
+	trace_flush_locked();
+
+	std::fputs("\n],\"displayTimeUnit\":\"ms\"}\n", trace_file);
+	bool failed = (std::fclose(trace_file) != 0);
+	trace_file = nullptr;
+	if (failed) {
+		std::cerr << "WARNING: error writing trace to '" << trace_filename << "'." << std::endl;
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * Trace records begin/end events for named spans of code (frames, phases,
+ *  subsystems) on every thread, and writes them as a Chrome trace-event
+ *  JSON file, which chrome://tracing and ui.perfetto.dev show as a timeline.
+ *
+ * Each thread appends events to its own buffer (a list of fixed-size
+ *  chunks) without locking; trace_flush() copies whatever has been
+ *  published so far to the file and frees the chunks it has finished with,
+ *  so it can be called every frame while other threads keep recording.
+ *
+ * When not tracing, each span costs one relaxed atomic load. Building with
+ *  NTRACE defined (e.g. add -DNTRACE to C++FLAGS) compiles the macros to nothing.
+ *
+ * Span names must be string literals (only the pointer is kept until the
+ *  events are written).
+ */
+
+#include <atomic>
+#include <string>
+
+//start tracing to 'filename' (throws std::runtime_error if it can't be opened); only one trace per run:
+void trace_start(std::string const &filename);
+//write the events recorded so far (by any thread) to the file; does nothing if not tracing:
+void trace_flush();
+//stop tracing, flush, and finish the file (does nothing if not tracing):
+void trace_stop();
+
+//label the calling thread in the timeline (e.g. "capture worker"); does nothing if not tracing:
+void trace_thread_name(std::string const &name);
+
+//record one event on the calling thread's buffer ('phase' is 'B' to begin a span, 'E' to end it):
+void trace_event(char phase, char const *name);
+
+extern std::atomic< bool > trace_enabled;
+
+//TraceScope begins a span when constructed and ends it when destroyed:
+struct TraceScope {
+	TraceScope(char const *name_) : name(trace_enabled.load(std::memory_order_relaxed) ? name_ : nullptr) {
+		if (name) trace_event('B', name);
+	}
+	~TraceScope() {
+		if (name) trace_event('E', name);
+	}
+	TraceScope(TraceScope const &) = delete;
+	TraceScope &operator=(TraceScope const &) = delete;
+	char const *name; //(null if tracing was off when the span began)
+};
+
+#define TRACE_CAT2(A, B) A ## B
+#define TRACE_CAT(A, B) TRACE_CAT2(A, B)
+
+//TRACE_SCOPE spans the rest of the enclosing block;
+// TRACE_BEGIN/TRACE_END span a run of statements (they must pair up on the same thread):
+#ifdef NTRACE
+#define TRACE_SCOPE( NAME ) do { } while (0)
+#define TRACE_BEGIN( NAME ) do { } while (0)
+#define TRACE_END( NAME ) do { } while (0)
+#else
+#define TRACE_SCOPE( NAME ) TraceScope TRACE_CAT(trace_scope_, __LINE__)( NAME )
+#define TRACE_BEGIN( NAME ) do { if (trace_enabled.load(std::memory_order_relaxed)) trace_event('B', NAME); } while (0)
+#define TRACE_END( NAME ) do { if (trace_enabled.load(std::memory_order_relaxed)) trace_event('E', NAME); } while (0)
+#endif
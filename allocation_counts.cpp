@@ -0,0 +1,68 @@
+#include "allocation_counts.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic< uint64_t > count_allocations(0);
+static std::atomic< uint64_t > count_frees(0);
+static std::atomic< uint64_t > count_bytes(0);
+
+AllocationCounts allocation_counts() {
+	AllocationCounts ret;
+	ret.allocations = count_allocations.load(std::memory_order_relaxed);
+	ret.frees = count_frees.load(std::memory_order_relaxed);
+	ret.bytes = count_bytes.load(std::memory_order_relaxed);
+	return ret;
+}
+
+static void *counted_malloc(std::size_t size) {
+	count_allocations.fetch_add(1, std::memory_order_relaxed);
+	count_bytes.fetch_add(size, std::memory_order_relaxed);
+	//(malloc(0) may return null, but new must return a unique pointer)
+	return std::malloc(size ? size : 1);
+}
+
+static void counted_free(void *ptr) {
+	if (!ptr) return;
+	count_frees.fetch_add(1, std::memory_order_relaxed);
+	std::free(ptr);
+}
+
+//the array, nothrow, and sized forms are replaced too, since not every library's defaults forward to these:
+
+void *operator new(std::size_t size) {
+	void *ptr = counted_malloc(size);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+void *operator new[](std::size_t size) {
+	void *ptr = counted_malloc(size);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+void *operator new(std::size_t size, std::nothrow_t const &) noexcept {
+	return counted_malloc(size);
+}
+void *operator new[](std::size_t size, std::nothrow_t const &) noexcept {
+	return counted_malloc(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	counted_free(ptr);
+}
+void operator delete[](void *ptr) noexcept {
+	counted_free(ptr);
+}
+void operator delete(void *ptr, std::nothrow_t const &) noexcept {
+	counted_free(ptr);
+}
+void operator delete[](void *ptr, std::nothrow_t const &) noexcept {
+	counted_free(ptr);
+}
+void operator delete(void *ptr, std::size_t) noexcept {
+	counted_free(ptr);
+}
+void operator delete[](void *ptr, std::size_t) noexcept {
+	counted_free(ptr);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * allocation_counts.cpp replaces the global operator new and operator delete
+ *  with versions that count calls (then call malloc and free), so diagnostics
+ *  like the hitch detector (see HitchDetector.hpp) can say how much a frame
+ *  allocated. Counting is a couple of relaxed atomic adds per call.
+ *
+ * Only link it into programs that want the counts (it replaces the operators
+ *  program-wide); without it, allocations aren't counted.
+ */
+
+struct AllocationCounts {
+	uint64_t allocations = 0; //calls to operator new (all forms) so far
+	uint64_t frees = 0; //calls to operator delete with a non-null pointer so far
+	uint64_t bytes = 0; //total bytes requested from operator new so far
+};
+
+AllocationCounts allocation_counts();
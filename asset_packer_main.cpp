@@ -0,0 +1,123 @@
+//asset-packer: build an AssetPack (see AssetPack.hpp) from PNGs, shader sources, and other files,
+// so the game can map one file at startup and upload textures without decoding anything.
+// Entries are named by the paths given on the command line.
+
+#include "AssetPack.hpp"
+#include "load_save_png.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//the type an entry gets, from its file's extension:
+static AssetPack::Type type_for(std::string const &filename) {
+	auto ends_with = [&filename](std::string const &suffix) {
+		return filename.size() >= suffix.size() && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+	};
+	if (ends_with(".png")) return AssetPack::Texture;
+	for (char const *text : { ".glsl", ".vert", ".frag", ".txt" }) {
+		if (ends_with(text)) return AssetPack::Text;
+	}
+	return AssetPack::Data;
+}
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	std::string pack_file;
+	std::vector< std::string > inputs;
+	bool lz4 = false;
+	bool usage = false;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--lz4") {
+			//compress entries (when that makes them smaller):
+			lz4 = true;
+		} else if (arg.size() > 0 && arg[0] == '-') {
+			usage = true;
+			break;
+		} else if (pack_file == "") {
+			pack_file = arg;
+		} else {
+			inputs.emplace_back(arg);
+		}
+	}
+	if (usage || pack_file == "" || inputs.empty()) {
+		std::cerr << "Usage:\n"
+		             "  " << argv[0] << " <out.pack> [--lz4] <file> [<file> ...]\n"
+		             "  (.png files are stored as pre-decoded textures; .glsl, .vert, .frag, and .txt as text; anything else as data)" << std::endl;
+		return 1;
+	}
+
+	//------------  pack ------------
+
+	typedef std::chrono::high_resolution_clock Clock;
+	auto before = Clock::now();
+
+	AssetPackWriter writer;
+	uint64_t input_bytes = 0;
+	try {
+		for (std::string const &input : inputs) {
+			AssetPack::Type type = type_for(input);
+			std::ifstream file(input, std::ios::binary | std::ios::ate);
+			if (!file) {
+				throw std::runtime_error("Failed to open '" + input + "'.");
+			}
+			std::vector< uint8_t > bytes(size_t(file.tellg()));
+			file.seekg(0);
+			if (!file.read(reinterpret_cast< char * >(bytes.data()), bytes.size())) {
+				throw std::runtime_error("Failed to read '" + input + "'.");
+			}
+			input_bytes += bytes.size();
+
+			if (type == AssetPack::Texture) {
+				glm::uvec2 size;
+				std::vector< glm::u8vec4 > data;
+				load_png(bytes.data(), bytes.size(), &size, &data, LowerLeftOrigin);
+				writer.add_texture(input, size, data.data(), lz4);
+			} else {
+				writer.add(input, type, bytes, lz4);
+			}
+		}
+		writer.save(pack_file);
+	} catch (std::exception const &e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	//------------  report ------------
+
+	uint64_t unpacked = 0, stored = 0;
+	for (AssetPackWriter::Item const &item : writer.items) {
+		unpacked += item.entry.size;
+		stored += item.entry.stored_size;
+		std::printf("  %-40s %-7s %4ux%-4u %10llu bytes%s\n", item.name.c_str(),
+			(item.entry.type == AssetPack::Texture ? "texture" : item.entry.type == AssetPack::Text ? "text" : "data"),
+			item.entry.width, item.entry.height, (unsigned long long)item.entry.stored_size,
+			(item.entry.compression == AssetPack::LZ4 ? " (lz4)" : ""));
+	}
+	std::printf("Packed %u files (%.1f MiB as given, %.1f MiB unpacked) into '%s' (%.1f MiB stored) in %.1f ms.\n",
+		uint32_t(writer.items.size()), input_bytes / (1024.0 * 1024.0), unpacked / (1024.0 * 1024.0), pack_file.c_str(),
+		stored / (1024.0 * 1024.0), std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+
+	return 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,35 @@
+#include "cpu_features.hpp"
+
+#if defined(CPU_FEATURES_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+CPUFeatures const &cpu_features() {
+	static CPUFeatures features = []() {
+		CPUFeatures ret;
+#if defined(CPU_FEATURES_X86)
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		int leaves = info[0];
+		__cpuid(info, 1);
+		ret.ssse3 = (info[2] & (1 << 9)) != 0;
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		//(the OS also has to save the upper halves of the ymm registers)
+		if (leaves >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+			__cpuidex(info, 7, 0);
+			ret.avx2 = (info[1] & (1 << 5)) != 0;
+		}
+#else
+		__builtin_cpu_init();
+		ret.ssse3 = __builtin_cpu_supports("ssse3");
+		ret.avx2 = __builtin_cpu_supports("avx2");
+#endif
+#elif defined(CPU_FEATURES_NEON)
+		ret.neon = true;
+#endif
+		return ret;
+	}();
+	return features;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+/*
+ * CPU feature detection for the SIMD kernels (see SoftwareRasterizer.hpp
+ *  and image_ops.hpp), so they agree on what this machine can run.
+ *
+ * Including this also pulls in the intrinsics headers and defines:
+ *  CPU_FEATURES_X86 (with <immintrin.h>) on x86, and TARGET_SSSE3 / TARGET_AVX2
+ *   to mark functions that use those instructions without needing the
+ *   whole build to target them;
+ *  CPU_FEATURES_NEON (with <arm_neon.h>) on AArch64, where NEON is always there.
+ */
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CPU_FEATURES_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+//(MSVC emits whatever intrinsics it is asked for, no matter the target)
+#define TARGET_SSSE3
+#define TARGET_AVX2
+#else
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CPU_FEATURES_NEON
+#include <arm_neon.h>
+#endif
+
+struct CPUFeatures {
+	bool ssse3 = false;
+	bool avx2 = false; //(only if the OS also saves the ymm registers)
+	bool neon = false;
+};
+
+//checked once, on first call:
+CPUFeatures const &cpu_features();
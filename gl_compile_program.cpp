@@ -4,6 +4,149 @@
 #include <string>
 #include <stdexcept>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+
+//----- program binary cache -----
+
+static std::string program_cache_directory;
+
+void gl_set_program_cache(std::string const &directory) {
+	program_cache_directory = directory;
+}
+
+//ARB_get_program_binary isn't part of GL 3.3 core, so GL.hpp doesn't declare it:
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH          0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS     0x87FE
+
+typedef void (APIENTRY *PFN_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRY *PFN_glProgramBinary)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+typedef void (APIENTRY *PFN_glProgramParameteri)(GLuint program, GLenum pname, GLint value);
+
+struct ProgramBinaryFunctions {
+	PFN_glGetProgramBinary GetProgramBinary = nullptr;
+	PFN_glProgramBinary ProgramBinary = nullptr;
+	PFN_glProgramParameteri ProgramParameteri = nullptr;
+};
+
+//returns the entry points if the driver can save/load program binaries, nullptr otherwise:
+static ProgramBinaryFunctions const *program_binary_functions() {
+	static bool checked = false;
+	static ProgramBinaryFunctions functions;
+	static bool supported = false;
+	if (!checked) {
+		checked = true;
+		GLint major = 0, minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+		//(core as of GL 4.1)
+		if (gl_extension_supported("GL_ARB_get_program_binary") || major > 4 || (major == 4 && minor >= 1)) {
+			functions.GetProgramBinary = (PFN_glGetProgramBinary)gl_get_proc_address("glGetProgramBinary");
+			functions.ProgramBinary = (PFN_glProgramBinary)gl_get_proc_address("glProgramBinary");
+			functions.ProgramParameteri = (PFN_glProgramParameteri)gl_get_proc_address("glProgramParameteri");
+		}
+		GLint formats = 0;
+		if (functions.GetProgramBinary && functions.ProgramBinary && functions.ProgramParameteri) {
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		}
+		supported = (formats > 0);
+		if (!supported) {
+			std::cerr << "NOTE: driver can't save program binaries; program cache is disabled." << std::endl;
+		}
+	}
+	return (supported ? &functions : nullptr);
+}
+
+//name of the cache file for a given pair of shaders on the current driver:
+static std::string program_cache_path(std::string const &vertex_shader_source, std::string const &fragment_shader_source) {
+	//64-bit FNV-1a hash:
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	auto add = [&hash](char const *str, size_t length) {
+		for (size_t i = 0; i < length; ++i) {
+			hash = (hash ^ uint8_t(str[i])) * 0x100000001b3ULL;
+		}
+		hash = (hash ^ 0xff) * 0x100000001b3ULL; //separator, so "ab"+"c" != "a"+"bc"
+	};
+	add(vertex_shader_source.c_str(), vertex_shader_source.size());
+	add(fragment_shader_source.c_str(), fragment_shader_source.size());
+	for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+		char const *str = reinterpret_cast< char const * >(glGetString(name));
+		if (!str) str = "";
+		add(str, std::char_traits< char >::length(str));
+	}
+
+	char hex[17];
+	std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+	return program_cache_directory + "/" + hex + ".glprogram";
+}
+
+//cache file layout: magic, binary format, binary length, binary data:
+static constexpr uint32_t ProgramCacheMagic = 0x62706c67; //'glpb'
+
+//returns a linked program, or 0 if there wasn't a usable cache entry:
+static GLuint load_cached_program(ProgramBinaryFunctions const &fns, std::string const &path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) return 0;
+
+	uint32_t header[3];
+	if (!file.read(reinterpret_cast< char * >(header), sizeof(header))) return 0;
+	if (header[0] != ProgramCacheMagic) return 0;
+	//check the length against what's actually in the file before allocating, so a truncated or corrupt entry can't ask for gigabytes:
+	std::streamoff data_start = file.tellg();
+	file.seekg(0, std::ios::end);
+	std::streamoff data_end = file.tellg();
+	if (data_start < 0 || data_end - data_start != std::streamoff(header[2])) {
+		std::cerr << "NOTE: cached program binary '" << path << "' is truncated or corrupt; compiling from source." << std::endl;
+		return 0;
+	}
+	file.seekg(data_start);
+	std::vector< char > binary(header[2]);
+	if (!file.read(binary.data(), binary.size())) return 0;
+
+	GLuint program = glCreateProgram();
+	fns.ProgramBinary(program, GLenum(header[1]), binary.data(), GLsizei(binary.size()));
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		//this is expected if (e.g.) the driver was updated without changing its version string:
+		std::cerr << "NOTE: cached program binary '" << path << "' was rejected; compiling from source." << std::endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+static void save_cached_program(ProgramBinaryFunctions const &fns, std::string const &path, GLuint program) {
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+	std::vector< char > binary(length);
+	GLenum format = 0;
+	GLsizei written = 0;
+	fns.GetProgramBinary(program, length, &written, &format, binary.data());
+	if (written <= 0) return;
+
+	//write to a temporary name first, so a crash mid-write can't leave a truncated entry:
+	std::string temp = path + ".tmp";
+	{
+		std::ofstream file(temp, std::ios::binary);
+		uint32_t header[3] = { ProgramCacheMagic, uint32_t(format), uint32_t(written) };
+		file.write(reinterpret_cast< char const * >(header), sizeof(header));
+		file.write(binary.data(), written);
+		if (!file) {
+			std::cerr << "WARNING: failed to write program cache entry '" << temp << "'." << std::endl;
+			return;
+		}
+	}
+	std::remove(path.c_str()); //(rename won't replace an existing file on windows)
+	if (std::rename(temp.c_str(), path.c_str()) != 0) {
+		std::cerr << "WARNING: failed to move program cache entry into place at '" << path << "'." << std::endl;
+		std::remove(temp.c_str());
+	}
+}
+
+//----- compilation -----
 
 static GLuint gl_compile_shader(GLenum type, std::string const &source) {
 	GLuint shader = glCreateShader(type);
@@ -32,6 +175,18 @@ GLuint gl_compile_program(
 	std::string const &fragment_shader_source
 	) {
 
+	ProgramBinaryFunctions const *cache_fns = nullptr;
+	std::string cache_path;
+	if (!program_cache_directory.empty()) {
+		cache_fns = program_binary_functions();
+	}
+	if (cache_fns) {
+		cache_path = program_cache_path(vertex_shader_source, fragment_shader_source);
+		if (GLuint program = load_cached_program(*cache_fns, cache_path)) {
+			return program;
+		}
+	}
+
 	GLuint vertex_shader = gl_compile_shader(GL_VERTEX_SHADER, vertex_shader_source);
 	GLuint fragment_shader = gl_compile_shader(GL_FRAGMENT_SHADER, fragment_shader_source);
 
@@ -43,6 +198,11 @@ GLuint gl_compile_program(
 	glDeleteShader(vertex_shader);
 	glDeleteShader(fragment_shader);
 
+	//ask the driver to keep the linked binary around so it can be cached:
+	if (cache_fns) {
+		cache_fns->ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
 	//link the shader program and throw errors if linking fails:
 	glLinkProgram(program);
 	GLint link_status = GL_FALSE;
@@ -58,5 +218,9 @@ GLuint gl_compile_program(
 		throw std::runtime_error("failed to link program");
 	}
 
+	if (cache_fns) {
+		save_cached_program(*cache_fns, cache_path, program);
+	}
+
 	return program;
 }
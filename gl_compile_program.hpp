@@ -9,3 +9,10 @@
 GLuint gl_compile_program(
 	std::string const &vertex_shader_source,
 	std::string const &fragment_shader_source);
+
+//Optionally, gl_compile_program can keep linked program binaries in a cache directory
+// (via ARB_get_program_binary) and load them instead of compiling on later runs.
+//Cache entries are keyed by a hash of the shader sources and the GL vendor/renderer/version strings;
+// if the extension is missing or a cached binary is rejected, programs are compiled from source as usual.
+//Pass an empty string (the default) to disable the cache. The directory must already exist.
+void gl_set_program_cache(std::string const &directory);
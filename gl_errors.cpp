@@ -0,0 +1,106 @@
+#include "gl_errors.hpp"
+
+#include <vector>
+
+//KHR_debug / ARB_debug_output aren't part of GL 3.3 core, so GL.hpp doesn't declare them:
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS       0x8242
+#define GL_DEBUG_SOURCE_APPLICATION       0x824A
+#define GL_DEBUG_TYPE_ERROR               0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR  0x824E
+#define GL_DEBUG_TYPE_PORTABILITY         0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE         0x8250
+#define GL_DEBUG_TYPE_PUSH_GROUP          0x8269
+#define GL_DEBUG_TYPE_POP_GROUP           0x826A
+#define GL_DEBUG_SEVERITY_NOTIFICATION    0x826B
+#define GL_DEBUG_SEVERITY_HIGH            0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM          0x9147
+#define GL_DEBUG_SEVERITY_LOW             0x9148
+#define GL_DEBUG_OUTPUT                   0x92E0
+#define GL_CONTEXT_FLAG_DEBUG_BIT         0x00000002
+
+typedef void (APIENTRY *PFN_GLDEBUGPROC)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam);
+typedef void (APIENTRY *PFN_glDebugMessageCallback)(PFN_GLDEBUGPROC callback, const void *userParam);
+typedef void (APIENTRY *PFN_glPushDebugGroup)(GLenum source, GLuint id, GLsizei length, const GLchar *message);
+typedef void (APIENTRY *PFN_glPopDebugGroup)();
+
+bool gl_debug_output_installed = false;
+
+//only set with KHR_debug (ARB_debug_output has no groups):
+static PFN_glPushDebugGroup PushDebugGroup = nullptr;
+static PFN_glPopDebugGroup PopDebugGroup = nullptr;
+
+//locations of the currently-open GLDebugGroups, innermost last:
+// (callback is synchronous, so this matches whatever command caused the message)
+static std::vector< char const * > group_stack;
+
+static void APIENTRY gl_debug_message(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam) {
+	//groups are tracked in group_stack; notifications are mostly (very chatty) driver info:
+	if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP) return;
+	if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return;
+
+	char const *type_str = "other";
+	if (type == GL_DEBUG_TYPE_ERROR) type_str = "error";
+	else if (type == GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR) type_str = "deprecated";
+	else if (type == GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR) type_str = "undefined behavior";
+	else if (type == GL_DEBUG_TYPE_PORTABILITY) type_str = "portability";
+	else if (type == GL_DEBUG_TYPE_PERFORMANCE) type_str = "performance";
+
+	char const *severity_str = "";
+	if (severity == GL_DEBUG_SEVERITY_HIGH) severity_str = " (high)";
+	else if (severity == GL_DEBUG_SEVERITY_MEDIUM) severity_str = " (medium)";
+	else if (severity == GL_DEBUG_SEVERITY_LOW) severity_str = " (low)";
+
+	std::cerr << "WARNING: gl " << type_str << severity_str << " at "
+	          << (group_stack.empty() ? "(no GL_DEBUG_GROUP)" : group_stack.back()) << ": "
+	          << std::string(message, length < 0 ? std::char_traits< char >::length(message) : size_t(length)) << std::endl;
+}
+
+bool gl_debug_output_install() {
+	if (gl_debug_output_installed) return true;
+
+	//messages are only guaranteed in debug contexts (main.cpp asks for one):
+	GLint flags = 0;
+	glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+	if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT)) {
+		std::cerr << "NOTE: GL context is not a debug context; messages may be missing." << std::endl;
+	}
+
+	PFN_glDebugMessageCallback DebugMessageCallback = nullptr;
+	bool khr = false;
+	if (gl_extension_supported("GL_KHR_debug")) {
+		DebugMessageCallback = (PFN_glDebugMessageCallback)gl_get_proc_address("glDebugMessageCallback");
+		PushDebugGroup = (PFN_glPushDebugGroup)gl_get_proc_address("glPushDebugGroup");
+		PopDebugGroup = (PFN_glPopDebugGroup)gl_get_proc_address("glPopDebugGroup");
+		khr = (DebugMessageCallback && PushDebugGroup && PopDebugGroup);
+		if (!khr) PushDebugGroup = nullptr, PopDebugGroup = nullptr;
+	}
+	if (!khr && gl_extension_supported("GL_ARB_debug_output")) {
+		DebugMessageCallback = (PFN_glDebugMessageCallback)gl_get_proc_address("glDebugMessageCallbackARB");
+	}
+	if (!DebugMessageCallback) {
+		std::cerr << "NOTE: neither KHR_debug nor ARB_debug_output is available; GL errors will be polled." << std::endl;
+		return false;
+	}
+
+	//clear out anything that happened before the callback was there to see it:
+	gl_errors("before gl_debug_output_install()");
+
+	if (khr) glEnable(GL_DEBUG_OUTPUT);
+	//deliver messages on the thread (and during the call) that caused them:
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	DebugMessageCallback(gl_debug_message, nullptr);
+
+	gl_debug_output_installed = true;
+	return true;
+}
+
+GLDebugGroup::GLDebugGroup(char const *where) {
+	group_stack.emplace_back(where);
+	if (PushDebugGroup) PushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, where);
+}
+
+GLDebugGroup::~GLDebugGroup() {
+	if (PopDebugGroup) PopDebugGroup();
+	group_stack.pop_back();
+}
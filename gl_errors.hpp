@@ -2,11 +2,30 @@
 
 #include "GL.hpp"
 #include <iostream>
+#include <string>
 
 #define STR2(X) # X
 #define STR(X) STR2(X)
 
+//Optionally, GL errors can be reported by the driver as they happen, through a
+// KHR_debug (or ARB_debug_output) message callback, instead of by polling glGetError:
+//gl_debug_output_install() installs the callback if the context supports it (returns false if not).
+// Once it is installed, GL_ERRORS() no longer calls glGetError (which can force a sync point),
+// and messages are printed along with the location of the innermost GL_DEBUG_GROUP.
+bool gl_debug_output_install();
+extern bool gl_debug_output_installed;
+
+//GLDebugGroup marks the commands issued during its lifetime with 'where'
+// (pushed as a KHR_debug group, when available, so it also shows up in tools like RenderDoc):
+struct GLDebugGroup {
+	GLDebugGroup(char const *where);
+	~GLDebugGroup();
+};
+
 inline void gl_errors(std::string const &where) {
+	//debug output callback is already reporting errors:
+	if (gl_debug_output_installed) return;
+
 	GLenum err = 0;
 	while ((err = glGetError()) != GL_NO_ERROR) {
 		#define CHECK( ERR ) \
@@ -27,5 +46,16 @@ inline void gl_errors(std::string const &where) {
 		#undef CHECK
 	}
 }
-#define GL_ERRORS() gl_errors(__FILE__  ":" STR(__LINE__) )
 
+#define GL_CAT2(A, B) A ## B
+#define GL_CAT(A, B) GL_CAT2(A, B)
+
+//In release builds (NDEBUG), error polling and debug groups compile to nothing;
+// gl_debug_output_install() still works there if driver messages are wanted.
+#ifdef NDEBUG
+#define GL_ERRORS() do { } while (0)
+#define GL_DEBUG_GROUP( NAME ) do { } while (0)
+#else
+#define GL_ERRORS() gl_errors(__FILE__  ":" STR(__LINE__) )
+#define GL_DEBUG_GROUP( NAME ) GLDebugGroup GL_CAT(gl_debug_group_, __LINE__)( NAME " at " __FILE__ ":" STR(__LINE__) )
+#endif
@@ -0,0 +1,217 @@
+//gl-replay: re-issue a GL command stream recorded with 'pong --gl-record <file> <frames>'
+// as fast as possible, and report how long the driver took per frame.
+
+#include "GLReplay.hpp"
+#include "HeadlessContext.hpp"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	std::string filename;
+	uint32_t loops = 10;
+	bool headless = false;
+	glm::uvec2 headless_size = glm::uvec2(640, 480);
+	GLLoaderBackend gl_loader = GLLoaderAuto;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--loops" && argi + 1 < argc) {
+			//replay the frames after the first (which holds all the setup calls) this many times:
+			loops = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--headless" && argi + 1 < argc) {
+			//replay into a WxH framebuffer on a context with no window (e.g. on a machine with no display):
+			unsigned int w = 0, h = 0;
+			if (std::sscanf(argv[argi+1], "%ux%u", &w, &h) != 2 || w == 0 || h == 0) {
+				std::cerr << "Expecting a size like '640x480' after --headless, got '" << argv[argi+1] << "'." << std::endl;
+				return 1;
+			}
+			headless = true;
+			headless_size = glm::uvec2(w, h);
+			argi += 1;
+		} else if (arg == "--gl-loader" && argi + 1 < argc) {
+			//where to look up GL functions on Linux (osmesa has no windows, so also means --headless, at 640x480 unless given):
+			std::string name = argv[argi+1];
+			if (name == "egl") gl_loader = GLLoaderEGL;
+			else if (name == "glx") gl_loader = GLLoaderGLX;
+			else if (name == "osmesa") gl_loader = GLLoaderOSMesa, headless = true;
+			else {
+				std::cerr << "Expecting 'egl', 'glx', or 'osmesa' after --gl-loader, got '" << name << "'." << std::endl;
+				return 1;
+			}
+			argi += 1;
+		} else if (filename.empty() && arg.substr(0,2) != "--") {
+			filename = arg;
+		} else {
+			filename.clear();
+			break;
+		}
+	}
+	if (filename.empty()) {
+		std::cerr << "Usage:\n"
+		             "  " << argv[0] << " <recording> [--loops <count>] [--headless <W>x<H>] [--gl-loader egl|glx|osmesa]" << std::endl;
+		return 1;
+	}
+
+	//------------  initialization ------------
+
+	//same context as the game asks for; in a hidden window, or (on machines with no display) headless:
+	SDL_Window *window = nullptr;
+	SDL_GLContext context = 0;
+	std::unique_ptr< HeadlessContext > headless_context;
+
+	if (!headless) {
+		if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+			std::cerr << "NOTE: no SDL video (" << SDL_GetError() << "); replaying headless." << std::endl;
+			headless = true;
+		}
+	}
+
+	if (!headless) {
+		SDL_GL_ResetAttributes();
+		SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+		SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+		//(the window is never shown; it's just there to hold the context)
+		window = SDL_CreateWindow(
+			"gl-replay",
+			SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+			640, 480,
+			SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+		);
+		if (!window) {
+			std::cerr << "NOTE: couldn't create a window (" << SDL_GetError() << "); replaying headless." << std::endl;
+			headless = true;
+		}
+	}
+
+	if (!headless) {
+		context = SDL_GL_CreateContext(window);
+		if (!context) {
+			SDL_DestroyWindow(window);
+			std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+			return 1;
+		}
+
+		try {
+			init_GL(gl_loader);
+		} catch (std::exception const &e) {
+			SDL_GL_DeleteContext(context);
+			SDL_DestroyWindow(window);
+			std::cerr << "Error loading OpenGL: " << e.what() << std::endl;
+			return 1;
+		}
+
+		SDL_GL_SetSwapInterval(0);
+	} else {
+		try {
+			//(also calls init_GL)
+			headless_context.reset(new HeadlessContext(headless_size, gl_loader));
+		} catch (std::exception const &e) {
+			std::cerr << "Error creating headless OpenGL context: " << e.what() << std::endl;
+			return 1;
+		}
+	}
+
+	//(on the way out, including after errors, so the context and window are always released)
+	auto teardown = [&]() {
+		headless_context.reset();
+		if (context) SDL_GL_DeleteContext(context);
+		if (window) SDL_DestroyWindow(window);
+	};
+
+	std::cout << "GL_RENDERER: " << reinterpret_cast< char const * >(glGetString(GL_RENDERER)) << "\n"
+	          << "GL_VERSION: " << reinterpret_cast< char const * >(glGetString(GL_VERSION)) << std::endl;
+
+	//------------  replay ------------
+
+	//(throws for a missing or damaged file, or one recorded with a different GL.hpp)
+	std::unique_ptr< GLReplay > loaded;
+	try {
+		loaded.reset(new GLReplay(filename));
+	} catch (std::exception const &e) {
+		std::cerr << "Error loading '" << filename << "': " << e.what() << std::endl;
+		teardown();
+		return 1;
+	}
+	GLReplay &replay = *loaded;
+	//(a surfaceless context has no default framebuffer, so draws to it go to the headless one instead)
+	if (headless_context) replay.default_framebuffer = headless_context->framebuffer;
+	std::cout << "Loaded " << replay.calls << " calls over " << replay.frames.size() << " frames from '" << filename << "'." << std::endl;
+	if (replay.frames.empty()) {
+		teardown();
+		return 0;
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	auto milliseconds = [](Clock::duration d) {
+		return std::chrono::duration< double, std::milli >(d).count();
+	};
+
+	{ //first frame also creates all the objects, so is reported separately:
+		auto before = Clock::now();
+		replay.replay_frame(0);
+		glFinish();
+		std::cout << "First frame (with setup): " << milliseconds(Clock::now() - before) << " ms." << std::endl;
+	}
+
+	std::vector< double > times;
+	uint64_t calls = 0;
+	for (uint32_t loop = 0; loop < loops; ++loop) {
+		for (size_t f = 1; f < replay.frames.size(); ++f) {
+			auto before = Clock::now();
+			replay.replay_frame(f);
+			glFinish();
+			times.emplace_back(milliseconds(Clock::now() - before));
+			calls += replay.frames[f].size();
+		}
+	}
+
+	if (!times.empty()) {
+		double total = 0.0;
+		for (double t : times) total += t;
+		std::sort(times.begin(), times.end());
+		std::cout << "Replayed " << times.size() << " frames (" << calls << " calls) in " << total << " ms:\n"
+		          << "  per frame: min " << times.front() << " ms, median " << times[times.size() / 2] << " ms, mean " << (total / times.size()) << " ms, max " << times.back() << " ms\n"
+		          << "  " << (calls / (total / 1000.0)) << " calls/second" << std::endl;
+	}
+
+	//------------  teardown ------------
+
+	teardown();
+
+	return 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,146 @@
+//image-bench: time each image_ops kernel (see image_ops.hpp) with every kernel set this CPU supports,
+// on 1080p and 4K frames, and check that the SIMD versions give exactly what the scalar ones do.
+
+#include "image_ops.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	uint32_t repeats = 20;
+	std::vector< glm::uvec2 > sizes = { glm::uvec2(1920, 1080), glm::uvec2(3840, 2160) };
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--repeats" && argi + 1 < argc) {
+			repeats = std::max(1u, uint32_t(std::stoul(argv[argi+1])));
+			argi += 1;
+		} else if (arg == "--size" && argi + 1 < argc) {
+			//(instead of 1080p and 4K; odd sizes exercise the kernels' leftover handling)
+			unsigned int w = 0, h = 0;
+			if (std::sscanf(argv[argi+1], "%ux%u", &w, &h) != 2 || w == 0 || h == 0) {
+				std::cerr << "Expecting a size like '1280x720' after --size, got '" << argv[argi+1] << "'." << std::endl;
+				return 1;
+			}
+			sizes = { glm::uvec2(w, h) };
+			argi += 1;
+		} else {
+			std::cerr << "Usage:\n"
+			             "  " << argv[0] << " [--repeats <count>] [--size <W>x<H>]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector< ImageSimd > simds;
+	for (ImageSimd simd : { ImageScalar, ImageSSSE3, ImageAVX2, ImageNEON }) {
+		if (image_simd_supported(simd)) simds.emplace_back(simd);
+	}
+
+	//------------  benchmark ------------
+
+	typedef std::chrono::high_resolution_clock Clock;
+
+	bool all_ok = true;
+	for (glm::uvec2 size : sizes) {
+		//(the kernels don't care what the pixels are, but the checks are better with varied ones)
+		std::vector< glm::u8vec4 > image(size.x * size.y);
+		std::mt19937 mt(0x15466);
+		for (auto &px : image) {
+			uint32_t bits = mt();
+			px = glm::u8vec4(bits, bits >> 8, bits >> 16, bits >> 24);
+		}
+		double mpixels = size.x * double(size.y) / 1.0e6;
+		std::cout << size.x << "x" << size.y << " (median of " << repeats << "):" << std::endl;
+
+		//each kernel runs on a fresh copy of the image (copied outside the timing), and leaves bytes to compare:
+		struct Kernel {
+			std::string name;
+			std::function< void(std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) > run;
+		};
+		std::vector< uint8_t > rgb(size.x * size.y * 3);
+		std::vector< glm::u8vec4 > small;
+		glm::uvec2 small_size;
+		auto bytes_of = [](std::vector< glm::u8vec4 > const &pixels, std::vector< uint8_t > *result) {
+			uint8_t const *begin = reinterpret_cast< uint8_t const * >(pixels.data());
+			result->assign(begin, begin + pixels.size() * 4);
+		};
+		std::vector< Kernel > kernels = {
+			{ "flip rows", [&](std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) {
+				image_flip_rows(size, pixels.data(), simd);
+				if (result) bytes_of(pixels, result);
+			} },
+			{ "fill alpha", [&](std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) {
+				image_fill_alpha(pixels.data(), pixels.size(), 0xff, simd);
+				if (result) bytes_of(pixels, result);
+			} },
+			{ "pack rgb", [&](std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) {
+				image_pack_rgb(pixels.data(), pixels.size(), rgb.data(), simd);
+				if (result) *result = rgb;
+			} },
+			{ "downscale 2x", [&](std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) {
+				image_downscale(size, pixels.data(), 2, &small_size, &small, simd);
+				if (result) bytes_of(small, result);
+			} },
+			{ "downscale 4x", [&](std::vector< glm::u8vec4 > &pixels, ImageSimd simd, std::vector< uint8_t > *result) {
+				image_downscale(size, pixels.data(), 4, &small_size, &small, simd);
+				if (result) bytes_of(small, result);
+			} },
+		};
+
+		for (Kernel const &kernel : kernels) {
+			double scalar_ms = 0.0;
+			std::vector< uint8_t > expected;
+			for (ImageSimd simd : simds) {
+				std::vector< glm::u8vec4 > pixels;
+				std::vector< double > times;
+				for (uint32_t r = 0; r < repeats; ++r) {
+					pixels = image;
+					auto before = Clock::now();
+					kernel.run(pixels, simd, nullptr);
+					times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+				}
+				std::sort(times.begin(), times.end());
+				double ms = times[times.size() / 2];
+
+				pixels = image;
+				std::vector< uint8_t > result;
+				kernel.run(pixels, simd, &result);
+				bool ok = true;
+				if (simd == ImageScalar) {
+					scalar_ms = ms;
+					expected = result;
+				} else {
+					ok = (result == expected);
+				}
+				all_ok = all_ok && ok;
+
+				std::printf("  %-14s %-7s %8.3f ms %9.1f Mpix/s %6.2fx%s\n", kernel.name.c_str(), image_simd_name(simd),
+					ms, mpixels / (ms / 1000.0), scalar_ms / ms, ok ? "" : "  DOES NOT MATCH SCALAR");
+			}
+		}
+	}
+
+	return all_ok ? 0 : 1;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,367 @@
+#include "image_ops.hpp"
+#include "cpu_features.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+//------------ which kernels ------------
+
+bool image_simd_supported(ImageSimd simd) {
+	if (simd == ImageScalar) return true;
+#if defined(CPU_FEATURES_X86)
+	if (simd == ImageSSSE3) return cpu_features().ssse3;
+	if (simd == ImageAVX2) return cpu_features().avx2;
+#elif defined(CPU_FEATURES_NEON)
+	if (simd == ImageNEON) return cpu_features().neon;
+#endif
+	return false;
+}
+
+ImageSimd image_best_simd() {
+	static ImageSimd best = []() {
+		for (ImageSimd simd : { ImageNEON, ImageAVX2, ImageSSSE3 }) {
+			if (image_simd_supported(simd)) return simd;
+		}
+		return ImageScalar;
+	}();
+	return best;
+}
+
+char const *image_simd_name(ImageSimd simd) {
+	if (simd == ImageSSSE3) return "SSSE3";
+	if (simd == ImageAVX2) return "AVX2";
+	if (simd == ImageNEON) return "NEON";
+	return "scalar";
+}
+
+//------------ scalar ------------
+
+static void flip_rows_scalar(glm::u8vec4 *top, glm::u8vec4 *bottom, uint32_t count) {
+	std::swap_ranges(top, top + count, bottom);
+}
+
+static void fill_alpha_scalar(glm::u8vec4 *pixels, size_t count, uint8_t alpha) {
+	for (size_t i = 0; i < count; ++i) {
+		pixels[i].a = alpha;
+	}
+}
+
+static void pack_rgb_scalar(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb) {
+	for (size_t i = 0; i < count; ++i) {
+		rgb[3*i+0] = pixels[i].r;
+		rgb[3*i+1] = pixels[i].g;
+		rgb[3*i+2] = pixels[i].b;
+	}
+}
+
+//Downscaling works a row of blocks at a time: the block's rows are summed (per channel, as 16-bit)
+// into 'sums', then each run of 'factor' pixels in 'sums' is added up and divided to make an output pixel.
+// (at most 16 * 255 per channel, so 16 bits is plenty)
+
+static void sum_row_scalar(uint8_t const *row, size_t bytes, uint16_t *sums, bool first) {
+	for (size_t i = 0; i < bytes; ++i) {
+		sums[i] = uint16_t((first ? 0 : sums[i]) + row[i]);
+	}
+}
+
+static void reduce_sums_scalar(uint16_t const *sums, uint32_t factor, uint32_t shift, uint32_t begin, uint32_t end, glm::u8vec4 *out) {
+	for (uint32_t x = begin; x < end; ++x) {
+		for (uint32_t c = 0; c < 4; ++c) {
+			uint32_t total = 0;
+			for (uint32_t i = 0; i < factor; ++i) {
+				total += sums[(x * factor + i) * 4 + c];
+			}
+			out[x][c] = uint8_t((total + (1u << (shift - 1))) >> shift);
+		}
+	}
+}
+
+//------------ x86 ------------
+
+#ifdef CPU_FEATURES_X86
+
+TARGET_SSSE3
+static void flip_rows_ssse3(glm::u8vec4 *top, glm::u8vec4 *bottom, uint32_t count) {
+	uint32_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i a = _mm_loadu_si128(reinterpret_cast< __m128i const * >(top + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast< __m128i const * >(bottom + i));
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(top + i), b);
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(bottom + i), a);
+	}
+	flip_rows_scalar(top + i, bottom + i, count - i);
+}
+
+TARGET_AVX2
+static void flip_rows_avx2(glm::u8vec4 *top, glm::u8vec4 *bottom, uint32_t count) {
+	uint32_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i a = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(top + i));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(bottom + i));
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(top + i), b);
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(bottom + i), a);
+	}
+	flip_rows_scalar(top + i, bottom + i, count - i);
+}
+
+TARGET_SSSE3
+static void fill_alpha_ssse3(glm::u8vec4 *pixels, size_t count, uint8_t alpha) {
+	//(alpha is the high byte of each little-endian 32-bit pixel)
+	__m128i keep = _mm_set1_epi32(0x00ffffff);
+	__m128i a = _mm_set1_epi32(int32_t(uint32_t(alpha) << 24));
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i *p = reinterpret_cast< __m128i * >(pixels + i);
+		_mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(p), keep), a));
+	}
+	fill_alpha_scalar(pixels + i, count - i, alpha);
+}
+
+TARGET_AVX2
+static void fill_alpha_avx2(glm::u8vec4 *pixels, size_t count, uint8_t alpha) {
+	__m256i keep = _mm256_set1_epi32(0x00ffffff);
+	__m256i a = _mm256_set1_epi32(int32_t(uint32_t(alpha) << 24));
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i *p = reinterpret_cast< __m256i * >(pixels + i);
+		_mm256_storeu_si256(p, _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256(p), keep), a));
+	}
+	fill_alpha_scalar(pixels + i, count - i, alpha);
+}
+
+TARGET_SSSE3
+static void pack_rgb_ssse3(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb) {
+	//gathers the RGB of four pixels into the low 12 bytes (and zeros the rest):
+	__m128i gather = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		__m128i const *p = reinterpret_cast< __m128i const * >(pixels + i);
+		__m128i a = _mm_shuffle_epi8(_mm_loadu_si128(p + 0), gather);
+		__m128i b = _mm_shuffle_epi8(_mm_loadu_si128(p + 1), gather);
+		__m128i c = _mm_shuffle_epi8(_mm_loadu_si128(p + 2), gather);
+		__m128i d = _mm_shuffle_epi8(_mm_loadu_si128(p + 3), gather);
+		//(48 bytes: a's 12, b's 12, c's 12, d's 12)
+		__m128i *out = reinterpret_cast< __m128i * >(rgb + 3 * i);
+		_mm_storeu_si128(out + 0, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+		_mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+		_mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+	}
+	pack_rgb_scalar(pixels + i, count - i, rgb + 3 * i);
+}
+
+TARGET_AVX2
+static void pack_rgb_avx2(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb) {
+	//gathers each 128-bit lane's RGB into its low 12 bytes, then the lanes' 12 bytes into the low 24:
+	__m256i gather = _mm256_setr_epi8(
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+	);
+	__m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i p = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(pixels + i));
+		__m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(p, gather), compact);
+		uint8_t *out = rgb + 3 * i;
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(out), _mm256_castsi256_si128(packed));
+		_mm_storel_epi64(reinterpret_cast< __m128i * >(out + 16), _mm256_extracti128_si256(packed, 1));
+	}
+	pack_rgb_ssse3(pixels + i, count - i, rgb + 3 * i);
+}
+
+TARGET_SSSE3
+static void sum_row_ssse3(uint8_t const *row, size_t bytes, uint16_t *sums, bool first) {
+	__m128i zero = _mm_setzero_si128();
+	size_t i = 0;
+	for (; i + 16 <= bytes; i += 16) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast< __m128i const * >(row + i));
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		__m128i *s = reinterpret_cast< __m128i * >(sums + i);
+		if (!first) {
+			lo = _mm_add_epi16(lo, _mm_loadu_si128(s));
+			hi = _mm_add_epi16(hi, _mm_loadu_si128(s + 1));
+		}
+		_mm_storeu_si128(s, lo);
+		_mm_storeu_si128(s + 1, hi);
+	}
+	sum_row_scalar(row + i, bytes - i, sums + i, first);
+}
+
+TARGET_AVX2
+static void sum_row_avx2(uint8_t const *row, size_t bytes, uint16_t *sums, bool first) {
+	size_t i = 0;
+	for (; i + 16 <= bytes; i += 16) {
+		__m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< __m128i const * >(row + i)));
+		__m256i *s = reinterpret_cast< __m256i * >(sums + i);
+		if (!first) v = _mm256_add_epi16(v, _mm256_loadu_si256(s));
+		_mm256_storeu_si256(s, v);
+	}
+	sum_row_scalar(row + i, bytes - i, sums + i, first);
+}
+
+TARGET_SSSE3
+static void reduce_sums_ssse3(uint16_t const *sums, uint32_t factor, uint32_t shift, uint32_t count, glm::u8vec4 *out) {
+	//(each 128-bit load is two pixels' worth of sums; adding a pair's low and high halves adds the pixels)
+	auto pairs = [](__m128i a, __m128i b) {
+		return _mm_add_epi16(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+	};
+	__m128i round = _mm_set1_epi16(short(1 << (shift - 1)));
+	__m128i const *s = reinterpret_cast< __m128i const * >(sums);
+	uint32_t x = 0;
+	for (; x + 2 <= count; x += 2) {
+		__m128i total;
+		if (factor == 2) {
+			total = pairs(_mm_loadu_si128(s + x), _mm_loadu_si128(s + x + 1));
+		} else {
+			__m128i const *q = s + 2 * x;
+			total = pairs(pairs(_mm_loadu_si128(q), _mm_loadu_si128(q + 1)), pairs(_mm_loadu_si128(q + 2), _mm_loadu_si128(q + 3)));
+		}
+		total = _mm_srli_epi16(_mm_add_epi16(total, round), int(shift));
+		_mm_storel_epi64(reinterpret_cast< __m128i * >(out + x), _mm_packus_epi16(total, total));
+	}
+	reduce_sums_scalar(sums, factor, shift, x, count, out);
+}
+
+#endif //CPU_FEATURES_X86
+
+//------------ ARM ------------
+
+#ifdef CPU_FEATURES_NEON
+
+static void flip_rows_neon(glm::u8vec4 *top, glm::u8vec4 *bottom, uint32_t count) {
+	uint32_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		uint8_t *t = reinterpret_cast< uint8_t * >(top + i);
+		uint8_t *b = reinterpret_cast< uint8_t * >(bottom + i);
+		uint8x16_t a = vld1q_u8(t);
+		vst1q_u8(t, vld1q_u8(b));
+		vst1q_u8(b, a);
+	}
+	flip_rows_scalar(top + i, bottom + i, count - i);
+}
+
+static void fill_alpha_neon(glm::u8vec4 *pixels, size_t count, uint8_t alpha) {
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		uint8_t *p = reinterpret_cast< uint8_t * >(pixels + i);
+		uint8x16x4_t v = vld4q_u8(p);
+		v.val[3] = vdupq_n_u8(alpha);
+		vst4q_u8(p, v);
+	}
+	fill_alpha_scalar(pixels + i, count - i, alpha);
+}
+
+static void pack_rgb_neon(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb) {
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		uint8x16x4_t v = vld4q_u8(reinterpret_cast< uint8_t const * >(pixels + i));
+		uint8x16x3_t out;
+		out.val[0] = v.val[0];
+		out.val[1] = v.val[1];
+		out.val[2] = v.val[2];
+		vst3q_u8(rgb + 3 * i, out);
+	}
+	pack_rgb_scalar(pixels + i, count - i, rgb + 3 * i);
+}
+
+static void sum_row_neon(uint8_t const *row, size_t bytes, uint16_t *sums, bool first) {
+	size_t i = 0;
+	for (; i + 8 <= bytes; i += 8) {
+		uint8x8_t v = vld1_u8(row + i);
+		vst1q_u16(sums + i, first ? vmovl_u8(v) : vaddw_u8(vld1q_u16(sums + i), v));
+	}
+	sum_row_scalar(row + i, bytes - i, sums + i, first);
+}
+
+#endif //CPU_FEATURES_NEON
+
+//------------ dispatch ------------
+
+void image_flip_rows(glm::uvec2 const &size, glm::u8vec4 *pixels, ImageSimd simd) {
+	auto flip = flip_rows_scalar;
+#ifdef CPU_FEATURES_X86
+	if (simd == ImageAVX2) flip = flip_rows_avx2;
+	else if (simd == ImageSSSE3) flip = flip_rows_ssse3;
+#endif
+#ifdef CPU_FEATURES_NEON
+	if (simd == ImageNEON) flip = flip_rows_neon;
+#endif
+	for (uint32_t y = 0; y < size.y / 2; ++y) {
+		flip(pixels + size_t(y) * size.x, pixels + size_t(size.y - 1 - y) * size.x, size.x);
+	}
+}
+
+void image_fill_alpha(glm::u8vec4 *pixels, size_t count, uint8_t alpha, ImageSimd simd) {
+#ifdef CPU_FEATURES_X86
+	if (simd == ImageAVX2) {
+		fill_alpha_avx2(pixels, count, alpha);
+		return;
+	} else if (simd == ImageSSSE3) {
+		fill_alpha_ssse3(pixels, count, alpha);
+		return;
+	}
+#endif
+#ifdef CPU_FEATURES_NEON
+	if (simd == ImageNEON) {
+		fill_alpha_neon(pixels, count, alpha);
+		return;
+	}
+#endif
+	fill_alpha_scalar(pixels, count, alpha);
+}
+
+void image_pack_rgb(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb, ImageSimd simd) {
+#ifdef CPU_FEATURES_X86
+	if (simd == ImageAVX2) {
+		pack_rgb_avx2(pixels, count, rgb);
+		return;
+	} else if (simd == ImageSSSE3) {
+		pack_rgb_ssse3(pixels, count, rgb);
+		return;
+	}
+#endif
+#ifdef CPU_FEATURES_NEON
+	if (simd == ImageNEON) {
+		pack_rgb_neon(pixels, count, rgb);
+		return;
+	}
+#endif
+	pack_rgb_scalar(pixels, count, rgb);
+}
+
+void image_downscale(glm::uvec2 const &size, glm::u8vec4 const *pixels, uint32_t factor,
+	glm::uvec2 *out_size, std::vector< glm::u8vec4 > *out, ImageSimd simd) {
+	if (factor != 2 && factor != 4) {
+		throw std::runtime_error("image_downscale only does factors of 2 and 4 (not " + std::to_string(factor) + ").");
+	}
+	uint32_t shift = (factor == 2 ? 2 : 4); //(divide by factor * factor)
+	*out_size = size / factor;
+	out->resize(size_t(out_size->x) * out_size->y);
+
+	auto sum_row = sum_row_scalar;
+#ifdef CPU_FEATURES_X86
+	if (simd == ImageAVX2) sum_row = sum_row_avx2;
+	else if (simd == ImageSSSE3) sum_row = sum_row_ssse3;
+#endif
+#ifdef CPU_FEATURES_NEON
+	if (simd == ImageNEON) sum_row = sum_row_neon;
+#endif
+
+	size_t bytes = size_t(out_size->x) * factor * 4; //(of each row that gets used)
+	std::vector< uint16_t > sums(bytes);
+	for (uint32_t y = 0; y < out_size->y; ++y) {
+		for (uint32_t r = 0; r < factor; ++r) {
+			uint8_t const *row = reinterpret_cast< uint8_t const * >(pixels + size_t(y * factor + r) * size.x);
+			sum_row(row, bytes, sums.data(), r == 0);
+		}
+		glm::u8vec4 *out_row = out->data() + size_t(y) * out_size->x;
+#ifdef CPU_FEATURES_X86
+		if (simd == ImageAVX2 || simd == ImageSSSE3) {
+			reduce_sums_ssse3(sums.data(), factor, shift, out_size->x, out_row);
+			continue;
+		}
+#endif
+		reduce_sums_scalar(sums.data(), factor, shift, 0, out_size->x, out_row);
+	}
+}
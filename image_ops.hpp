@@ -0,0 +1,36 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Small kernels for whole-image work that happens on every captured frame
+ *  (or screenshot, or thumbnail), on tightly packed RGBA8 pixels.
+ *
+ * Each has a scalar version and SIMD versions (SSSE3 and AVX2 on x86,
+ *  NEON on AArch64); by default the fastest one the CPU supports is used.
+ *  Run 'image-bench' to check them against each other and time them.
+ */
+
+//kernel sets, from slowest to fastest (NEON is the only one on ARM):
+enum ImageSimd { ImageScalar, ImageSSSE3, ImageAVX2, ImageNEON };
+bool image_simd_supported(ImageSimd simd);
+ImageSimd image_best_simd();
+char const *image_simd_name(ImageSimd simd);
+
+//swap rows top-to-bottom (e.g. between GL's lower-left origin and an upper-left one), in place:
+void image_flip_rows(glm::uvec2 const &size, glm::u8vec4 *pixels, ImageSimd simd = image_best_simd());
+
+//set every pixel's alpha to 'alpha' (e.g. to make a read-back frame opaque):
+void image_fill_alpha(glm::u8vec4 *pixels, size_t count, uint8_t alpha = 0xff, ImageSimd simd = image_best_simd());
+
+//drop alpha, writing 'count' * 3 bytes of RGB to 'rgb':
+void image_pack_rgb(glm::u8vec4 const *pixels, size_t count, uint8_t *rgb, ImageSimd simd = image_best_simd());
+
+//average each 'factor' x 'factor' block of pixels (rounded), for 'factor' 2 or 4; throws on other factors:
+// the result is size / factor (rounded down -- leftover rows and columns are ignored), with rows in the same order.
+void image_downscale(glm::uvec2 const &size, glm::u8vec4 const *pixels, uint32_t factor,
+	glm::uvec2 *out_size, std::vector< glm::u8vec4 > *out, ImageSimd simd = image_best_simd());
@@ -1,43 +1,76 @@
 #include "load_save_png.hpp"
 
 #include <png.h>
+#include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <fstream>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 #define LOG_ERROR( X ) std::cerr << X << std::endl
 
 using std::vector;
 
-bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< glm::u8vec4 > *data, OriginLocation origin);
 void save_png(std::ostream &to, unsigned int width, unsigned int height, glm::u8vec4 const *data, OriginLocation origin);
 
-void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
-	assert(size);
-
-	std::ifstream file(filename.c_str(), std::ios::binary);
+//(reading the whole file at once is much cheaper than libpng asking for a few bytes at a time)
+static vector< uint8_t > read_file(std::string const &filename) {
+	std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
 	if (!file) {
 		throw std::runtime_error("Failed to open PNG image file '" + filename + "'.");
 	}
-	if (!load_png(file, &size->x, &size->y, data, origin)) {
+	vector< uint8_t > bytes(size_t(file.tellg()));
+	file.seekg(0);
+	if (!file.read(reinterpret_cast< char * >(bytes.data()), bytes.size())) {
+		throw std::runtime_error("Failed to read PNG image file '" + filename + "'.");
+	}
+	return bytes;
+}
+
+void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
+	assert(size);
+
+	vector< uint8_t > bytes = read_file(filename);
+	try {
+		load_png(bytes.data(), bytes.size(), size, data, origin);
+	} catch (std::exception const &) {
 		throw std::runtime_error("Failed to read PNG image from '" + filename + "'.");
 	}
 }
 
+void load_png(std::string const &filename, PNGDestination const &destination, OriginLocation origin) {
+	vector< uint8_t > bytes = read_file(filename);
+	load_png(bytes.data(), bytes.size(), destination, origin);
+}
+
 void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin) {
 	std::ofstream file(filename.c_str(), std::ios::binary);
 	save_png(file, size.x, size.y, data, origin);
 }
 
 
+struct MemoryReader {
+	uint8_t const *at;
+	size_t remaining;
+};
+
 static void user_read_data(png_structp png_ptr, png_bytep data, png_size_t length) {
-	std::istream *from = reinterpret_cast< std::istream * >(png_get_io_ptr(png_ptr));
+	MemoryReader *from = reinterpret_cast< MemoryReader * >(png_get_io_ptr(png_ptr));
 	assert(from);
-	if (!from->read(reinterpret_cast< char * >(data), length)) {
-		png_error(png_ptr, "Error reading.");
+	if (length > from->remaining) {
+		png_error(png_ptr, "Error reading (PNG data is truncated).");
 	}
+	std::memcpy(data, from->at, length);
+	from->at += length;
+	from->remaining -= length;
 }
 
 static void user_write_data(png_structp png_ptr, png_bytep data, png_size_t length) {
@@ -57,36 +90,26 @@ static void user_flush_data(png_structp png_ptr) {
 }
 
 
-bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< glm::u8vec4 > *data, OriginLocation origin) {
-	assert(data);
-	uint32_t local_width, local_height;
-	if (width == nullptr) width = &local_width;
-	if (height == nullptr) height = &local_height;
-	*width = *height = 0;
-	data->clear();
+void load_png(uint8_t const *png_data, size_t bytes, PNGDestination const &destination, OriginLocation origin) {
+	MemoryReader from{ png_data, bytes };
+
 	//..... load file ......
 	//Load a png file, as per the libpng docs:
 	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp)NULL, (png_error_ptr)NULL, (png_error_ptr)NULL);
-
-	png_set_read_fn(png, &from, user_read_data);
-
 	if (!png) {
-		LOG_ERROR("  cannot alloc read struct.");
-		return false;
+		throw std::runtime_error("Cannot alloc PNG read struct.");
 	}
+	png_set_read_fn(png, &from, user_read_data);
+
 	png_infop info = png_create_info_struct(png);
 	if (!info) {
-		LOG_ERROR("  cannot alloc info struct.");
 		png_destroy_read_struct(&png, (png_infopp)NULL, (png_infopp)NULL);
-		return false;
+		throw std::runtime_error("Cannot alloc PNG info struct.");
 	}
-	png_bytep *row_pointers = NULL;
+	vector< png_bytep > row_pointers;
 	if (setjmp(png_jmpbuf(png))) {
-		LOG_ERROR("  png interal error.");
 		png_destroy_read_struct(&png, &info, (png_infopp)NULL);
-		if (row_pointers != NULL) delete[] row_pointers;
-		data->clear();
-		return false;
+		throw std::runtime_error("Failed to decode PNG data.");
 	}
 	//not needed with custom read/write functions: png_init_io(png, NULL);
 	png_read_info(png, info);
@@ -109,22 +132,49 @@ bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vec
 	//Make sure it's the format we think it is...
 	assert(rowbytes == w*sizeof(uint32_t));
 
-	data->resize(w*h);
-	row_pointers = new png_bytep[h];
+	//ask where the rows go:
+	size_t stride = rowbytes;
+	uint8_t *base = nullptr;
+	try {
+		base = reinterpret_cast< uint8_t * >(destination(glm::uvec2(w, h), &stride));
+	} catch (...) {
+		png_destroy_read_struct(&png, &info, NULL);
+		throw;
+	}
+	if (!base) {
+		png_destroy_read_struct(&png, &info, NULL);
+		throw std::runtime_error("No destination for decoded PNG rows.");
+	}
+
+	//(the flip to 'origin' is just the order of the row pointers)
+	row_pointers.resize(h);
 	for (unsigned int r = 0; r < h; ++r) {
 		if (origin == LowerLeftOrigin) {
-			row_pointers[h-1-r] = (png_bytep)(&(*data)[r*w]);
+			row_pointers[h-1-r] = base + r * stride;
 		} else {
-			row_pointers[r] = (png_bytep)(&(*data)[r*w]);
+			row_pointers[r] = base + r * stride;
 		}
 	}
-	png_read_image(png, row_pointers);
+	png_read_image(png, row_pointers.data());
 	png_destroy_read_struct(&png, &info, NULL);
-	delete[] row_pointers;
+}
 
-	*width = w;
-	*height = h;
-	return true;
+void load_png(uint8_t const *png, size_t bytes, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
+	assert(size);
+	assert(data);
+	*size = glm::uvec2(0);
+	data->clear();
+	try {
+		load_png(png, bytes, [&](glm::uvec2 const &size_, size_t *) -> void * {
+			*size = size_;
+			data->resize(size_t(size_.x) * size_.y);
+			return data->data();
+		}, origin);
+	} catch (...) {
+		*size = glm::uvec2(0);
+		data->clear();
+		throw;
+	}
 }
 
 
@@ -173,3 +223,257 @@ void save_png(std::ostream &to, unsigned int width, unsigned int height, glm::u8
 
 	return;
 }
+
+
+//------------ batch loading ------------
+
+PNGBatch::PNGBatch(std::vector< std::string > const &filenames, OriginLocation origin, uint32_t threads) : promises(filenames.size()) {
+	for (auto &promise : promises) {
+		results.emplace_back(promise.get_future());
+	}
+	if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+	threads = std::min(threads, uint32_t(filenames.size()));
+
+	//files are handed out in order, so the first ones are ready first:
+	auto next = std::make_shared< std::atomic< size_t > >(0);
+	for (uint32_t t = 0; t < threads; ++t) {
+		workers.emplace_back([this, filenames, origin, next]() {
+			typedef std::chrono::high_resolution_clock Clock;
+			for (size_t i = (*next)++; i < filenames.size(); i = (*next)++) {
+				try {
+					LoadedPNG loaded;
+					loaded.filename = filenames[i];
+
+					auto before = Clock::now();
+					vector< uint8_t > bytes = read_file(filenames[i]);
+					auto read = Clock::now();
+					try {
+						load_png(bytes.data(), bytes.size(), &loaded.size, &loaded.data, origin);
+					} catch (std::exception const &) {
+						throw std::runtime_error("Failed to read PNG image from '" + filenames[i] + "'.");
+					}
+					auto decoded = Clock::now();
+
+					loaded.read_ms = std::chrono::duration< double, std::milli >(read - before).count();
+					loaded.decode_ms = std::chrono::duration< double, std::milli >(decoded - read).count();
+					promises[i].set_value(std::move(loaded));
+				} catch (...) {
+					promises[i].set_exception(std::current_exception());
+				}
+			}
+		});
+	}
+}
+
+PNGBatch::~PNGBatch() {
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+std::unique_ptr< PNGBatch > load_png_batch(std::vector< std::string > const &filenames, OriginLocation origin, uint32_t threads) {
+	return std::unique_ptr< PNGBatch >(new PNGBatch(filenames, origin, threads));
+}
+
+//------------ parallel encoder ------------
+
+//run 'work' on 'threads' threads (including this one), each calling it with indices until there are none left:
+template< typename F >
+static void parallel_for(uint32_t count, uint32_t threads, F const &work) {
+	std::atomic< uint32_t > next(0);
+	auto run = [&]() {
+		for (uint32_t i = next++; i < count; i = next++) {
+			work(i);
+		}
+	};
+	std::vector< std::thread > helpers;
+	for (uint32_t t = 1; t < std::min(threads, count); ++t) {
+		helpers.emplace_back(run);
+	}
+	run();
+	for (auto &helper : helpers) {
+		helper.join();
+	}
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+	int p = int(a) + int(b) - int(c);
+	int pa = std::abs(p - int(a));
+	int pb = std::abs(p - int(b));
+	int pc = std::abs(p - int(c));
+	if (pa <= pb && pa <= pc) return a;
+	else if (pb <= pc) return b;
+	else return c;
+}
+
+//write filter type 'type' and the filtered row to 'out' ('above' is nullptr for the first row):
+static void filter_row(uint8_t type, uint8_t const *row, uint8_t const *above, uint32_t bytes, uint8_t *out) {
+	const uint32_t Bpp = 4; //(RGBA8)
+	out[0] = type;
+	out += 1;
+	for (uint32_t i = 0; i < bytes; ++i) {
+		uint8_t a = (i >= Bpp ? row[i - Bpp] : 0);
+		uint8_t b = (above ? above[i] : 0);
+		uint8_t c = (above && i >= Bpp ? above[i - Bpp] : 0);
+		uint8_t x = row[i];
+		switch (type) {
+			case 0: out[i] = x; break;
+			case 1: out[i] = uint8_t(x - a); break;
+			case 2: out[i] = uint8_t(x - b); break;
+			case 3: out[i] = uint8_t(x - ((int(a) + int(b)) >> 1)); break;
+			default: out[i] = uint8_t(x - paeth(a, b, c)); break;
+		}
+	}
+}
+
+static void append_u32(std::vector< uint8_t > *out, uint32_t v) {
+	out->emplace_back(uint8_t(v >> 24));
+	out->emplace_back(uint8_t(v >> 16));
+	out->emplace_back(uint8_t(v >> 8));
+	out->emplace_back(uint8_t(v));
+}
+
+static void append_chunk(std::vector< uint8_t > *out, char const *type, uint8_t const *data, size_t length) {
+	append_u32(out, uint32_t(length));
+	size_t start = out->size();
+	out->insert(out->end(), type, type + 4);
+	out->insert(out->end(), data, data + length);
+	append_u32(out, uint32_t(crc32(0, out->data() + start, uInt(out->size() - start))));
+}
+
+void encode_png(glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options, std::vector< uint8_t > *png) {
+	assert(png);
+	if (size.x == 0 || size.y == 0) {
+		throw std::runtime_error("Can't encode an empty PNG image.");
+	}
+	int level = std::max(0, std::min(9, options.compression_level));
+	uint32_t threads = options.threads;
+	if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+	uint32_t row_bytes = size.x * 4;
+	uint32_t stripe_rows = options.stripe_rows;
+	if (stripe_rows == 0) stripe_rows = std::max(1u, (256u * 1024u) / (row_bytes + 1));
+	uint32_t stripes = (size.y + stripe_rows - 1) / stripe_rows;
+
+	//rows in file order (top first):
+	auto row = [&](uint32_t r) {
+		return reinterpret_cast< uint8_t const * >(data + size_t(origin == UpperLeftOrigin ? r : size.y - 1 - r) * size.x);
+	};
+
+	//filter every stripe (each row's filter only looks at the unfiltered row above, so stripes are independent):
+	std::vector< uint8_t > filtered(size_t(size.y) * (row_bytes + 1));
+	parallel_for(stripes, threads, [&](uint32_t stripe) {
+		std::vector< uint8_t > trial(options.filter == PNGSaveOptions::FilterAdaptive ? row_bytes + 1 : 0);
+		uint32_t end = std::min(size.y, (stripe + 1) * stripe_rows);
+		for (uint32_t r = stripe * stripe_rows; r < end; ++r) {
+			uint8_t *out = &filtered[size_t(r) * (row_bytes + 1)];
+			uint8_t const *above = (r > 0 ? row(r - 1) : nullptr);
+			if (options.filter != PNGSaveOptions::FilterAdaptive) {
+				filter_row(uint8_t(options.filter), row(r), above, row_bytes, out);
+				continue;
+			}
+			//(the 'minimum sum of absolute differences' heuristic from the PNG spec)
+			uint64_t best = UINT64_MAX;
+			for (uint8_t type = 0; type <= 4; ++type) {
+				filter_row(type, row(r), above, row_bytes, trial.data());
+				uint64_t sum = 0;
+				for (uint32_t i = 1; i <= row_bytes; ++i) {
+					sum += uint32_t(std::abs(int(int8_t(trial[i]))));
+				}
+				if (sum < best) {
+					best = sum;
+					std::copy(trial.begin(), trial.end(), out);
+				}
+			}
+		}
+	});
+
+	//deflate every stripe as a piece of one raw deflate stream:
+	// each piece but the last ends with a sync flush (so it ends on a byte boundary, without a 'final' block),
+	// and is primed with the 32k before it, so matches can reach back across stripes.
+	std::vector< std::vector< uint8_t > > pieces(stripes);
+	std::vector< uLong > adlers(stripes);
+	std::vector< std::string > errors(stripes);
+	parallel_for(stripes, threads, [&](uint32_t stripe) {
+		size_t begin = size_t(stripe) * stripe_rows * (row_bytes + 1);
+		size_t end = std::min(filtered.size(), size_t(stripe + 1) * stripe_rows * (row_bytes + 1));
+		bool last = (stripe + 1 == stripes);
+
+		adlers[stripe] = adler32(adler32(0, nullptr, 0), &filtered[begin], uInt(end - begin));
+
+		z_stream z;
+		std::memset(&z, 0, sizeof(z));
+		int strategy = (options.filter == PNGSaveOptions::FilterNone ? Z_DEFAULT_STRATEGY : Z_FILTERED);
+		if (deflateInit2(&z, level, Z_DEFLATED, -15, 8, strategy) != Z_OK) {
+			errors[stripe] = "deflateInit2 failed.";
+			return;
+		}
+		if (begin > 0) {
+			size_t dictionary = std::min(begin, size_t(32768));
+			deflateSetDictionary(&z, &filtered[begin - dictionary], uInt(dictionary));
+		}
+		std::vector< uint8_t > &piece = pieces[stripe];
+		//(deflateBound doesn't count the sync flush's empty stored block, so leave room for that too)
+		piece.resize(deflateBound(&z, uLong(end - begin)) + 16);
+		z.next_in = &filtered[begin];
+		z.avail_in = uInt(end - begin);
+		z.next_out = piece.data();
+		z.avail_out = uInt(piece.size());
+		int ret = deflate(&z, last ? Z_FINISH : Z_SYNC_FLUSH);
+		if (ret != (last ? Z_STREAM_END : Z_OK) || z.avail_in != 0) {
+			errors[stripe] = "deflate failed.";
+		}
+		piece.resize(piece.size() - z.avail_out);
+		deflateEnd(&z);
+	});
+	for (std::string const &error : errors) {
+		if (error != "") throw std::runtime_error("Failed to encode PNG: " + error);
+	}
+
+	//the zlib stream's checksum is the adler32 of all the (filtered) data:
+	uLong adler = adlers[0];
+	for (uint32_t stripe = 1; stripe < stripes; ++stripe) {
+		size_t begin = size_t(stripe) * stripe_rows * (row_bytes + 1);
+		size_t end = std::min(filtered.size(), size_t(stripe + 1) * stripe_rows * (row_bytes + 1));
+		adler = adler32_combine(adler, adlers[stripe], z_off_t(end - begin));
+	}
+
+	//------ assemble the file ------
+	png->clear();
+	size_t total = 8 + 25 + 12 + 2 + 4 + 12;
+	for (auto const &piece : pieces) total += piece.size() + 12;
+	png->reserve(total);
+
+	static uint8_t const Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	png->insert(png->end(), Signature, Signature + 8);
+
+	std::vector< uint8_t > ihdr;
+	append_u32(&ihdr, size.x);
+	append_u32(&ihdr, size.y);
+	ihdr.insert(ihdr.end(), { 8, 6, 0, 0, 0 }); //8-bit RGBA, deflate, adaptive filtering, not interlaced
+	append_chunk(png, "IHDR", ihdr.data(), ihdr.size());
+
+	//zlib header (32k window, level hint), then the pieces, then the checksum:
+	uint8_t flevel = (level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3);
+	uint8_t header[2] = { 0x78, uint8_t(flevel << 6) };
+	header[1] |= uint8_t((31 - (header[0] * 256 + header[1]) % 31) % 31);
+	append_chunk(png, "IDAT", header, 2);
+	for (auto const &piece : pieces) {
+		append_chunk(png, "IDAT", piece.data(), piece.size());
+	}
+	std::vector< uint8_t > trailer;
+	append_u32(&trailer, uint32_t(adler));
+	append_chunk(png, "IDAT", trailer.data(), trailer.size());
+
+	append_chunk(png, "IEND", nullptr, 0);
+}
+
+void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options) {
+	std::vector< uint8_t > png;
+	encode_png(size, data, origin, options, &png);
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file.write(reinterpret_cast< char const * >(png.data()), png.size())) {
+		throw std::runtime_error("Failed to write PNG image to '" + filename + "'.");
+	}
+}
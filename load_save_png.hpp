@@ -2,7 +2,11 @@
 
 #include <glm/glm.hpp>
 
+#include <functional>
+#include <future>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <stdint.h>
 
@@ -18,3 +22,65 @@ enum OriginLocation {
 //NOTE: load_png will throw on error
 void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin);
 void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin);
+
+//load_png from memory (e.g. a whole file read at once, or a piece of a bigger buffer), straight into the caller's memory:
+// 'destination' is called once the size is known and returns where to put the RGBA8 rows (first row at the start, in 'origin' order),
+// setting '*stride' if rows are not size.x * 4 bytes apart (e.g. to decode into a mapped pixel unpack buffer).
+//NOTE: these also throw on error
+typedef std::function< void *(glm::uvec2 const &size, size_t *stride) > PNGDestination;
+void load_png(uint8_t const *png, size_t bytes, PNGDestination const &destination, OriginLocation origin);
+//...and from a file (read whole, then decoded as above):
+void load_png(std::string const &filename, PNGDestination const &destination, OriginLocation origin);
+void load_png(uint8_t const *png, size_t bytes, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin);
+
+//load_png_batch reads and decodes many files at once on a pool of threads (e.g. for loading assets at startup):
+// results[i] becomes ready when filenames[i] has been loaded, so callers can upload each image as soon as it is ready
+// while the rest are still decoding; get() rethrows load_png's exceptions.
+struct LoadedPNG {
+	std::string filename;
+	glm::uvec2 size = glm::uvec2(0);
+	std::vector< glm::u8vec4 > data;
+	double read_ms = 0.0; //time to read the file
+	double decode_ms = 0.0; //time to decode it
+};
+struct PNGBatch {
+	//'threads' of 0 means one per hardware thread:
+	PNGBatch(std::vector< std::string > const &filenames, OriginLocation origin, uint32_t threads = 0);
+	//(waits for the files still loading)
+	~PNGBatch();
+	PNGBatch(PNGBatch const &) = delete;
+	PNGBatch &operator=(PNGBatch const &) = delete;
+
+	std::vector< std::future< LoadedPNG > > results; //in the same order as 'filenames'
+
+private:
+	std::vector< std::promise< LoadedPNG > > promises;
+	std::vector< std::thread > workers;
+};
+std::unique_ptr< PNGBatch > load_png_batch(std::vector< std::string > const &filenames, OriginLocation origin, uint32_t threads = 0);
+
+/*
+ * The parallel encoder skips libpng and writes the file itself: the image is
+ *  split into horizontal stripes, and each stripe is filtered and deflated
+ *  (with zlib, primed with the end of the stripe before) on its own thread,
+ *  pigz-style; the pieces join into one valid zlib stream, split over one
+ *  IDAT chunk per stripe.
+ */
+
+struct PNGSaveOptions {
+	int compression_level = 6; //zlib level, 0 (store) to 9 (smallest)
+	enum Filter {
+		FilterNone,
+		FilterSub,
+		FilterUp,
+		FilterAverage,
+		FilterPaeth,
+		FilterAdaptive, //per row, whichever filter leaves the smallest sum of (signed) bytes -- like libpng's default
+	} filter = FilterUp;
+	uint32_t threads = 0; //0 means one per hardware thread
+	uint32_t stripe_rows = 0; //rows per stripe; 0 picks about 256k bytes per stripe
+};
+
+//NOTE: these throw on error
+void encode_png(glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options, std::vector< uint8_t > *png);
+void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options);
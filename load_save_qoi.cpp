@@ -0,0 +1,250 @@
+#include "load_save_qoi.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define QOI_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define QOI_NEON
+#include <arm_neon.h>
+#endif
+
+//----- format -----
+//(see https://qoiformat.org/qoi-specification.pdf)
+
+static constexpr uint8_t QOI_OP_INDEX = 0x00; //00xxxxxx
+static constexpr uint8_t QOI_OP_DIFF = 0x40; //01xxxxxx
+static constexpr uint8_t QOI_OP_LUMA = 0x80; //10xxxxxx
+static constexpr uint8_t QOI_OP_RUN = 0xc0; //11xxxxxx
+static constexpr uint8_t QOI_OP_RGB = 0xfe;
+static constexpr uint8_t QOI_OP_RGBA = 0xff;
+static constexpr uint8_t QOI_MASK_2 = 0xc0;
+
+static constexpr uint32_t QOI_HEADER_SIZE = 14;
+static constexpr uint8_t QOI_PADDING[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+static constexpr uint32_t QOI_MAX_RUN = 62;
+
+static inline uint32_t qoi_hash(glm::u8vec4 const &px) {
+	return (px.r * 3u + px.g * 5u + px.b * 7u + px.a * 11u) % 64u;
+}
+
+static inline uint32_t as_u32(glm::u8vec4 const &px) {
+	uint32_t ret;
+	std::memcpy(&ret, &px, 4);
+	return ret;
+}
+
+//----- encoding -----
+
+//how many of the 'count' pixels starting at 'px' are equal to 'value' (stopping at the first that isn't):
+// this is the encoder's hot loop on game frames, which are mostly long runs of background.
+static inline uint32_t run_length(glm::u8vec4 const *px, uint32_t count, uint32_t value) {
+	uint32_t i = 0;
+#if defined(QOI_SSE2)
+	__m128i v = _mm_set1_epi32(int32_t(value));
+	for (; i + 4 <= count; i += 4) {
+		__m128i p = _mm_loadu_si128(reinterpret_cast< __m128i const * >(px + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(p, v)) != 0xffff) break;
+	}
+#elif defined(QOI_NEON)
+	uint32x4_t v = vdupq_n_u32(value);
+	for (; i + 4 <= count; i += 4) {
+		uint32x4_t p = vld1q_u32(reinterpret_cast< uint32_t const * >(px + i));
+		if (vminvq_u32(vceqq_u32(p, v)) != 0xffffffffu) break;
+	}
+#endif
+	//(the rest of the row, or where in the block of four the run ended)
+	while (i < count && as_u32(px[i]) == value) ++i;
+	return i;
+}
+
+void encode_qoi(glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, std::vector< uint8_t > *qoi_) {
+	assert(qoi_);
+	std::vector< uint8_t > &qoi = *qoi_;
+	if (size.x == 0 || size.y == 0) {
+		throw std::runtime_error("Can't encode an empty QOI image.");
+	}
+
+	//worst case is an RGBA op for every pixel:
+	qoi.resize(QOI_HEADER_SIZE + size_t(size.x) * size.y * 5 + sizeof(QOI_PADDING));
+	uint8_t *out = qoi.data();
+
+	auto write_u32 = [&out](uint32_t v) {
+		out[0] = uint8_t(v >> 24); out[1] = uint8_t(v >> 16); out[2] = uint8_t(v >> 8); out[3] = uint8_t(v);
+		out += 4;
+	};
+	std::memcpy(out, "qoif", 4);
+	out += 4;
+	write_u32(size.x);
+	write_u32(size.y);
+	*(out++) = 4; //channels
+	*(out++) = 0; //colorspace (sRGB with linear alpha)
+
+	glm::u8vec4 index[64];
+	for (glm::u8vec4 &i : index) i = glm::u8vec4(0);
+	glm::u8vec4 prev = glm::u8vec4(0, 0, 0, 255);
+	uint32_t run = 0;
+
+	for (uint32_t y = 0; y < size.y; ++y) {
+		//(QOI stores the top row first)
+		glm::u8vec4 const *row = data + size_t(origin == LowerLeftOrigin ? size.y - 1 - y : y) * size.x;
+		for (uint32_t x = 0; x < size.x; ) {
+			uint32_t same = run_length(row + x, size.x - x, as_u32(prev));
+			if (same) {
+				//(runs carry on across rows)
+				run += same;
+				x += same;
+				while (run >= QOI_MAX_RUN) {
+					*(out++) = uint8_t(QOI_OP_RUN | (QOI_MAX_RUN - 1));
+					run -= QOI_MAX_RUN;
+				}
+				continue;
+			}
+			if (run) {
+				*(out++) = uint8_t(QOI_OP_RUN | (run - 1));
+				run = 0;
+			}
+
+			glm::u8vec4 px = row[x];
+			uint32_t h = qoi_hash(px);
+			if (index[h] == px) {
+				*(out++) = uint8_t(QOI_OP_INDEX | h);
+			} else {
+				index[h] = px;
+				if (px.a == prev.a) {
+					int8_t dr = int8_t(px.r - prev.r);
+					int8_t dg = int8_t(px.g - prev.g);
+					int8_t db = int8_t(px.b - prev.b);
+					int8_t dr_dg = int8_t(dr - dg);
+					int8_t db_dg = int8_t(db - dg);
+					if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+						*(out++) = uint8_t(QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2));
+					} else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+						*(out++) = uint8_t(QOI_OP_LUMA | (dg + 32));
+						*(out++) = uint8_t(((dr_dg + 8) << 4) | (db_dg + 8));
+					} else {
+						*(out++) = QOI_OP_RGB;
+						*(out++) = px.r; *(out++) = px.g; *(out++) = px.b;
+					}
+				} else {
+					*(out++) = QOI_OP_RGBA;
+					*(out++) = px.r; *(out++) = px.g; *(out++) = px.b; *(out++) = px.a;
+				}
+			}
+			prev = px;
+			x += 1;
+		}
+	}
+	if (run) {
+		*(out++) = uint8_t(QOI_OP_RUN | (run - 1));
+	}
+	std::memcpy(out, QOI_PADDING, sizeof(QOI_PADDING));
+	out += sizeof(QOI_PADDING);
+
+	qoi.resize(out - qoi.data());
+}
+
+void save_qoi(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin) {
+	std::vector< uint8_t > qoi;
+	encode_qoi(size, data, origin, &qoi);
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file.write(reinterpret_cast< char const * >(qoi.data()), qoi.size())) {
+		throw std::runtime_error("Failed to write QOI image to '" + filename + "'.");
+	}
+}
+
+//----- decoding -----
+
+void load_qoi(uint8_t const *qoi, size_t bytes, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
+	assert(size);
+	assert(data);
+	if (bytes < QOI_HEADER_SIZE + sizeof(QOI_PADDING) || std::memcmp(qoi, "qoif", 4) != 0) {
+		throw std::runtime_error("Not a QOI image.");
+	}
+	auto read_u32 = [qoi](size_t at) {
+		return (uint32_t(qoi[at]) << 24) | (uint32_t(qoi[at+1]) << 16) | (uint32_t(qoi[at+2]) << 8) | uint32_t(qoi[at+3]);
+	};
+	glm::uvec2 qoi_size = glm::uvec2(read_u32(4), read_u32(8));
+	uint8_t channels = qoi[12];
+	if (channels != 3 && channels != 4) {
+		throw std::runtime_error("QOI image has " + std::to_string(channels) + " channels (expecting 3 or 4).");
+	}
+	//(every op makes at least one pixel, and a run op makes at most 62, which bounds the size a file can claim)
+	if (qoi_size.x == 0 || qoi_size.y == 0 || uint64_t(qoi_size.x) * qoi_size.y > uint64_t(bytes) * QOI_MAX_RUN) {
+		throw std::runtime_error("QOI image has a bad size.");
+	}
+
+	*size = qoi_size;
+	data->resize(size_t(size->x) * size->y);
+
+	glm::u8vec4 index[64];
+	for (glm::u8vec4 &i : index) i = glm::u8vec4(0);
+	glm::u8vec4 px = glm::u8vec4(0, 0, 0, 255);
+	uint32_t run = 0;
+
+	uint8_t const *in = qoi + QOI_HEADER_SIZE;
+	uint8_t const *end = qoi + bytes - sizeof(QOI_PADDING);
+	auto truncated = []() {
+		return std::runtime_error("QOI image data is truncated.");
+	};
+
+	for (uint32_t y = 0; y < size->y; ++y) {
+		glm::u8vec4 *row = data->data() + size_t(origin == LowerLeftOrigin ? size->y - 1 - y : y) * size->x;
+		for (uint32_t x = 0; x < size->x; ++x) {
+			if (run) {
+				run -= 1;
+			} else {
+				if (in >= end) throw truncated();
+				uint8_t b1 = *(in++);
+				if (b1 == QOI_OP_RGB) {
+					if (end - in < 3) throw truncated();
+					px.r = in[0]; px.g = in[1]; px.b = in[2];
+					in += 3;
+				} else if (b1 == QOI_OP_RGBA) {
+					if (end - in < 4) throw truncated();
+					px = glm::u8vec4(in[0], in[1], in[2], in[3]);
+					in += 4;
+				} else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+					px = index[b1];
+				} else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+					px.r += ((b1 >> 4) & 0x03) - 2;
+					px.g += ((b1 >> 2) & 0x03) - 2;
+					px.b += (b1 & 0x03) - 2;
+				} else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+					if (in >= end) throw truncated();
+					uint8_t b2 = *(in++);
+					int vg = (b1 & 0x3f) - 32;
+					px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+					px.g += vg;
+					px.b += vg - 8 + (b2 & 0x0f);
+				} else {
+					run = (b1 & 0x3f); //(this pixel, plus 'run' more)
+				}
+				index[qoi_hash(px)] = px;
+			}
+			row[x] = px;
+		}
+	}
+}
+
+void load_qoi(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
+	std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+	if (!file) {
+		throw std::runtime_error("Failed to open QOI image file '" + filename + "'.");
+	}
+	std::vector< uint8_t > bytes(size_t(file.tellg()));
+	file.seekg(0);
+	if (!file.read(reinterpret_cast< char * >(bytes.data()), bytes.size())) {
+		throw std::runtime_error("Failed to read QOI image file '" + filename + "'.");
+	}
+	try {
+		load_qoi(bytes.data(), bytes.size(), size, data, origin);
+	} catch (std::exception const &e) {
+		throw std::runtime_error("Failed to read QOI image from '" + filename + "': " + e.what());
+	}
+}
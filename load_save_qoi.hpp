@@ -0,0 +1,28 @@
+#pragma once
+
+#include "load_save_png.hpp" //for OriginLocation
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Load and save QOI ("Quite OK Image", https://qoiformat.org) files.
+ *
+ * QOI is lossless like PNG, but encodes in a single pass with no entropy
+ *  coding, so it is many times faster to write (and files are somewhat
+ *  bigger). That makes it a good fit for screenshots and frame captures,
+ *  which can be converted to PNG later with the qoi-to-png tool.
+ *
+ * Images are always saved with 4 channels (RGBA) and the sRGB colorspace tag.
+ */
+
+//NOTE: these throw on error
+void load_qoi(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin);
+void save_qoi(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin);
+
+//in-memory versions:
+void load_qoi(uint8_t const *qoi, size_t bytes, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin);
+void encode_qoi(glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, std::vector< uint8_t > *qoi);
@@ -10,17 +10,70 @@
 #include "GL.hpp"
 
 //for screenshots:
+#include "Screenshots.hpp"
 #include "load_save_png.hpp"
 
+//for recording every frame:
+#include "FrameCapture.hpp"
+
+//for recording input (to re-render later with replay-render):
+#include "Replay.hpp"
+
+//for timing each part of the frame:
+#include "FrameTiming.hpp"
+#include "GLTimer.hpp"
+#include "Trace.hpp"
+
+//for dumping diagnostics when a frame takes too long:
+#include "HitchDetector.hpp"
+
+//for the program binary cache option:
+#include "gl_compile_program.hpp"
+
+//for reporting redundant state changes:
+#include "GLStateCache.hpp"
+
+//for the debug output option:
+#include "gl_errors.hpp"
+
+//for recording GL calls:
+#include "GLRecord.hpp"
+
+//window/headless/null platforms:
+#include "Platform.hpp"
+
+//for drawing without GL:
+#include "SoftwareRasterizer.hpp"
+
 //Includes for libSDL:
 #include <SDL.h>
 
 //...and for c++ standard library functions:
 #include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <stdexcept>
 #include <memory>
 #include <algorithm>
+#include <string>
+#include <vector>
+
+//A late latch (see Mode::late_latched) drew from mouse state that already includes the motion events still
+// waiting in SDL's queue, so this frame presents them; note them for input-to-present latency, and return
+// how many there are (they are at the front of the queue, so they're the next ones handled):
+static uint32_t note_latched_motion(FrameTiming *frame_timing) {
+	//(nothing pumps events between the latch and here, so these are exactly the ones it saw)
+	static std::vector< SDL_Event > motion;
+	int count = SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+	if (count <= 0) return 0;
+	motion.resize(count);
+	count = SDL_PeepEvents(motion.data(), count, SDL_PEEKEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+	Uint32 ticks = SDL_GetTicks();
+	for (int i = 0; i < count; ++i) {
+		frame_timing->input(FrameTiming::stamp_time(motion[i].common.timestamp, ticks));
+	}
+	return uint32_t(std::max(count, 0));
+}
 
 int main(int argc, char **argv) {
 #ifdef _WIN32
@@ -28,154 +81,552 @@ int main(int argc, char **argv) {
 	try {
 #endif
 
-	//------------  initialization ------------
+	//used to report the time it takes to get the first frame on screen:
+	auto launch_time = std::chrono::high_resolution_clock::now();
+
+	//------------  command line ------------
+
+	std::string program_cache;
+	std::string gl_record_file;
+	uint32_t gl_record_frames = 0;
+	bool report_gl_state = false;
+	bool report_frame_timing = false;
+	bool frame_timing_overlay = false;
+	bool gpu_timing = false;
+	bool late_latch = false;
+	bool headless = false;
+	glm::uvec2 headless_size = glm::uvec2(640, 480);
+	std::string headless_output;
+	bool null_platform = false;
+	glm::uvec2 null_size = glm::uvec2(640, 480);
+	std::string null_script;
+	uint32_t null_seed = 0;
+	bool software_render = false;
+	std::string capture_destination;
+	FrameCapture::Format capture_format = FrameCapture::PNGSequence;
+	std::string screenshot_file = "screenshot.png";
+	std::string replay_file;
+	std::string trace_file;
+	std::string hitch_directory;
+	float hitch_budget_ms = 0.0f; //(0 means two refresh intervals)
+	uint32_t frame_limit = 0; //(0 means no limit)
+	GLLoaderBackend gl_loader = GLLoaderAuto;
+	bool gl_debug_output = false;
+	enum { ProfileOff, ProfileOnExit, ProfileEveryFrame } gl_profile = ProfileOff;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--program-cache" && argi + 1 < argc) {
+			//store linked shader programs in (and load them from) this directory:
+			program_cache = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--gl-debug-output") {
+			//report GL errors through a debug message callback instead of polling glGetError:
+			gl_debug_output = true;
+		} else if (arg == "--gl-profile") {
+			//count calls to (and time spent in) each GL function; print totals on exit:
+			gl_profile = ProfileOnExit;
+		} else if (arg == "--gl-profile-frames") {
+			//...or print them for every frame:
+			gl_profile = ProfileEveryFrame;
+		} else if (arg == "--gl-record" && argi + 2 < argc) {
+			//write every GL call made during the first <frames> frames to <file> (replay with gl-replay):
+			gl_record_file = argv[argi+1];
+			gl_record_frames = uint32_t(std::stoul(argv[argi+2]));
+			argi += 2;
+		} else if (arg == "--headless" && argi + 1 < argc) {
+			//render WxH frames into memory with no window (e.g. with Mesa's llvmpipe on a machine with no display):
+			unsigned int w = 0, h = 0;
+			if (std::sscanf(argv[argi+1], "%ux%u", &w, &h) != 2 || w == 0 || h == 0) {
+				std::cerr << "Expecting a size like '640x480' after --headless, got '" << argv[argi+1] << "'." << std::endl;
+				return 1;
+			}
+			headless = true;
+			headless_size = glm::uvec2(w, h);
+			argi += 1;
+		} else if (arg == "--null-platform" && argi + 1 < argc) {
+			//run with no display or GL at all, with WxH as the (pretend) window size; events are scripted or synthetic:
+			unsigned int w = 0, h = 0;
+			if (std::sscanf(argv[argi+1], "%ux%u", &w, &h) != 2 || w == 0 || h == 0) {
+				std::cerr << "Expecting a size like '640x480' after --null-platform, got '" << argv[argi+1] << "'." << std::endl;
+				return 1;
+			}
+			null_platform = true;
+			null_size = glm::uvec2(w, h);
+			argi += 1;
+		} else if (arg == "--null-script" && argi + 1 < argc) {
+			//feed the null platform events from this file (see Platform.cpp for the format):
+			null_script = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--null-seed" && argi + 1 < argc) {
+			//seed for the null platform's synthetic events:
+			null_seed = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--software-render") {
+			//on the null platform, draw frames on the CPU (see SoftwareRasterizer.hpp):
+			software_render = true;
+		} else if (arg == "--headless-output" && argi + 1 < argc) {
+			//save the last headless (or software-rendered) frame to this (.png) file:
+			headless_output = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--capture-png" && argi + 1 < argc) {
+			//save every frame to <prefix>000000.png, <prefix>000001.png, ...:
+			capture_destination = argv[argi+1];
+			capture_format = FrameCapture::PNGSequence;
+			argi += 1;
+		} else if (arg == "--capture-qoi" && argi + 1 < argc) {
+			//...or to <prefix>000000.qoi, ... (much cheaper to encode; convert to PNG later with qoi-to-png):
+			capture_destination = argv[argi+1];
+			capture_format = FrameCapture::QOISequence;
+			argi += 1;
+		} else if (arg == "--screenshot-format" && argi + 1 < argc) {
+			//save PrintScreen screenshots as 'png' (the default) or 'qoi':
+			std::string format = argv[argi+1];
+			if (format != "png" && format != "qoi") {
+				std::cerr << "Expecting 'png' or 'qoi' after --screenshot-format, got '" << format << "'." << std::endl;
+				return 1;
+			}
+			screenshot_file = "screenshot." + format;
+			argi += 1;
+		} else if (arg == "--capture-y4m" && argi + 1 < argc) {
+			//write every frame to a .y4m file, or (with a leading '|') pipe them to a command, e.g. '|ffmpeg -i - out.mp4':
+			capture_destination = argv[argi+1];
+			capture_format = FrameCapture::Y4M;
+			argi += 1;
+		} else if (arg == "--record-replay" && argi + 1 < argc) {
+			//save every frame's input to this file on exit (see Replay.hpp):
+			replay_file = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--gl-loader" && argi + 1 < argc) {
+			//where to look up GL functions on Linux (default: whichever has a context current):
+			std::string name = argv[argi+1];
+			if (name == "egl") gl_loader = GLLoaderEGL;
+			else if (name == "glx") gl_loader = GLLoaderGLX;
+			else if (name == "osmesa") gl_loader = GLLoaderOSMesa;
+			else {
+				std::cerr << "Expecting 'egl', 'glx', or 'osmesa' after --gl-loader, got '" << name << "'." << std::endl;
+				return 1;
+			}
+			argi += 1;
+		} else if (arg == "--frames" && argi + 1 < argc) {
+			//quit after this many frames (headless and null platform runs default to 60):
+			frame_limit = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--gl-state-stats") {
+			//print how many state changes gl_state elided (about once per second):
+			report_gl_state = true;
+		} else if (arg == "--frame-timing") {
+			//print per-phase frame time percentiles (and input-to-present latency) on exit (F4 prints them any time):
+			report_frame_timing = true;
+		} else if (arg == "--trace" && argi + 1 < argc) {
+			//write a Chrome trace (chrome://tracing, ui.perfetto.dev) of every frame's spans:
+			trace_file = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--hitch-dumps" && argi + 1 < argc) {
+			//write a diagnostic dump to this directory whenever a frame goes over budget:
+			hitch_directory = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--hitch-budget" && argi + 1 < argc) {
+			//frame time budget (ms) for --hitch-dumps:
+			hitch_budget_ms = std::stof(argv[argi+1]);
+			argi += 1;
+		} else if (arg == "--gpu-timing") {
+			//time GPU passes with timer queries (reported along with --frame-timing):
+			gpu_timing = true;
+		} else if (arg == "--late-latch") {
+			//re-read the mouse just before building vertices, so the paddle is drawn where it is now, not where it was at the start of the frame:
+			late_latch = true;
+		} else if (arg == "--frame-timing-overlay") {
+			//start with the frame time overlay showing (F3 toggles it):
+			frame_timing_overlay = true;
+		} else {
+			std::cerr << "Unrecognized argument '" << arg << "'.\n"
+			             "Usage:\n"
+			             "  " << argv[0] << " [--program-cache <dir>] [--gl-debug-output] [--gl-profile | --gl-profile-frames] [--gl-record <file> <frames>] [--gl-state-stats]\n"
+			             "    [--frame-timing] [--frame-timing-overlay] [--gpu-timing] [--trace <file.json>] [--hitch-dumps <dir> [--hitch-budget <ms>]] [--late-latch]\n"
+			             "    [--headless <W>x<H> [--headless-output <file.png>]] [--frames <count>] [--gl-loader egl|glx|osmesa]\n"
+			             "    [--null-platform <W>x<H> [--null-script <file>] [--null-seed <seed>] [--software-render]]\n"
+			             "    [--capture-png <prefix> | --capture-qoi <prefix> | --capture-y4m <file.y4m>|'|<command>'] [--screenshot-format png|qoi] [--record-replay <file>]" << std::endl;
+			return 1;
+		}
+	}
 
-	//Initialize SDL library:
-	SDL_Init(SDL_INIT_VIDEO);
-
-	//Ask for an OpenGL context version 3.3, core profile, enable debug:
-	SDL_GL_ResetAttributes();
-	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
-	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
-	SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
-	SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
-	SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
-	SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
-	SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
-
-	//create window:
-	SDL_Window *window = SDL_CreateWindow(
-		"mult", //TODO: remember to set a title for your game!
-		SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
-		640, 480, //TODO: modify window size if you'd like
-		SDL_WINDOW_OPENGL
-		| SDL_WINDOW_RESIZABLE //uncomment to allow resizing
-		| SDL_WINDOW_ALLOW_HIGHDPI //uncomment for full resolution on high-DPI screens
-	);
-
-	//prevent exceedingly tiny windows when resizing:
-	SDL_SetWindowMinimumSize(window, 100, 100);
-
-	if (!window) {
-		std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+	if (program_cache != "") {
+		if (gl_record_file != "") {
+			//(programs loaded from binaries wouldn't be re-creatable from the recording)
+			std::cerr << "NOTE: not using the program cache while recording GL calls." << std::endl;
+		} else {
+			gl_set_program_cache(program_cache);
+		}
+	}
+
+	if (headless && null_platform) {
+		std::cerr << "Expecting at most one of --headless and --null-platform." << std::endl;
 		return 1;
 	}
 
-	//Create OpenGL context:
-	SDL_GLContext context = SDL_GL_CreateContext(window);
+	if (software_render && !null_platform) {
+		std::cerr << "Expecting --software-render to be used with --null-platform." << std::endl;
+		return 1;
+	}
+
+	if ((headless || null_platform) && frame_limit == 0) {
+		frame_limit = 60;
+	}
 
-	if (!context) {
-		SDL_DestroyWindow(window);
-		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+	//------------  initialization ------------
+
+	if (trace_file != "") {
+		try {
+			trace_start(trace_file);
+		} catch (std::exception const &e) {
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+	}
+
+	std::unique_ptr< Platform > platform;
+	try {
+		if (null_platform) {
+			platform.reset(new NullPlatform(null_size, null_script, null_seed));
+		} else {
+			platform.reset(new SDLPlatform(headless ? headless_size : glm::uvec2(0), gl_loader));
+		}
+	} catch (std::exception const &e) {
+		std::cerr << e.what() << std::endl;
 		return 1;
 	}
+	SDLPlatform *sdl_platform = dynamic_cast< SDLPlatform * >(platform.get());
 
-	//On windows, load OpenGL entrypoints: (does nothing on other platforms)
-	init_GL();
+	//modes check this before acquiring GL resources and drawing:
+	Mode::gl_enabled = platform->has_gl;
 
-	//Set VSYNC + Late Swap (prevents crazy FPS):
-	if (SDL_GL_SetSwapInterval(-1) != 0) {
-		std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
-		if (SDL_GL_SetSwapInterval(1) != 0) {
-			std::cerr << "NOTE: couldn't set vsync (" << SDL_GetError() << ")." << std::endl;
+	//late latching reads the real mouse, so only makes sense with a window:
+	if (late_latch) {
+		if (sdl_platform && !headless) {
+			Mode::late_latch = true;
+		} else {
+			std::cerr << "NOTE: --late-latch does nothing without a window." << std::endl;
 		}
 	}
 
-	//Hide mouse cursor (note: showing can be useful for debugging):
-	//SDL_ShowCursor(SDL_DISABLE);
+	std::unique_ptr< SoftwareRasterizer > software_rasterizer;
+	if (software_render) {
+		software_rasterizer.reset(new SoftwareRasterizer(platform->drawable_size));
+		Mode::software_rasterizer = software_rasterizer.get();
+		std::cout << "Software rendering on " << software_rasterizer->threads() << " threads with "
+		          << SoftwareRasterizer::simd_name(software_rasterizer->simd) << " spans." << std::endl;
+	}
+
+	if (platform->has_gl) {
+		if (gl_debug_output) {
+			gl_debug_output_install();
+		}
+
+		if (gl_record_file != "") {
+			gl_record_start(gl_record_file, gl_record_frames);
+		}
+
+		if (gl_profile != ProfileOff) {
+#ifdef GL_PROFILE_LAYER
+			gl_profile_enabled = true;
+#else
+			std::cerr << "NOTE: GL.hpp was generated without 'make-GL.py --profile'; no GL call profile will be printed." << std::endl;
+#endif
+		}
+	} else if (gl_debug_output || gl_record_file != "" || gl_profile != ProfileOff) {
+		std::cerr << "NOTE: GL debug output, recording, and profiling do nothing on the null platform." << std::endl;
+	}
+
+	//screenshots are read from the window:
+	std::unique_ptr< Screenshots > screenshots;
+	if (sdl_platform && sdl_platform->window) {
+		screenshots.reset(new Screenshots());
+	}
+
+	//captured frames are read from the window or the headless framebuffer:
+	std::unique_ptr< FrameCapture > capture;
+	if (capture_destination != "") {
+		if (!platform->has_gl) {
+			std::cerr << "NOTE: frame capture does nothing on the null platform; use --software-render and --headless-output instead." << std::endl;
+		} else {
+			try {
+				capture.reset(new FrameCapture(capture_format, capture_destination));
+			} catch (std::exception const &e) {
+				std::cerr << e.what() << std::endl;
+				return 1;
+			}
+		}
+	}
 
 	//------------ create game mode + make current --------------
 	Mode::set_current(std::make_shared< MultMode >());
 
 	//------------ main loop ------------
 
-	//this inline function will be called whenever the window is resized,
-	// and will update the window_size and drawable_size variables:
-	glm::uvec2 window_size; //size of window (layout pixels)
-	glm::uvec2 drawable_size; //size of drawable (physical pixels)
+	//platform->window_size is the size of window (layout pixels), platform->drawable_size is the size of drawable (physical pixels):
 	//On non-highDPI displays, window_size will always equal drawable_size.
-	auto on_resize = [&](){
-		int w,h;
-		SDL_GetWindowSize(window, &w, &h);
-		window_size = glm::uvec2(w, h);
-		SDL_GL_GetDrawableSize(window, &w, &h);
-		drawable_size = glm::uvec2(w, h);
-		glViewport(0, 0, drawable_size.x, drawable_size.y);
-	};
-	on_resize();
+	platform->resize();
+
+	uint32_t frames = 0; //frames drawn so far
+
+	Replay replay; //(only filled in with --record-replay)
+	bool record_replay = (replay_file != "");
+	auto loop_start_time = std::chrono::high_resolution_clock::now(); //(reset after the first frame)
+
+	FrameTiming frame_timing; //(always on; it's a few clock reads per frame)
+	frame_timing.overlay = frame_timing_overlay;
+	Mode::frame_timing = &frame_timing;
+
+	std::unique_ptr< GLTimer > gl_timer;
+	if (gpu_timing) {
+		if (!platform->has_gl) {
+			std::cerr << "NOTE: GPU timing does nothing on the null platform." << std::endl;
+		} else {
+			gl_timer.reset(new GLTimer());
+			Mode::gl_timer = gl_timer.get();
+		}
+	}
+
+	std::unique_ptr< HitchDetector > hitch_detector;
+	if (hitch_directory != "") {
+		if (hitch_budget_ms <= 0.0f) {
+			//two refresh intervals (of a 60Hz display, if the rate isn't known):
+			hitch_budget_ms = 2.0f * 1000.0f / (platform->refresh_rate > 0.0f ? platform->refresh_rate : 60.0f);
+		}
+		hitch_detector.reset(new HitchDetector(hitch_budget_ms, hitch_directory));
+	}
+
+	//motion events a late latch has already drawn, which aren't counted as input again when they're handled:
+	uint32_t latched_motion = 0;
 
 	//This will loop until the current mode is set to null:
 	while (Mode::current) {
 		//every pass through the game loop creates one frame of output
 		//  by performing three steps:
 
+		frame_timing.begin_frame();
+		TRACE_SCOPE("frame");
+
+		if (hitch_detector) {
+			hitch_detector->check(frame_timing, Mode::current.get());
+		}
+
+		if (record_replay) {
+			replay.frames.emplace_back();
+			replay.frames.back().window_size = platform->window_size;
+			replay.frames.back().drawable_size = platform->drawable_size;
+		}
+
 		{ //(1) process any events that are pending
+			TRACE_SCOPE("events");
 			static SDL_Event evt;
-			while (SDL_PollEvent(&evt) == 1) {
+			while (platform->poll_event(&evt)) {
 				//handle resizing:
 				if (evt.type == SDL_WINDOWEVENT && evt.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
-					on_resize();
+					platform->resize();
+					if (record_replay) {
+						replay.frames.back().window_size = platform->window_size;
+						replay.frames.back().drawable_size = platform->drawable_size;
+					}
+				}
+				if (record_replay && Replay::records(evt)) {
+					replay.frames.back().events.emplace_back(evt);
+				}
+				//note when input happened, for input-to-present latency:
+				if (Replay::records(evt)) {
+					//SDL stamps events (in ms since init) as its event thread sees them, which can be a while
+					// before they're polled; scripted and synthetic events don't have real stamps, so count from now:
+					auto happened = FrameTiming::Clock::now();
+					if (sdl_platform) {
+						happened = FrameTiming::stamp_time(evt.common.timestamp, SDL_GetTicks());
+					}
+					//(motion that a late latch already drew was counted then; see note_latched_motion)
+					if (evt.type == SDL_MOUSEMOTION && latched_motion > 0) {
+						latched_motion -= 1;
+					} else {
+						frame_timing.input(happened);
+					}
 				}
 				//handle input:
-				if (Mode::current && Mode::current->handle_event(evt, window_size)) {
+				if (Mode::current && Mode::current->handle_event(evt, platform->window_size)) {
 					// mode handled it; great
 				} else if (evt.type == SDL_QUIT) {
 					Mode::set_current(nullptr);
 					break;
-				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_PRINTSCREEN) {
+				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_PRINTSCREEN && screenshots) {
 					// --- screenshot key ---
-					std::string filename = "screenshot.png";
-					std::cout << "Saving screenshot to '" << filename << "'." << std::endl;
-					glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-					glReadBuffer(GL_FRONT);
-					int w,h;
-					SDL_GL_GetDrawableSize(window, &w, &h);
-					std::vector< glm::u8vec4 > data(w*h);
-					glReadPixels(0,0,w,h, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-					for (auto &px : data) {
-						px.a = 0xff;
-					}
-					save_png(filename, glm::uvec2(w,h), data.data(), LowerLeftOrigin);
+					//(the next frame drawn is read back and saved in the background)
+					screenshots->request(screenshot_file);
+				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F3) {
+					frame_timing.overlay = !frame_timing.overlay;
+				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F4) {
+					frame_timing.report(std::cout);
 				}
 			}
 			if (!Mode::current) break;
+			frame_timing.end_phase(FrameTiming::Events);
 		}
 
 		{ //(2) call the current mode's "update" function to deal with elapsed time:
-			auto current_time = std::chrono::high_resolution_clock::now();
-			static auto previous_time = current_time;
-			float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
-			previous_time = current_time;
-
-			//if frames are taking a very long time to process,
-			//lag to avoid spiral of death:
-			elapsed = std::min(0.1f, elapsed);
-
+			TRACE_SCOPE("update");
+			float elapsed = platform->elapsed();
+			if (record_replay) replay.frames.back().elapsed = elapsed;
 			Mode::current->update(elapsed);
 			if (!Mode::current) break;
+			frame_timing.end_phase(FrameTiming::Update);
 		}
 
 		{ //(3) call the current mode's "draw" function to produce output:
-		
-			Mode::current->draw(drawable_size);
+			TRACE_SCOPE("draw");
+
+			if (gl_timer) {
+				gl_timer->poll(&frame_timing);
+				gl_timer->begin_frame(frame_timing.frames);
+			}
+
+			Mode::late_latched = false;
+			Mode::current->draw(platform->drawable_size);
+			if (Mode::late_latched) {
+				latched_motion = note_latched_motion(&frame_timing);
+			}
+
+			gl_state.end_frame();
+			if (report_gl_state) {
+				static auto report_time = std::chrono::high_resolution_clock::now();
+				auto now = std::chrono::high_resolution_clock::now();
+				if (now - report_time >= std::chrono::seconds(1)) {
+					report_time = now;
+					std::cout << "GL state cache: " << gl_state.last_frame.issued << " state changes issued, "
+					          << gl_state.last_frame.elided << " elided last frame." << std::endl;
+				}
+			}
+		}
+
+		if (software_rasterizer) {
+			TRACE_SCOPE("software rasterizer finish");
+			software_rasterizer->finish();
+		}
+
+		if (screenshots) {
+			TRACE_SCOPE("screenshots");
+			screenshots->frame(platform->drawable_size);
+		}
+
+		if (capture) {
+			TRACE_SCOPE("capture");
+			capture->frame(sdl_platform->headless_context ? sdl_platform->headless_context->framebuffer : 0, platform->drawable_size);
+		}
+
+		if (gl_timer) {
+			gl_timer->end_frame();
+		}
+
+		frame_timing.end_phase(FrameTiming::Draw);
+
+		TRACE_BEGIN("present");
+		platform->present();
+		TRACE_END("present");
+
+		frame_timing.end_phase(FrameTiming::Present);
+
+		gl_record_frame();
+
+		//(workers' events are written here too)
+		trace_flush();
+
+#ifdef GL_PROFILE_LAYER
+		if (gl_profile == ProfileEveryFrame) {
+			gl_profile_dump(std::cout);
+			gl_profile_reset();
 		}
+#endif
 
-		//Wait until the recently-drawn frame is shown before doing it all again:
-		SDL_GL_SwapWindow(window);
+		static bool first_frame = true;
+		if (first_frame) {
+			first_frame = false;
+			auto first_frame_time = std::chrono::high_resolution_clock::now();
+			std::cout << "Time to first frame: " << std::chrono::duration< double, std::milli >(first_frame_time - launch_time).count() << " ms." << std::endl;
+			if (platform->has_gl) {
+				std::cout << "GL loader (" << gl_loader_stats.backend << "): " << gl_loader_stats.open_ms << " ms to open, "
+				          << gl_loader_stats.resolved << " entry points looked up in " << gl_loader_stats.resolve_ms << " ms." << std::endl;
+			}
+			loop_start_time = first_frame_time;
+		}
+
+		frames += 1;
+		if (frame_limit != 0 && frames >= frame_limit) {
+			Mode::set_current(nullptr);
+		}
+	}
+
+	if ((headless || null_platform) && frames > 1) {
+		double ms = std::chrono::duration< double, std::milli >(std::chrono::high_resolution_clock::now() - loop_start_time).count();
+		std::cout << (null_platform ? "Ran " : "Rendered ") << frames << " frames at " << platform->drawable_size.x << "x" << platform->drawable_size.y
+		          << (null_platform ? " on the null platform" : "") << (software_rasterizer ? " (software rendered)" : "") << "; after the first, "
+		          << (ms / (frames - 1)) << " ms per frame (" << ((frames - 1) / (ms / 1000.0)) << " frames/second)." << std::endl;
+	}
+	if (report_frame_timing) {
+		frame_timing.report(std::cout);
+		if (gl_timer) {
+			std::cout << "GPU timing: " << gl_timer->timed << " frames timed, " << gl_timer->skipped << " skipped (queries still in flight), "
+			          << gl_timer->discarded << " discarded (impossible results)." << std::endl;
+		}
+	}
+	if (hitch_detector) {
+		hitch_detector->report(std::cout);
+	}
+	if (NullPlatform *null = dynamic_cast< NullPlatform * >(platform.get())) {
+		std::cout << "Null platform: " << null->events << " events over " << null->time << " virtual seconds." << std::endl;
+	}
+	if (record_replay) {
+		//(the last frame may have been cut short by quitting)
+		replay.frames.resize(frames);
+		try {
+			replay.save(replay_file);
+			std::cout << "Saved " << replay.frames.size() << " frames of input to '" << replay_file << "'." << std::endl;
+		} catch (std::exception const &e) {
+			std::cerr << "WARNING: " << e.what() << std::endl;
+		}
+	}
+	if (headless && headless_output != "") {
+		std::cout << "Saving last frame to '" << headless_output << "'." << std::endl;
+		save_png(headless_output, headless_size, sdl_platform->headless_frame.data(), LowerLeftOrigin);
+	} else if (software_rasterizer && headless_output != "") {
+		std::cout << "Saving last frame to '" << headless_output << "'." << std::endl;
+		save_png(headless_output, software_rasterizer->size, software_rasterizer->pixels.data(), LowerLeftOrigin);
 	}
 
 
 	//------------  teardown ------------
 
-	SDL_GL_DeleteContext(context);
-	context = 0;
+	gl_record_stop();
+
+#ifdef GL_PROFILE_LAYER
+	if (gl_profile == ProfileOnExit) {
+		gl_profile_dump(std::cout);
+	}
+#endif
+
+	Mode::frame_timing = nullptr;
+	Mode::gl_timer = nullptr;
+	gl_timer.reset();
+
+	screenshots.reset();
+
+	if (capture) {
+		capture->finish();
+		capture->report(std::cout);
+		capture.reset();
+	}
+
+	//(after screenshots and capture have finished, so their workers' last spans are in the trace)
+	trace_stop();
+
+	Mode::software_rasterizer = nullptr;
+	software_rasterizer.reset();
 
-	SDL_DestroyWindow(window);
-	window = NULL;
+	platform.reset();
 
 	return 0;
 
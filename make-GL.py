@@ -3,11 +3,33 @@
 #create GL.hpp / GL.cpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
 #get glcorearb.h from https://github.com/KhronosGroup/OpenGL-Registry/raw/master/api/GL/glcorearb.h
 
+import argparse
 import re
 
+parser = argparse.ArgumentParser(description="Generate GL.hpp / GL.cpp from glcorearb.h.")
+parser.add_argument("--profile", action="store_true", help="also emit a call profiling layer that wraps every entry point (see gl_profile_* in the generated GL.hpp)")
+parser.add_argument("--loader", action="store_true", help="on Linux, make every entry point a pointer resolved at runtime (on first call) through an EGL, GLX, or OSMesa backend, instead of linking -lGL (without it, link -lGL; init_GL() then ignores its backend)")
+parser.add_argument("--record", action="store_true", help="also emit a call recording layer (see gl_record_* in the generated GL.hpp, GLRecord.hpp) and the matching GLReplayDispatch.cpp")
+args = parser.parse_args()
+
 filtered = []
 lookups = []
 fps = []
+entry_points = [] #(name, return type, [(parameter type, parameter name), ...]) for every function, in header order
+
+#split "(GLenum target, const void *data);" into [("GLenum", "target"), ("const void *", "data")]:
+def parse_parameters(ag):
+	ag = ag.strip()
+	assert(ag.startswith("(") and ag.endswith(");"))
+	ag = ag[1:-2].strip()
+	if ag == "void":
+		return []
+	params = []
+	for p in ag.split(","):
+		m = re.match(r"^(.*?)([A-Za-z_][A-Za-z_0-9]*)$", p.strip())
+		assert(m != None)
+		params.append((m.group(1).strip(), m.group(2)))
+	return params
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -76,8 +98,14 @@ with open('glcorearb.h', 'r') as f:
 			#check for function prototype lines:
 			m = re.match(r"GLAPI(.*)APIENTRY ([^\s]+) (.*)$", line)
 			if m != None:
+				if mode != "skip":
+					entry_points.append((m.group(2), m.group(1).strip(), parse_parameters(m.group(3))))
 				if mode == "all_proto":
-					filtered.append(line)
+					if args.loader:
+						#(prototypes everywhere but Linux; see APIENTRYFP11)
+						filtered.append("GLAPI" + m.group(1) + "(APIENTRYFP11 " + m.group(2) + ") " + m.group(3))
+					else:
+						filtered.append(line)
 				elif mode == "win_pointer":
 					rt = m.group(1)
 					fn = m.group(2)
@@ -105,7 +133,8 @@ with open('glcorearb.h', 'r') as f:
 
 
 with open("GL.hpp", "w") as f:
-	print("""#pragma once
+	if not args.loader:
+		print("""#pragma once
 
 /*
  *
@@ -116,7 +145,7 @@ with open("GL.hpp", "w") as f:
  *  initialized by init_GL(). This is because the 1.1/1.0 entries are
  *  the only ones provided directly by OpenGL32.dll 
  *
- * On Linux, all are prototypes.
+ * On Linux, all are prototypes (so link with -lGL).
  *
  * On MacOS, all are prototypes.
  *
@@ -124,7 +153,32 @@ with open("GL.hpp", "w") as f:
  *
  */
 
-void init_GL(); //will throw on failure.
+//Where entry points are looked up (only used with --loader; these prototypes come straight from libGL):
+enum GLLoaderBackend {
+	GLLoaderAuto, //whichever of the below has a current context
+	GLLoaderEGL,
+	GLLoaderGLX,
+	GLLoaderOSMesa,
+};
+
+void init_GL(GLLoaderBackend backend = GLLoaderAuto); //will throw on failure.
+
+//Cost of loading (only measured with --loader; always zero here):
+struct GLLoaderStats {
+	char const *backend = "none"; //backend in use
+	double open_ms = 0.0; //time init_GL() spent opening the backend library
+	unsigned int resolved = 0; //entry points looked up so far
+	double resolve_ms = 0.0; //time spent looking them up
+};
+extern GLLoaderStats gl_loader_stats;
+
+//look up an entry point GL.hpp doesn't declare (e.g., from an extension) where init_GL() found the rest:
+// may return nullptr if there is no such function (or init_GL() hasn't been called), but some
+// backends (e.g. EGL) hand back pointers for any name, so check for the extension first.
+void *gl_get_proc_address(char const *name);
+
+//is 'name' (e.g. "GL_KHR_debug") in the current context's extension list? (checked with glGetStringi, as core profiles require)
+bool gl_extension_supported(char const *name);
 
 extern "C" {
 
@@ -145,6 +199,82 @@ typedef signed   long long int khronos_ssize_t;
 typedef signed   long  int     khronos_ssize_t;
 #endif
 
+#define GLAPI extern
+""", file=f)
+	else:
+		print("""#pragma once
+
+/*
+ *
+ * Function prototypes/pointers for OpenGL 3.3 core, with minimal namespace pollution.
+ * Call init_GL() after you have created a context.
+ *
+ * On Windows, OpenGL 1.0 & 1.1 are prototypes, the rest are pointers
+ *  initialized by init_GL(). This is because the 1.1/1.0 entries are
+ *  the only ones provided directly by OpenGL32.dll 
+ *
+ * On Linux, all are pointers, each looked up the first time it is called
+ *  through the backend (EGL, GLX, or OSMesa) chosen by init_GL(); so the
+ *  program doesn't link against libGL, and only looks up what it uses.
+ *
+ * On MacOS, all are prototypes.
+ *
+ * This file has been automatically generated from glcorearb.h by make-GL.py --loader
+ *
+ */
+
+//Where entry points are looked up (only used on Linux):
+enum GLLoaderBackend {
+	GLLoaderAuto, //whichever of the below has a current context
+	GLLoaderEGL,
+	GLLoaderGLX,
+	GLLoaderOSMesa,
+};
+
+void init_GL(GLLoaderBackend backend = GLLoaderAuto); //will throw on failure.
+
+//Cost of loading (Linux only; zero elsewhere):
+struct GLLoaderStats {
+	char const *backend = "none"; //backend in use
+	double open_ms = 0.0; //time init_GL() spent opening the backend library
+	unsigned int resolved = 0; //entry points looked up so far
+	double resolve_ms = 0.0; //time spent looking them up
+};
+extern GLLoaderStats gl_loader_stats;
+
+//look up an entry point GL.hpp doesn't declare (e.g., from an extension) where init_GL() found the rest:
+// may return nullptr if there is no such function (or init_GL() hasn't been called), but some
+// backends (e.g. EGL) hand back pointers for any name, so check for the extension first.
+void *gl_get_proc_address(char const *name);
+
+//is 'name' (e.g. "GL_KHR_debug") in the current context's extension list? (checked with glGetStringi, as core profiles require)
+bool gl_extension_supported(char const *name);
+
+extern "C" {
+
+#include <stdint.h>
+
+#ifdef _WIN32
+	#define APIENTRY __stdcall //see: https://docs.microsoft.com/en-us/windows/win32/winprog/windows-data-types
+	#define APIENTRYFP APIENTRY * //these are function pointers on windows
+	#define APIENTRYFP11 APIENTRY //...except for 1.0/1.1
+#elif defined(__linux__)
+	#define APIENTRY
+	#define APIENTRYFP APIENTRY * //these are all function pointers on linux
+	#define APIENTRYFP11 APIENTRY *
+#else
+	#define APIENTRY
+	#define APIENTRYFP
+	#define APIENTRYFP11
+#endif
+
+//this is how khronos_ssize_t gets defined in khrplatform.h:
+#ifdef _WIN64
+typedef signed   long long int khronos_ssize_t;
+#else
+typedef signed   long  int     khronos_ssize_t;
+#endif
+
 #define GLAPI extern
 """, file=f)
 
@@ -153,11 +283,141 @@ typedef signed   long  int     khronos_ssize_t;
 	print("""
 }""", file=f)
 
+	if args.profile or args.record:
+		print("""
+//------------ call layer ------------
+//(generated by make-GL.py""" + (" --profile" if args.profile else "") + (" --record" if args.record else "") + """)
+//Every entry point above is wrapped by a same-named macro that routes the call through gl_layer_call().""", file=f)
+		if args.profile:
+			print("""//Profiling: while gl_profile_enabled is set, calls are counted and the CPU time spent in them accumulated.""", file=f)
+		if args.record:
+			print("""//Recording: while gl_record_active is set, calls and the data they reference are written out (see GLRecord.hpp).""", file=f)
+		print("""// With both switched off (the default), the cost is a flag check per call.
+
+#include <iosfwd>
+#include <utility>
+
+enum GLLayerIndex : uint32_t {""", file=f)
+		print("\t" + "\n\t".join("GLP_" + name + "," for (name, _, _) in entry_points), file=f)
+		print("""	GLP_COUNT
+};
+
+extern char const *gl_layer_names[GLP_COUNT]; //"glBindBuffer", etc.
+""", file=f)
+
+	if args.profile:
+		print("""#define GL_PROFILE_LAYER 1
+
+extern bool gl_profile_enabled;
+
+//print call counts and time for every entry point called since the last reset (most time first):
+void gl_profile_dump(std::ostream &out);
+void gl_profile_reset();
+
+uint64_t gl_profile_now(); //nanoseconds, from an arbitrary start
+void gl_profile_record(uint32_t index, uint64_t start);
+
+struct GLProfileCall {
+	GLProfileCall(uint32_t index_) : index(index_), enabled(gl_profile_enabled) {
+		if (enabled) start = gl_profile_now();
+	}
+	~GLProfileCall() {
+		if (enabled) gl_profile_record(index, start);
+	}
+	uint32_t index;
+	bool enabled;
+	uint64_t start = 0;
+};
+""", file=f)
+
+	if args.record:
+		print("""#define GL_RECORD_LAYER 1
+
+#include <cstring>
+#include <type_traits>
+
+extern bool gl_record_active;
+
+//called after every call while recording; 'values' holds the arguments, encoded by gl_record_value():
+void gl_record_call(uint32_t index, uint64_t const *values, uint32_t count, uint64_t returned);
+
+//one character per parameter: 'v' for values, 'i' for input pointers, 'o' for output pointers:
+extern char const *gl_record_signatures[GLP_COUNT];
+
+//size of the data a pointer parameter refers to (GLRecordNoPayload if unknown or not worth recording):
+constexpr uint64_t GLRecordNoPayload = ~0ULL;
+uint64_t gl_record_payload_size(uint32_t index, uint32_t param, uint64_t const *values);
+//size of a client-memory image, assuming the default (4-byte) row alignment:
+uint64_t gl_record_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type);
+
+//arguments are stored as 64-bit values (signed integers sign-extended, floats as their bits):
+template< typename T >
+inline typename std::enable_if< std::is_integral< T >::value, uint64_t >::type gl_record_value(T v) {
+	return uint64_t(int64_t(v));
+}
+template< typename T >
+inline uint64_t gl_record_value(T *v) {
+	return uint64_t(uintptr_t(v));
+}
+inline uint64_t gl_record_value(float v) {
+	uint32_t bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return bits;
+}
+inline uint64_t gl_record_value(double v) {
+	uint64_t bits;
+	std::memcpy(&bits, &v, sizeof(bits));
+	return bits;
+}
+
+template< typename R >
+struct GLLayerRecord {
+	template< typename... P >
+	static R call(uint32_t index, R (APIENTRY *fn)(P...), P... params) {
+		R ret = fn(params...);
+		uint64_t values[sizeof...(P) + 1] = { gl_record_value(params)... };
+		gl_record_call(index, values, sizeof...(P), gl_record_value(ret));
+		return ret;
+	}
+};
+template< >
+struct GLLayerRecord< void > {
+	template< typename... P >
+	static void call(uint32_t index, void (APIENTRY *fn)(P...), P... params) {
+		fn(params...);
+		uint64_t values[sizeof...(P) + 1] = { gl_record_value(params)... };
+		gl_record_call(index, values, sizeof...(P), 0);
+	}
+};
+""", file=f)
+
+	if args.profile or args.record:
+		print("""//(parameters are not deduced from the arguments, so they convert just like they would for a direct call)
+template< typename T >
+struct GLLayerIdentity { typedef T type; };
+
+template< typename R, typename... P >
+inline R gl_layer_call(uint32_t index, R (APIENTRY *fn)(P...), typename GLLayerIdentity< P >::type... params) {""", file=f)
+		if args.profile:
+			print("""	GLProfileCall call(index);""", file=f)
+		if args.record:
+			print("""	if (gl_record_active) return GLLayerRecord< R >::call(index, fn, params...);""", file=f)
+		print("""	return fn(params...);
+}
+""", file=f)
+		for (name, _, params) in entry_points:
+			if len(params) > 0:
+				print("#define " + name + "(...) gl_layer_call(GLP_" + name + ", " + name + ", __VA_ARGS__)", file=f)
+			else:
+				print("#define " + name + "() gl_layer_call(GLP_" + name + ", " + name + ")", file=f)
+
 
 with open("GL.cpp", "w") as f:
-	print("""#include "GL.hpp"
+	if not args.loader:
+		print("""#include "GL.hpp"
 
 #include <SDL.h>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -171,9 +431,408 @@ with open("GL.cpp", "w") as f:
 	#define DO(fn)
 #endif
 
-void init_GL() {""", file=f)
-	print("\t" + "\n\t".join(lookups),file=f)
-	print("""}
+GLLoaderStats gl_loader_stats;
+
+void init_GL(GLLoaderBackend) {""", file=f)
+		print("\t" + "\n\t".join(lookups),file=f)
+		print("""}
+
+void *gl_get_proc_address(char const *name) {
+	return SDL_GL_GetProcAddress(name);
+}
+
+#ifdef _WIN32""", file=f)
+		print("\t" + "\n\t".join(fps),file=f)
+		print("""#endif""", file=f)
+	else:
+		print("""#include "GL.hpp"
+
+#include <SDL.h>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _WIN32
+	#define DO(fn) \\
+		fn = (decltype(fn))SDL_GL_GetProcAddress(#fn); \\
+		if (!fn) { \\
+			throw std::runtime_error("Error binding " #fn); \\
+		}
+#else
+	#define DO(fn)
+#endif
+
+GLLoaderStats gl_loader_stats;
+
+#ifndef __linux__
+void init_GL(GLLoaderBackend) {""", file=f)
+		print("\t" + "\n\t".join(lookups),file=f)
+		print("""}
+
+void *gl_get_proc_address(char const *name) {
+	return SDL_GL_GetProcAddress(name);
+}
+#endif
 #ifdef _WIN32""", file=f)
-	print("\t" + "\n\t".join(fps),file=f)
-	print("""#endif""", file=f)
+		print("\t" + "\n\t".join(fps),file=f)
+		print("""#endif""", file=f)
+
+		print("""
+#ifdef __linux__
+//------------ runtime loader ------------
+
+#include <dlfcn.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+typedef void *(*GLLoaderGetProcAddress)(char const *name);
+static GLLoaderGetProcAddress gl_loader_get_proc_address = nullptr;
+
+//look up 'name' through the current backend (throws if it can't be found):
+static void *gl_loader_resolve(char const *name) {
+	if (!gl_loader_get_proc_address) {
+		throw std::runtime_error(std::string("Called ") + name + " before init_GL().");
+	}
+	auto before = std::chrono::steady_clock::now();
+	void *ret = gl_loader_get_proc_address(name);
+	gl_loader_stats.resolve_ms += std::chrono::duration< double, std::milli >(std::chrono::steady_clock::now() - before).count();
+	if (!ret) {
+		throw std::runtime_error(std::string("Error binding ") + name);
+	}
+	gl_loader_stats.resolved += 1;
+	return ret;
+}
+
+void *gl_get_proc_address(char const *name) {
+	if (!gl_loader_get_proc_address) return nullptr;
+	return gl_loader_get_proc_address(name);
+}
+
+//every pointer starts out pointing at a stub that looks up the real function, then calls it:
+// (the '(*fn)' spelling keeps the call from being caught by the call layer's macros)""", file=f)
+		for (name, ret, params) in entry_points:
+			decl = ", ".join(t + " " + n for (t, n) in params)
+			print("static " + ret + " APIENTRY gl_lazy_" + name + "(" + decl + ") {", file=f)
+			print("\t" + name + " = (decltype(" + name + "))gl_loader_resolve(\"" + name + "\");", file=f)
+			print("\treturn (*" + name + ")(" + ", ".join(n for (_, n) in params) + ");", file=f)
+			print("}", file=f)
+		print("", file=f)
+		for (name, ret, params) in entry_points:
+			decl = ", ".join(t + " " + n for (t, n) in params)
+			print(ret + " (APIENTRY *" + name + ")(" + decl + ") = gl_lazy_" + name + ";", file=f)
+		print("""
+//point everything back at the stubs (for when the backend changes):
+static void gl_loader_reset() {""", file=f)
+		for (name, _, _) in entry_points:
+			print("\t" + name + " = gl_lazy_" + name + ";", file=f)
+		print("""	gl_loader_stats.resolved = 0;
+	gl_loader_stats.resolve_ms = 0.0;
+}
+
+//a backend is a library with a GetProcAddress and a GetCurrentContext:
+struct GLLoaderLibrary {
+	char const *backend;
+	std::vector< char const * > libraries; //(tried in order)
+	char const *get_proc_address;
+	char const *get_current_context;
+};
+
+//returns true if 'library' could be opened and (if 'need_context') has a current context:
+static bool gl_loader_open(GLLoaderLibrary const &library, bool need_context) {
+	for (char const *filename : library.libraries) {
+		void *handle = dlopen(filename, RTLD_LAZY | RTLD_LOCAL);
+		if (!handle) continue;
+		auto get_proc_address = (GLLoaderGetProcAddress)dlsym(handle, library.get_proc_address);
+		auto get_current_context = (void *(*)())dlsym(handle, library.get_current_context);
+		if (!get_proc_address || !get_current_context || (need_context && !get_current_context())) {
+			dlclose(handle);
+			continue;
+		}
+		//(the library is deliberately never closed, since the pointers it handed out point into it)
+		gl_loader_get_proc_address = get_proc_address;
+		gl_loader_stats.backend = library.backend;
+		return true;
+	}
+	return false;
+}
+
+void init_GL(GLLoaderBackend backend) {
+	static std::vector< GLLoaderLibrary > const libraries{
+		{ "EGL", { "libEGL.so.1", "libEGL.so" }, "eglGetProcAddress", "eglGetCurrentContext" },
+		{ "GLX", { "libGLX.so.0", "libGL.so.1", "libGL.so" }, "glXGetProcAddressARB", "glXGetCurrentContext" },
+		{ "OSMesa", { "libOSMesa.so.8", "libOSMesa.so.6", "libOSMesa.so" }, "OSMesaGetProcAddress", "OSMesaGetCurrentContext" },
+	};
+
+	auto before = std::chrono::steady_clock::now();
+
+	gl_loader_reset();
+	gl_loader_get_proc_address = nullptr;
+	gl_loader_stats.backend = "none";
+
+	bool opened = false;
+	if (backend == GLLoaderAuto) {
+		//pick the first backend with a context current (e.g., SDL uses GLX or EGL depending on the video driver):
+		for (auto const &library : libraries) {
+			if (gl_loader_open(library, true)) {
+				opened = true;
+				break;
+			}
+		}
+	} else {
+		//(an explicit backend must own the current context too, or its entry points would be for some other driver)
+		opened = gl_loader_open(libraries.at(backend - GLLoaderEGL), true);
+	}
+
+	gl_loader_stats.open_ms = std::chrono::duration< double, std::milli >(std::chrono::steady_clock::now() - before).count();
+
+	if (!opened) {
+		if (backend == GLLoaderAuto) {
+			throw std::runtime_error("init_GL: no EGL, GLX, or OSMesa context is current.");
+		} else {
+			throw std::runtime_error(std::string("init_GL: couldn't load the ") + libraries.at(backend - GLLoaderEGL).backend + " library, or it has no current context.");
+		}
+	}
+}
+
+#endif //__linux__""", file=f)
+
+	print("""
+bool gl_extension_supported(char const *name) {
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i) {
+		char const *extension = reinterpret_cast< char const * >(glGetStringi(GL_EXTENSIONS, GLuint(i)));
+		if (extension && std::strcmp(extension, name) == 0) return true;
+	}
+	return false;
+}""", file=f)
+
+	if args.profile or args.record:
+		print("""
+//------------ call layer ------------
+
+char const *gl_layer_names[GLP_COUNT] = {""", file=f)
+		print("\t" + "\n\t".join('"' + name + '",' for (name, _, _) in entry_points), file=f)
+		print("""};""", file=f)
+
+	if args.profile:
+		print("""
+//------------ call profiling layer ------------
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+bool gl_profile_enabled = false;
+
+static uint64_t gl_profile_calls[GLP_COUNT];
+static uint64_t gl_profile_nanoseconds[GLP_COUNT];
+""", file=f)
+		print("""
+uint64_t gl_profile_now() {
+	return std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void gl_profile_record(uint32_t index, uint64_t start) {
+	gl_profile_calls[index] += 1;
+	gl_profile_nanoseconds[index] += gl_profile_now() - start;
+}
+
+void gl_profile_reset() {
+	std::fill(gl_profile_calls, gl_profile_calls + GLP_COUNT, 0);
+	std::fill(gl_profile_nanoseconds, gl_profile_nanoseconds + GLP_COUNT, 0);
+}
+
+void gl_profile_dump(std::ostream &out) {
+	std::vector< uint32_t > called;
+	uint64_t total_calls = 0;
+	uint64_t total_nanoseconds = 0;
+	for (uint32_t i = 0; i < GLP_COUNT; ++i) {
+		if (gl_profile_calls[i] == 0) continue;
+		called.emplace_back(i);
+		total_calls += gl_profile_calls[i];
+		total_nanoseconds += gl_profile_nanoseconds[i];
+	}
+	std::stable_sort(called.begin(), called.end(), [](uint32_t a, uint32_t b) {
+		return gl_profile_nanoseconds[a] > gl_profile_nanoseconds[b];
+	});
+
+	std::ios::fmtflags flags = out.flags();
+	out << "GL calls: " << total_calls << " calls, " << std::fixed << std::setprecision(3) << (total_nanoseconds / 1.0e6) << " ms\\n";
+	out << "      calls   total ms     avg us  function\\n";
+	for (uint32_t i : called) {
+		out << std::setw(11) << gl_profile_calls[i]
+		    << std::setw(11) << std::setprecision(3) << (gl_profile_nanoseconds[i] / 1.0e6)
+		    << std::setw(11) << std::setprecision(3) << (gl_profile_nanoseconds[i] / 1.0e3 / gl_profile_calls[i])
+		    << "  " << gl_layer_names[i] << "\\n";
+	}
+	out.flush();
+	out.flags(flags);
+}""", file=f)
+
+	if args.record:
+		#--- per-parameter signatures ---
+		def signature(params):
+			sig = ""
+			for (t, _) in params:
+				if "*" not in t:
+					sig += "v"
+				elif t.startswith("const"):
+					sig += "i"
+				else:
+					sig += "o"
+			return sig
+
+		#--- sizes of the data that pointer parameters refer to ---
+		#(as C++ expressions over the recorded values v[], indexed by parameter; None means "not recorded")
+		pointee_sizes = { "b":1, "ub":1, "s":2, "us":2, "i":4, "ui":4, "f":4, "d":8 }
+		def payload_size(name, params, p):
+			(t, pname) = params[p]
+			if "*" not in t: return None
+			if not t.startswith("const") and not name.startswith("glGen"): return None #(outputs, other than new object names, aren't recorded)
+			names = [ n for (_, n) in params ]
+			def v(n, ty = "GLsizei"):
+				return ty + "(v[" + str(names.index(n)) + "])"
+			if name in ["glBufferData", "glBufferSubData"]:
+				return v("size", "uint64_t")
+			m = re.match(r"^glTex(Sub)?Image([123])D$", name)
+			if m != None:
+				dims = int(m.group(2))
+				return "gl_record_image_size(" + v("width") + ", " + (v("height") if dims >= 2 else "1") + ", " + (v("depth") if dims >= 3 else "1") + ", " + v("format", "GLenum") + ", " + v("type", "GLenum") + ")"
+			if name.startswith("glCompressedTex"):
+				return v("imageSize", "uint64_t")
+			m = re.match(r"^glUniform([1234])(f|i|ui)v$", name)
+			if m != None:
+				return v("count", "uint64_t") + " * " + m.group(1) + " * 4"
+			m = re.match(r"^glUniformMatrix([234])(x([234]))?fv$", name)
+			if m != None:
+				return v("count", "uint64_t") + " * " + str(int(m.group(1)) * int(m.group(3) or m.group(1))) + " * 4"
+			m = re.match(r"^glVertexAttribI?([1234])N?(b|ub|s|us|i|ui|f|d)v$", name)
+			if m != None:
+				return str(int(m.group(1)) * pointee_sizes[m.group(2)])
+			if re.match(r"^glVertexAttribP[1234]uiv$", name):
+				return "4"
+			if re.match(r"^gl(Tex|Sampler)Parameter(I?i|I?ui|f)v$", name):
+				#(only the four-component parameters take more than one value)
+				return "((" + v("pname", "GLenum") + " == GL_TEXTURE_BORDER_COLOR || " + v("pname", "GLenum") + " == GL_TEXTURE_SWIZZLE_RGBA) ? 16 : 4)"
+			if re.match(r"^glPointParameter(i|f)v$", name):
+				return "4"
+			if re.match(r"^glClearBuffer(i|ui|f)v$", name):
+				return "(" + v("buffer", "GLenum") + " == GL_COLOR ? 16 : 4)"
+			if name == "glDrawBuffers" or re.match(r"^gl(Gen|Delete)[A-Za-z]+s$", name):
+				return v(names[0], "uint64_t") + " * 4"
+			if name == "glMultiDrawArrays":
+				return v("drawcount", "uint64_t") + " * 4"
+			if t == "const GLchar *":
+				return "(std::strlen(reinterpret_cast< char const * >(uintptr_t(v[" + str(p) + "]))) + 1)"
+			return None
+
+		print("""
+//------------ call recording layer ------------
+
+#include <cstring>
+
+char const *gl_record_signatures[GLP_COUNT] = {""", file=f)
+		print("\t" + "\n\t".join('"' + signature(params) + '", //' + name for (name, _, params) in entry_points), file=f)
+		print("""};
+
+uint64_t gl_record_payload_size(uint32_t index, uint32_t param, uint64_t const *v) {
+	switch (index) {""", file=f)
+		for (name, _, params) in entry_points:
+			cases = []
+			for p in range(0, len(params)):
+				size = payload_size(name, params, p)
+				if size != None:
+					cases.append((p, size))
+			if len(cases) == 0: continue
+			if len(cases) == 1:
+				print("\t\tcase GLP_" + name + ": return (param == " + str(cases[0][0]) + " ? " + cases[0][1] + " : GLRecordNoPayload);", file=f)
+			else:
+				print("\t\tcase GLP_" + name + ":", file=f)
+				for (p, size) in cases:
+					print("\t\t\tif (param == " + str(p) + ") return " + size + ";", file=f)
+				print("\t\t\treturn GLRecordNoPayload;", file=f)
+		print("""		default: return GLRecordNoPayload;
+	}
+}""", file=f)
+
+	#--- replay dispatch ---
+	#object names and locations handed out by the driver differ from run to run,
+	# so they get translated by GLReplay (see GLReplay.hpp) on the way through:
+	def name_kind(name, t, pname):
+		if t == "GLsync": return "Sync"
+		if t == "GLint" and pname == "location": return "Uniform"
+		if t != "GLuint": return None
+		if pname == "index" and (name.startswith("glVertexAttrib") or name in ["glEnableVertexAttribArray", "glDisableVertexAttribArray", "glBindAttribLocation", "glGetVertexAttribdv", "glGetVertexAttribfv", "glGetVertexAttribiv", "glGetVertexAttribIiv", "glGetVertexAttribIuiv", "glGetVertexAttribPointerv"]):
+			return "Attrib"
+		return {
+			"buffer":"Buffer", "texture":"Texture", "array":"VertexArray",
+			"framebuffer":"Framebuffer", "renderbuffer":"Renderbuffer",
+			"program":"Program", "shader":"Shader", "sampler":"Sampler", "id":"Query",
+		}.get(pname)
+	object_kinds = {
+		"Buffers":"Buffer", "Textures":"Texture", "VertexArrays":"VertexArray",
+		"Framebuffers":"Framebuffer", "Renderbuffers":"Renderbuffer",
+		"Queries":"Query", "Samplers":"Sampler",
+	}
+	returned_kinds = {
+		"glCreateProgram":"Program", "glCreateShader":"Shader",
+		"glGetUniformLocation":"Uniform", "glGetAttribLocation":"Attrib",
+		"glFenceSync":"Sync",
+	}
+
+	if args.record:
+		with open("GLReplayDispatch.cpp", "w") as f:
+			print("""//generated by make-GL.py --record; issues one recorded call (see GLReplay.hpp)
+
+#include "GLReplay.hpp"
+
+void gl_replay_dispatch(GLReplay &r) {
+	switch (r.call->index) {""", file=f)
+			for (name, ret, params) in entry_points:
+				m = re.match(r"^gl(Gen|Delete)([A-Za-z]+)$", name)
+				gen_delete = (m.group(1), object_kinds[m.group(2)]) if m != None and m.group(2) in object_kinds else None
+
+				args_code = []
+				for p in range(0, len(params)):
+					(t, pname) = params[p]
+					kind = name_kind(name, t, pname)
+					if name == "glShaderSource" and p == 1:
+						args_code.append("1")
+					elif name == "glShaderSource" and p == 2:
+						args_code.append("&source")
+					elif name == "glShaderSource" and p == 3:
+						args_code.append("nullptr")
+					elif gen_delete and gen_delete[0] == "Delete" and p == 1:
+						args_code.append("r.names(GLReplay::" + gen_delete[1] + ", " + str(p) + ")")
+					elif "*" in t:
+						args_code.append("(" + t + ")r." + ("pointer" if t.startswith("const") else "output") + "(" + str(p) + ")")
+					elif kind != None:
+						args_code.append(t + "(r.name(GLReplay::" + kind + ", " + str(p) + "))")
+					elif t == "GLfloat":
+						args_code.append("r.float_value(" + str(p) + ")")
+					elif t in ["GLdouble", "GLclampd"]:
+						args_code.append("r.double_value(" + str(p) + ")")
+					else:
+						args_code.append(t + "(r.value(" + str(p) + "))")
+				call = name + "(" + ", ".join(args_code) + ")"
+
+				print("\t\tcase GLP_" + name + ": {", file=f)
+				if name == "glShaderSource":
+					print("\t\t\tGLchar const *source = r.shader_source(2);", file=f)
+				if name in returned_kinds:
+					print("\t\t\tr.returned(GLReplay::" + returned_kinds[name] + ", gl_record_value(" + call + "));", file=f)
+				else:
+					print("\t\t\t" + call + ";", file=f)
+				if gen_delete and gen_delete[0] == "Gen":
+					print("\t\t\tr.generated(GLReplay::" + gen_delete[1] + ", 1);", file=f)
+				if name == "glUseProgram":
+					print("\t\t\tr.recorded_program = r.value(0);", file=f)
+				print("\t\t} break;", file=f)
+			print("""		default:
+			r.unknown_call();
+	}
+}""", file=f)
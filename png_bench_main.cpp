@@ -0,0 +1,354 @@
+//png-bench: time save_png through libpng against the parallel encoder (with each filter) and against save_qoi,
+// on 1080p and 4K frames, and check that each encoder's files load back to the same pixels;
+// then time loading a set of sprites and atlases one by one against load_png_batch (and, given a headless GL context,
+// against acquire_png_texs, which uploads each texture while the rest decode), and against the same assets pre-decoded into
+// an AssetPack (stored raw and LZ4-compressed).
+
+#include "MultMode.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "HeadlessContext.hpp"
+#include "GLResources.hpp"
+#include "AssetPack.hpp"
+#include "load_save_png.hpp"
+#include "load_save_qoi.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	uint32_t threads = 0; //(0 means one per hardware thread)
+	int level = 6;
+	uint32_t repeats = 3;
+	std::string prefix = "png-bench";
+	bool keep = false;
+	bool encode = true, decode = true;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--threads" && argi + 1 < argc) {
+			threads = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--level" && argi + 1 < argc) {
+			level = std::stoi(argv[argi+1]);
+			argi += 1;
+		} else if (arg == "--repeats" && argi + 1 < argc) {
+			repeats = std::max(1u, uint32_t(std::stoul(argv[argi+1])));
+			argi += 1;
+		} else if (arg == "--out" && argi + 1 < argc) {
+			//files are written to <prefix>-<image>-<encoder>.png:
+			prefix = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--keep") {
+			//...and deleted afterward, unless this is given:
+			keep = true;
+		} else if (arg == "--skip-encode") {
+			encode = false;
+		} else if (arg == "--skip-decode") {
+			decode = false;
+		} else {
+			std::cerr << "Usage:\n"
+			             "  " << argv[0] << " [--threads <count>] [--level <0-9>] [--repeats <count>] [--out <prefix>] [--keep] [--skip-encode] [--skip-decode]" << std::endl;
+			return 1;
+		}
+	}
+	if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+	//------------  images ------------
+
+	struct Image {
+		std::string name;
+		glm::uvec2 size;
+		std::vector< glm::u8vec4 > pixels;
+	};
+	std::vector< Image > images;
+
+	Mode::gl_enabled = false;
+	for (glm::uvec2 size : { glm::uvec2(1920, 1080), glm::uvec2(3840, 2160) }) {
+		std::string name = std::to_string(size.y) + "p";
+
+		//a game frame (what screenshots and captures save), a little way into a match:
+		{
+			SoftwareRasterizer rasterizer(size);
+			std::shared_ptr< MultMode > mode = std::make_shared< MultMode >();
+			for (uint32_t f = 0; f < 100; ++f) {
+				mode->update(1.0f / 60.0f);
+			}
+			Mode::software_rasterizer = &rasterizer;
+			mode->draw(size);
+			rasterizer.finish();
+			Mode::software_rasterizer = nullptr;
+			images.emplace_back(Image{ name + "-game", size, rasterizer.pixels });
+		}
+
+		//something harder to compress (smooth gradients with a little noise, a bit like a photo):
+		{
+			std::vector< glm::u8vec4 > pixels(size.x * size.y);
+			std::mt19937 mt(0x15466);
+			for (uint32_t y = 0; y < size.y; ++y) {
+				for (uint32_t x = 0; x < size.x; ++x) {
+					float u = x / float(size.x), v = y / float(size.y);
+					int noise = int(mt() % 9) - 4;
+					auto channel = [&](float f) { return uint8_t(std::max(0, std::min(255, int(f * 255.0f) + noise))); };
+					pixels[y * size.x + x] = glm::u8vec4(channel(u), channel(v), channel(0.5f + 0.5f * std::sin(8.0f * (u + v))), 0xff);
+				}
+			}
+			images.emplace_back(Image{ name + "-noisy", size, std::move(pixels) });
+		}
+	}
+
+	//------------  benchmark ------------
+
+	typedef std::chrono::high_resolution_clock Clock;
+
+	struct Encoder {
+		std::string name;
+		bool libpng = false;
+		PNGSaveOptions options;
+		bool qoi = false;
+	};
+	std::vector< Encoder > encoders;
+	encoders.emplace_back(Encoder{ "libpng", true, PNGSaveOptions() });
+	encoders.emplace_back(Encoder{ "qoi", false, PNGSaveOptions(), true });
+	for (uint32_t t : { threads, 1u }) {
+		for (auto filter : { PNGSaveOptions::FilterNone, PNGSaveOptions::FilterUp, PNGSaveOptions::FilterPaeth, PNGSaveOptions::FilterAdaptive }) {
+			static char const *FilterNames[] = { "none", "sub", "up", "average", "paeth", "adaptive" };
+			Encoder encoder;
+			encoder.name = std::string("parallel-") + FilterNames[filter] + "-" + std::to_string(t) + "t";
+			encoder.options.compression_level = level;
+			encoder.options.filter = filter;
+			encoder.options.threads = t;
+			encoders.emplace_back(encoder);
+		}
+		if (threads == 1) break;
+	}
+
+	bool all_ok = true;
+	if (encode) std::cout << "Encoding with " << threads << " threads, parallel encoder at level " << level << " (median of " << repeats << "):" << std::endl;
+	for (Image const &image : (encode ? images : std::vector< Image >())) {
+		double libpng_ms = 0.0;
+		for (Encoder const &encoder : encoders) {
+			std::string filename = prefix + "-" + image.name + "-" + encoder.name + (encoder.qoi ? ".qoi" : ".png");
+			std::vector< double > times;
+			for (uint32_t r = 0; r < repeats; ++r) {
+				auto before = Clock::now();
+				if (encoder.libpng) save_png(filename, image.size, image.pixels.data(), LowerLeftOrigin);
+				else if (encoder.qoi) save_qoi(filename, image.size, image.pixels.data(), LowerLeftOrigin);
+				else save_png(filename, image.size, image.pixels.data(), LowerLeftOrigin, encoder.options);
+				times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+			}
+			std::sort(times.begin(), times.end());
+			double ms = times[times.size() / 2];
+			if (encoder.libpng) libpng_ms = ms;
+
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			double kib = double(file.tellg()) / 1024.0;
+			file.close();
+
+			//check that it decodes to what went in:
+			glm::uvec2 size;
+			std::vector< glm::u8vec4 > pixels;
+			bool ok = true;
+			try {
+				if (encoder.qoi) load_qoi(filename, &size, &pixels, LowerLeftOrigin);
+				else load_png(filename, &size, &pixels, LowerLeftOrigin);
+				ok = (size == image.size && pixels == image.pixels);
+			} catch (std::exception &) {
+				ok = false;
+			}
+			all_ok = all_ok && ok;
+			if (!keep) std::remove(filename.c_str());
+
+			double mpixels = image.size.x * double(image.size.y) / 1.0e6;
+			std::printf("  %-12s %-24s %9.2f ms %8.1f Mpix/s %9.0f KiB %6.2fx%s\n", image.name.c_str(), encoder.name.c_str(),
+				ms, mpixels / (ms / 1000.0), kib, libpng_ms / ms, ok ? "" : "  DOES NOT ROUND-TRIP");
+		}
+	}
+
+	//------------  decoding benchmark ------------
+
+	if (decode) {
+		//a plausible startup asset set: a few big atlases, some mid-size sheets, lots of small sprites
+		// (cut from the test images above, so they compress like real frames):
+		std::vector< std::string > assets;
+		{
+			PNGSaveOptions options;
+			options.filter = PNGSaveOptions::FilterAdaptive;
+			struct Kind { uint32_t count; uint32_t size; };
+			uint32_t index = 0;
+			for (Kind kind : { Kind{ 4, 2048 }, Kind{ 12, 1024 }, Kind{ 48, 128 } }) {
+				for (uint32_t i = 0; i < kind.count; ++i, ++index) {
+					Image const &from = images[(images.size() - 2) + (index % 2)]; //(the 4K game frame or noisy image)
+					glm::uvec2 offset = glm::uvec2((index * 97) % (from.size.x - kind.size), (index * 53) % (from.size.y - kind.size));
+					std::vector< glm::u8vec4 > pixels(kind.size * kind.size);
+					for (uint32_t y = 0; y < kind.size; ++y) {
+						std::copy(&from.pixels[(offset.y + y) * from.size.x + offset.x], &from.pixels[(offset.y + y) * from.size.x + offset.x] + kind.size, &pixels[y * kind.size]);
+					}
+					char number[32];
+					std::snprintf(number, sizeof(number), "%02u", index);
+					assets.emplace_back(prefix + "-asset" + number + ".png");
+					save_png(assets.back(), glm::uvec2(kind.size), pixels.data(), LowerLeftOrigin, options);
+				}
+			}
+		}
+		std::cout << "Loading " << assets.size() << " PNG assets (median of " << repeats << "):" << std::endl;
+
+		auto median = [](std::vector< double > times) {
+			std::sort(times.begin(), times.end());
+			return times[times.size() / 2];
+		};
+
+		//one after another:
+		std::vector< double > serial_times;
+		for (uint32_t r = 0; r < repeats; ++r) {
+			auto before = Clock::now();
+			for (std::string const &asset : assets) {
+				glm::uvec2 size;
+				std::vector< glm::u8vec4 > data;
+				load_png(asset, &size, &data, LowerLeftOrigin);
+			}
+			serial_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+		}
+		double serial_ms = median(serial_times);
+		std::printf("  %-40s %9.2f ms\n", "load_png, one after another", serial_ms);
+
+		//all at once:
+		std::vector< double > batch_times;
+		std::vector< LoadedPNG > loaded;
+		for (uint32_t r = 0; r < repeats; ++r) {
+			auto before = Clock::now();
+			std::unique_ptr< PNGBatch > batch = load_png_batch(assets, LowerLeftOrigin, threads);
+			loaded.clear();
+			for (auto &result : batch->results) {
+				loaded.emplace_back(result.get());
+			}
+			batch_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+		}
+		double batch_ms = median(batch_times);
+		std::printf("  %-40s %9.2f ms %6.2fx\n", ("load_png_batch, " + std::to_string(threads) + " threads").c_str(), batch_ms, serial_ms / batch_ms);
+
+		//per-file times (from the last batch):
+		std::sort(loaded.begin(), loaded.end(), [](LoadedPNG const &a, LoadedPNG const &b) { return a.decode_ms > b.decode_ms; });
+		double total_decode = 0.0, total_read = 0.0;
+		for (LoadedPNG const &l : loaded) {
+			total_decode += l.decode_ms;
+			total_read += l.read_ms;
+		}
+		std::printf("    per file: %.2f ms reading and %.2f ms decoding in total; slowest:\n", total_read, total_decode);
+		for (size_t i = 0; i < std::min(size_t(3), loaded.size()); ++i) {
+			std::printf("      %-40s %4ux%-4u %8.2f ms\n", loaded[i].filename.c_str(), loaded[i].size.x, loaded[i].size.y, loaded[i].decode_ms);
+		}
+
+		//pre-decoded into packs (as asset-packer would), then mapped and read back:
+		std::vector< std::string > packs;
+		for (bool lz4 : { false, true }) {
+			AssetPackWriter writer;
+			for (LoadedPNG const &l : loaded) {
+				writer.add_texture(l.filename, l.size, l.data.data(), lz4);
+			}
+			packs.emplace_back(prefix + (lz4 ? "-lz4.pack" : "-raw.pack"));
+			writer.save(packs.back());
+		}
+		for (std::string const &pack_file : packs) {
+			std::vector< double > pack_times;
+			uint64_t stored = 0;
+			for (uint32_t r = 0; r < repeats; ++r) {
+				auto before = Clock::now();
+				AssetPack pack(pack_file);
+				stored = 0;
+				for (std::string const &asset : assets) {
+					AssetPack::Entry const *entry = pack.find(asset);
+					std::vector< glm::u8vec4 > data(entry->width * entry->height);
+					pack.read(*entry, data.data());
+					stored += entry->stored_size;
+				}
+				pack_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+			}
+			double pack_ms = median(pack_times);
+			std::printf("  %-40s %9.2f ms %6.2fx (%.1f MiB stored)\n", ("AssetPack '" + pack_file + "'").c_str(), pack_ms, serial_ms / pack_ms, stored / (1024.0 * 1024.0));
+		}
+
+		//as textures (this is most of the time-to-first-frame cost of loading assets):
+		std::unique_ptr< HeadlessContext > headless_context;
+		try {
+			headless_context.reset(new HeadlessContext(glm::uvec2(64, 64)));
+		} catch (std::exception const &e) {
+			std::cout << "NOTE: no headless GL context (" << e.what() << "); not timing texture uploads." << std::endl;
+		}
+		if (headless_context) {
+			std::vector< double > upload_serial_times, upload_batch_times;
+			for (uint32_t r = 0; r < repeats; ++r) {
+				auto before = Clock::now();
+				{
+					std::vector< std::shared_ptr< GLTexture const > > textures;
+					for (std::string const &asset : assets) {
+						textures.emplace_back(acquire_png_tex(asset));
+					}
+					glFinish();
+					upload_serial_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+				}
+				before = Clock::now();
+				{
+					std::vector< std::shared_ptr< GLTexture const > > textures = acquire_png_texs(assets);
+					glFinish();
+					upload_batch_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+				}
+			}
+			double upload_serial_ms = median(upload_serial_times);
+			double upload_batch_ms = median(upload_batch_times);
+			std::printf("  %-40s %9.2f ms\n", "acquire_png_tex, one after another", upload_serial_ms);
+			std::printf("  %-40s %9.2f ms %6.2fx\n", "acquire_png_texs", upload_batch_ms, upload_serial_ms / upload_batch_ms);
+			for (std::string const &pack_file : packs) {
+				std::vector< double > upload_pack_times;
+				for (uint32_t r = 0; r < repeats; ++r) {
+					auto before = Clock::now();
+					AssetPack pack(pack_file);
+					std::vector< std::shared_ptr< GLTexture const > > textures;
+					for (std::string const &asset : assets) {
+						textures.emplace_back(acquire_pack_tex(pack, asset));
+					}
+					glFinish();
+					upload_pack_times.emplace_back(std::chrono::duration< double, std::milli >(Clock::now() - before).count());
+				}
+				double upload_pack_ms = median(upload_pack_times);
+				std::printf("  %-40s %9.2f ms %6.2fx\n", ("acquire_pack_tex, '" + pack_file + "'").c_str(), upload_pack_ms, upload_serial_ms / upload_pack_ms);
+			}
+			headless_context.reset();
+		}
+
+		if (!keep) {
+			for (std::string const &asset : assets) {
+				std::remove(asset.c_str());
+			}
+			for (std::string const &pack_file : packs) {
+				std::remove(pack_file.c_str());
+			}
+		}
+	}
+
+	return all_ok ? 0 : 1;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,82 @@
+//qoi-to-png: convert QOI screenshots and captures (see load_save_qoi.hpp) to PNG after the fact,
+// writing each <name>.qoi next to itself as <name>.png; frames are converted one at a time, each with save_png's parallel encoder.
+
+#include "load_save_png.hpp"
+#include "load_save_qoi.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	std::vector< std::string > inputs;
+	bool remove_inputs = false;
+	bool usage = false;
+	PNGSaveOptions options;
+	options.filter = PNGSaveOptions::FilterAdaptive; //(there's time to spare offline, so make smaller files)
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--level" && argi + 1 < argc) {
+			options.compression_level = std::stoi(argv[argi+1]);
+			argi += 1;
+		} else if (arg == "--remove") {
+			//delete each .qoi file once its .png is written:
+			remove_inputs = true;
+		} else if (arg.size() > 4 && arg.compare(arg.size() - 4, 4, ".qoi") == 0) {
+			inputs.emplace_back(arg);
+		} else {
+			usage = true;
+			break;
+		}
+	}
+	if (usage || inputs.empty()) {
+		std::cerr << "Usage:\n"
+		             "  " << argv[0] << " [--level <0-9>] [--remove] <file.qoi> [<file.qoi> ...]" << std::endl;
+		return 1;
+	}
+
+	//------------  convert ------------
+
+	typedef std::chrono::high_resolution_clock Clock;
+	auto before = Clock::now();
+
+	uint32_t failed = 0;
+	for (std::string const &input : inputs) {
+		std::string output = input.substr(0, input.size() - 4) + ".png";
+		try {
+			glm::uvec2 size;
+			std::vector< glm::u8vec4 > data;
+			load_qoi(input, &size, &data, UpperLeftOrigin);
+			save_png(output, size, data.data(), UpperLeftOrigin, options);
+		} catch (std::exception const &e) {
+			std::cerr << e.what() << std::endl;
+			failed += 1;
+			continue;
+		}
+		if (remove_inputs) std::remove(input.c_str());
+	}
+
+	std::cout << "Converted " << (inputs.size() - failed) << " of " << inputs.size() << " files in "
+	          << std::chrono::duration< double, std::milli >(Clock::now() - before).count() << " ms." << std::endl;
+
+	return failed ? 1 : 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,198 @@
+//raster-bench: draw the same MultMode frames with GL on a headless context (e.g. Mesa's llvmpipe)
+// and with SoftwareRasterizer (with each kind of span and a few thread counts), and compare times and pixels.
+
+#include "MultMode.hpp"
+#include "HeadlessContext.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "GLStateCache.hpp"
+#include "load_save_png.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	glm::uvec2 size = glm::uvec2(1280, 720);
+	uint32_t frames = 300;
+	uint32_t threads = 0; //(0 means one per hardware thread)
+	GLLoaderBackend gl_loader = GLLoaderAuto;
+	std::string save_prefix;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--size" && argi + 1 < argc) {
+			unsigned int w = 0, h = 0;
+			if (std::sscanf(argv[argi+1], "%ux%u", &w, &h) != 2 || w == 0 || h == 0) {
+				std::cerr << "Expecting a size like '1280x720' after --size, got '" << argv[argi+1] << "'." << std::endl;
+				return 1;
+			}
+			size = glm::uvec2(w, h);
+			argi += 1;
+		} else if (arg == "--frames" && argi + 1 < argc) {
+			frames = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--threads" && argi + 1 < argc) {
+			threads = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--gl-loader" && argi + 1 < argc) {
+			std::string name = argv[argi+1];
+			if (name == "egl") gl_loader = GLLoaderEGL;
+			else if (name == "osmesa") gl_loader = GLLoaderOSMesa;
+			else {
+				std::cerr << "Expecting 'egl' or 'osmesa' after --gl-loader, got '" << name << "'." << std::endl;
+				return 1;
+			}
+			argi += 1;
+		} else if (arg == "--save" && argi + 1 < argc) {
+			//write the last frame from each renderer to <prefix>-gl.png and <prefix>-software.png:
+			save_prefix = argv[argi+1];
+			argi += 1;
+		} else {
+			std::cerr << "Usage:\n"
+			             "  " << argv[0] << " [--size <W>x<H>] [--frames <count>] [--threads <count>] [--gl-loader egl|osmesa] [--save <prefix>]" << std::endl;
+			return 1;
+		}
+	}
+
+	//------------  renderers ------------
+
+	std::unique_ptr< HeadlessContext > headless_context;
+	try {
+		headless_context.reset(new HeadlessContext(size, gl_loader));
+		std::cout << "GL_RENDERER: " << reinterpret_cast< char const * >(glGetString(GL_RENDERER)) << std::endl;
+	} catch (std::exception const &e) {
+		std::cerr << "NOTE: no headless GL context (" << e.what() << "); only timing the software rasterizer." << std::endl;
+	}
+	Mode::gl_enabled = bool(headless_context);
+
+	struct Software {
+		std::string name;
+		std::unique_ptr< SoftwareRasterizer > rasterizer;
+		std::vector< double > times;
+	};
+	std::vector< Software > softwares;
+	auto add_software = [&](SoftwareRasterizer::Simd simd, uint32_t threads) {
+		softwares.emplace_back();
+		Software &software = softwares.back();
+		software.rasterizer.reset(new SoftwareRasterizer(size, threads));
+		software.rasterizer->simd = simd;
+		software.name = std::string("software (") + SoftwareRasterizer::simd_name(simd) + ", " + std::to_string(software.rasterizer->threads()) + " threads)";
+	};
+	SoftwareRasterizer::Simd best = SoftwareRasterizer::best_simd();
+	for (SoftwareRasterizer::Simd simd : { SoftwareRasterizer::Scalar, SoftwareRasterizer::SSE2, SoftwareRasterizer::AVX2 }) {
+		if (simd <= best) add_software(simd, threads);
+	}
+	if (softwares.back().rasterizer->threads() != 1) add_software(best, 1);
+
+	//------------  benchmark ------------
+
+	typedef std::chrono::high_resolution_clock Clock;
+	auto milliseconds = [](Clock::duration d) {
+		return std::chrono::duration< double, std::milli >(d).count();
+	};
+
+	std::shared_ptr< MultMode > mode = std::make_shared< MultMode >();
+	std::vector< double > gl_times;
+	std::vector< glm::u8vec4 > gl_pixels;
+
+	for (uint32_t frame = 0; frame < frames; ++frame) {
+		mode->update(1.0f / 60.0f);
+
+		//(every renderer draws the same state, and includes the time it takes the mode to build vertices)
+		if (headless_context) {
+			Mode::gl_enabled = true;
+			Mode::software_rasterizer = nullptr;
+			auto before = Clock::now();
+			mode->draw(size);
+			gl_state.end_frame();
+			headless_context->read_pixels(&gl_pixels); //(waits for the frame to finish)
+			gl_times.emplace_back(milliseconds(Clock::now() - before));
+		}
+
+		Mode::gl_enabled = false;
+		for (Software &software : softwares) {
+			Mode::software_rasterizer = software.rasterizer.get();
+			auto before = Clock::now();
+			mode->draw(size);
+			software.rasterizer->finish();
+			software.times.emplace_back(milliseconds(Clock::now() - before));
+		}
+		Mode::software_rasterizer = nullptr;
+	}
+
+	//------------  report ------------
+
+	//(the first frame includes setup, so is left out)
+	auto report = [&](std::string const &name, std::vector< double > times) {
+		if (times.size() > 1) times.erase(times.begin());
+		if (times.empty()) return 0.0;
+		double total = 0.0;
+		for (double t : times) total += t;
+		std::sort(times.begin(), times.end());
+		double median = times[times.size() / 2];
+		std::printf("%-32s median %8.3f ms, mean %8.3f ms, max %8.3f ms", name.c_str(), median, total / times.size(), times.back());
+		return median;
+	};
+
+	std::cout << "Drew " << frames << " frames at " << size.x << "x" << size.y << ":" << std::endl;
+	double gl_median = 0.0;
+	if (headless_context) {
+		gl_median = report("GL", gl_times);
+		std::printf("\n");
+	}
+	for (Software &software : softwares) {
+		double median = report(software.name, software.times);
+		if (gl_median > 0.0 && median > 0.0) std::printf("  (%.2fx GL)", gl_median / median);
+		std::printf("\n");
+	}
+	std::fflush(stdout);
+
+	SoftwareRasterizer const &software = *softwares.back().rasterizer;
+	if (headless_context && frames > 0) {
+		//compare the last frames (rounding in blending, and edge rules, may differ a bit):
+		uint32_t differ = 0;
+		int max_difference = 0;
+		for (size_t i = 0; i < gl_pixels.size(); ++i) {
+			int difference = 0;
+			for (uint32_t c = 0; c < 4; ++c) {
+				difference = std::max(difference, std::abs(int(gl_pixels[i][c]) - int(software.pixels[i][c])));
+			}
+			if (difference > 1) differ += 1;
+			max_difference = std::max(max_difference, difference);
+		}
+		std::cout << "Last frame: " << differ << " of " << gl_pixels.size() << " pixels differ from GL by more than 1 (max difference " << max_difference << ")." << std::endl;
+	}
+
+	if (save_prefix != "" && frames > 0) {
+		if (headless_context) save_png(save_prefix + "-gl.png", size, gl_pixels.data(), LowerLeftOrigin);
+		save_png(save_prefix + "-software.png", size, software.pixels.data(), LowerLeftOrigin);
+	}
+
+	mode.reset();
+	softwares.clear();
+	headless_context.reset();
+
+	return 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
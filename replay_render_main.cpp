@@ -0,0 +1,279 @@
+//replay-render: re-render a match recorded with 'pong --record-replay' to video (or PNGs), as fast as the machine allows.
+// The replay is first simulated straight through (which is cheap) taking a MultMode::snapshot() at the start of every segment;
+// then segments are drawn in parallel, each re-simulated from its snapshot into its own SoftwareRasterizer,
+// and (for .y4m output) written to a part file that is appended to the output, in order, as soon as the segments before it are done.
+
+#include "MultMode.hpp"
+#include "Replay.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "FrameCapture.hpp"
+#include "load_save_png.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try {
+#endif
+
+	//------------  command line ------------
+
+	std::string replay_file;
+	std::string png_prefix;
+	std::string y4m_file;
+	uint32_t threads = 0; //(0 means one per hardware thread)
+	uint32_t segment_frames = 600;
+	uint32_t fps = 60;
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--png" && argi + 1 < argc) {
+			//write frames to <prefix>000000.png, <prefix>000001.png, ...:
+			png_prefix = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--y4m" && argi + 1 < argc) {
+			//write frames to a .y4m file (e.g. for 'ffmpeg -i out.y4m out.mp4'):
+			y4m_file = argv[argi+1];
+			argi += 1;
+		} else if (arg == "--threads" && argi + 1 < argc) {
+			threads = uint32_t(std::stoul(argv[argi+1]));
+			argi += 1;
+		} else if (arg == "--segment-frames" && argi + 1 < argc) {
+			//frames per segment (each starts from a snapshot, so shorter segments spread better but snapshot more often):
+			segment_frames = std::max(1u, uint32_t(std::stoul(argv[argi+1])));
+			argi += 1;
+		} else if (arg == "--fps" && argi + 1 < argc) {
+			fps = std::max(1u, uint32_t(std::stoul(argv[argi+1])));
+			argi += 1;
+		} else if (replay_file == "" && arg.size() > 0 && arg[0] != '-') {
+			replay_file = arg;
+		} else {
+			replay_file = "";
+			break;
+		}
+	}
+	if (replay_file == "" || (png_prefix == "") == (y4m_file == "")) {
+		std::cerr << "Usage:\n"
+		             "  " << argv[0] << " <replay> --png <prefix> | --y4m <file.y4m> [--threads <count>] [--segment-frames <count>] [--fps <fps>]" << std::endl;
+		return 1;
+	}
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	Replay replay;
+	try {
+		replay = Replay::load(replay_file);
+	} catch (std::exception const &e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+	if (replay.frames.empty()) {
+		std::cerr << "Replay '" << replay_file << "' has no frames." << std::endl;
+		return 1;
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	auto milliseconds = [](Clock::duration d) {
+		return std::chrono::duration< double, std::milli >(d).count();
+	};
+	auto start_time = Clock::now();
+
+	//(everything is drawn on the CPU; the modes never touch GL)
+	Mode::gl_enabled = false;
+
+	//feed one recorded frame to the mode, the way main.cpp's loop would have:
+	auto step = [](MultMode &mode, Replay::Frame const &frame) {
+		for (SDL_Event const &evt : frame.events) {
+			mode.handle_event(evt, frame.window_size);
+		}
+		mode.update(frame.elapsed);
+	};
+
+	//------------  simulate, taking snapshots ------------
+
+	uint32_t frame_count = uint32_t(replay.frames.size());
+	std::vector< std::shared_ptr< MultMode > > keyframes;
+	std::shared_ptr< MultMode > final_state;
+	{
+		std::shared_ptr< MultMode > mode = std::make_shared< MultMode >();
+		for (uint32_t f = 0; f < frame_count; ++f) {
+			if (f % segment_frames == 0) keyframes.emplace_back(mode->snapshot());
+			step(*mode, replay.frames[f]);
+			//(drawing, even with nowhere to draw to, sets the mapping the next frame's mouse events go through)
+			mode->draw(replay.frames[f].drawable_size);
+		}
+		final_state = mode;
+	}
+	auto simulated_time = Clock::now();
+
+	//------------  draw segments in parallel ------------
+
+	//(.y4m streams can't change size, so every frame is drawn at the first frame's size)
+	glm::uvec2 size = replay.frames[0].drawable_size;
+	if (y4m_file != "") size = glm::uvec2(size.x & ~1u, size.y & ~1u);
+	uint32_t segment_count = uint32_t(keyframes.size());
+	threads = std::min(threads, segment_count);
+
+	FILE *y4m = nullptr;
+	if (y4m_file != "") {
+		y4m = std::fopen(y4m_file.c_str(), "wb");
+		if (!y4m) {
+			std::cerr << "Failed to open '" << y4m_file << "' for writing." << std::endl;
+			return 1;
+		}
+		std::fputs(FrameCapture::y4m_header(size, fps).c_str(), y4m);
+	}
+	auto part_file = [&](uint32_t segment) {
+		return y4m_file + ".part" + std::to_string(segment);
+	};
+
+	std::mutex mutex;
+	std::condition_variable done_cv;
+	std::vector< bool > done(segment_count, false);
+	std::vector< std::string > errors;
+	std::atomic< uint32_t > next_segment(0);
+	bool diverged = false;
+
+	auto draw_segments = [&]() {
+		SoftwareRasterizer rasterizer(size, 1); //(the parallelism is across segments)
+		std::vector< uint8_t > yuv;
+		while (true) {
+			uint32_t segment = next_segment++;
+			if (segment >= segment_count) break;
+			std::shared_ptr< MultMode > mode = keyframes[segment];
+			keyframes[segment].reset(); //(each snapshot is only used once)
+
+			uint32_t begin = segment * segment_frames;
+			uint32_t end = std::min(frame_count, begin + segment_frames);
+			std::string error;
+			FILE *part = nullptr;
+			if (y4m) {
+				part = std::fopen(part_file(segment).c_str(), "wb");
+				if (!part) error = "Failed to open '" + part_file(segment) + "' for writing.";
+			}
+			for (uint32_t f = begin; f < end && error == ""; ++f) {
+				Replay::Frame const &frame = replay.frames[f];
+				step(*mode, frame);
+
+				Mode::software_rasterizer = &rasterizer;
+				mode->draw(size);
+				rasterizer.finish();
+				Mode::software_rasterizer = nullptr;
+				if (frame.drawable_size != size) {
+					//(put the mouse mapping back the way the recorded frame left it)
+					mode->draw(frame.drawable_size);
+				}
+
+				if (part) {
+					FrameCapture::convert_yuv420(size, rasterizer.pixels.data(), &yuv);
+					std::fputs("FRAME\n", part);
+					if (std::fwrite(yuv.data(), 1, yuv.size(), part) != yuv.size()) {
+						error = "Failed to write to '" + part_file(segment) + "'.";
+					}
+				} else {
+					char number[32];
+					std::snprintf(number, sizeof(number), "%06u", f);
+					PNGSaveOptions options;
+					options.threads = 1; //(segments are already drawn in parallel)
+					try {
+						save_png(png_prefix + number + ".png", size, rasterizer.pixels.data(), LowerLeftOrigin, options);
+					} catch (std::exception const &e) {
+						error = e.what();
+					}
+				}
+			}
+			if (part) std::fclose(part);
+
+			//the last segment should end where the straight-through simulation did:
+			bool mismatch = (end == frame_count && (mode->ball != final_state->ball
+				|| mode->left_score != final_state->left_score || mode->right_score != final_state->right_score));
+
+			{
+				std::unique_lock< std::mutex > lock(mutex);
+				if (error != "") errors.emplace_back(error);
+				if (mismatch) diverged = true;
+				done[segment] = true;
+			}
+			done_cv.notify_all();
+		}
+	};
+
+	std::vector< std::thread > workers;
+	for (uint32_t t = 0; t < threads; ++t) {
+		workers.emplace_back(draw_segments);
+	}
+
+	//stitch .y4m parts together in order as they finish:
+	if (y4m) {
+		std::vector< char > buffer(1 << 20);
+		for (uint32_t segment = 0; segment < segment_count; ++segment) {
+			{
+				std::unique_lock< std::mutex > lock(mutex);
+				done_cv.wait(lock, [&]() { return bool(done[segment]); });
+				if (!errors.empty()) break;
+			}
+			FILE *part = std::fopen(part_file(segment).c_str(), "rb");
+			if (!part) {
+				std::unique_lock< std::mutex > lock(mutex);
+				errors.emplace_back("Failed to open '" + part_file(segment) + "' to append it.");
+				break;
+			}
+			size_t count;
+			while ((count = std::fread(buffer.data(), 1, buffer.size(), part)) > 0) {
+				std::fwrite(buffer.data(), 1, count, y4m);
+			}
+			std::fclose(part);
+			std::remove(part_file(segment).c_str());
+		}
+	}
+
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	if (y4m) {
+		if (std::fclose(y4m) != 0) errors.emplace_back("Failed to finish writing '" + y4m_file + "'.");
+		for (uint32_t segment = 0; segment < segment_count; ++segment) {
+			std::remove(part_file(segment).c_str()); //(in case of errors)
+		}
+	}
+	auto end_time = Clock::now();
+
+	//------------  report ------------
+
+	for (std::string const &error : errors) {
+		std::cerr << error << std::endl;
+	}
+	if (diverged) {
+		std::cerr << "WARNING: re-simulating from snapshots didn't end in the same state as simulating straight through; frames may not match the recorded match." << std::endl;
+	}
+
+	double draw_ms = milliseconds(end_time - simulated_time);
+	std::cout << "Rendered " << frame_count << " frames at " << size.x << "x" << size.y << " to '" << (y4m ? y4m_file : png_prefix) << "' in "
+	          << segment_count << " segments on " << threads << " threads: "
+	          << milliseconds(simulated_time - start_time) << " ms to simulate, " << draw_ms << " ms to draw ("
+	          << (frame_count / (draw_ms / 1000.0)) << " frames/second, " << (frame_count / double(fps)) / (draw_ms / 1000.0) << "x real time)." << std::endl;
+
+	return errors.empty() ? 0 : 1;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}